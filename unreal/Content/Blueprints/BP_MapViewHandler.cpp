@@ -56,6 +56,20 @@ private:
         {
             RotateCamera(Value);
         }
+        else if (Value != 0.0f)
+        {
+            UpdateHoveredMarker();
+        }
+    }
+
+    void UpdateHoveredMarker()
+    {
+        if (APlayerController* PC = UGameplayStatics::GetPlayerController(this, 0))
+        {
+            FHitResult HitResult;
+            PC->GetHitResultUnderCursor(ECC_Visibility, true, HitResult);
+            HandleMarkerHover(HitResult);
+        }
     }
 
     void HandleMouseY(float Value)
@@ -89,15 +103,8 @@ private:
             FHitResult HitResult;
             PC->GetHitResultUnderCursor(ECC_Visibility, true, HitResult);
 
-            if (AActor* HitActor = HitResult.GetActor())
-            {
-                // Check if it's a venue marker
-                if (HitActor->Tags.Num() > 0)
-                {
-                    FString VenueId = HitActor->Tags[0].ToString();
-                    SelectVenue(VenueId);
-                }
-            }
+            // Markers are instances, so the hit item identifies the record
+            HandleMarkerClicked(HitResult);
         }
     }
 
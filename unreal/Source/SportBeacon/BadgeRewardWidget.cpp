@@ -13,6 +13,29 @@ void UBadgeRewardWidget::NativeConstruct()
 }
 
 void UBadgeRewardWidget::DisplayEarnedBadge(const FBadgeData& BadgeData)
+{
+    SetBadgeData(BadgeData);
+
+    // Play animations
+    PlayAnimationSequence();
+
+    // Notify blueprint
+    OnBadgeDisplayed();
+}
+
+void UBadgeRewardWidget::BindFeedEntry(const FFeedEntry& Entry, bool bIsNewEntry)
+{
+    if (bIsNewEntry)
+    {
+        DisplayEarnedBadge(Entry.BadgeData);
+    }
+    else
+    {
+        SetBadgeData(Entry.BadgeData);
+    }
+}
+
+void UBadgeRewardWidget::SetBadgeData(const FBadgeData& BadgeData)
 {
     // Set badge data
     SetBadgeIcon(BadgeData.Icon);
@@ -26,12 +49,6 @@ void UBadgeRewardWidget::DisplayEarnedBadge(const FBadgeData& BadgeData)
         FLinearColor Color = BadgeData.BadgeColor;
         BadgeBackground->SetBrushColor(Color);
     }
-
-    // Play animations
-    PlayAnimationSequence();
-
-    // Notify blueprint
-    OnBadgeDisplayed();
 }
 
 void UBadgeRewardWidget::SetBadgeIcon(UTexture2D* Icon)
@@ -83,34 +100,48 @@ void UBadgeRewardWidget::InitializeAnimations()
     {
         SparkleAnimation->SetPlaybackSpeed(1.0f);
     }
+
+    // NativeConstruct runs again when a pooled widget is re-added, so clear before binding
+    if (FadeInAnimation)
+    {
+        UnbindAllFromAnimationFinished(FadeInAnimation);
+
+        FWidgetAnimationDynamicEvent FadeInFinished;
+        FadeInFinished.BindDynamic(this, &UBadgeRewardWidget::OnFadeInFinished);
+        BindToAnimationFinished(FadeInAnimation, FadeInFinished);
+    }
+
+    if (PulseAnimation)
+    {
+        UnbindAllFromAnimationFinished(PulseAnimation);
+
+        FWidgetAnimationDynamicEvent PulseFinished;
+        PulseFinished.BindDynamic(this, &UBadgeRewardWidget::OnPulseFinished);
+        BindToAnimationFinished(PulseAnimation, PulseFinished);
+    }
 }
 
 void UBadgeRewardWidget::PlayAnimationSequence()
 {
-    // Play animations in sequence
+    // Play animations in sequence, the finished handlers chain the rest
     if (FadeInAnimation)
     {
         PlayAnimation(FadeInAnimation, 0.0f, 1, EUMGSequencePlayMode::Forward, 1.0f);
-        
-        // Chain animations using lambda
-        FadeInAnimation->OnAnimationFinished_Add(
-            FSimpleDelegate::CreateLambda([this]()
-            {
-                if (PulseAnimation)
-                {
-                    PlayAnimation(PulseAnimation, 0.0f, 1, EUMGSequencePlayMode::Forward, 1.0f);
-                    
-                    PulseAnimation->OnAnimationFinished_Add(
-                        FSimpleDelegate::CreateLambda([this]()
-                        {
-                            if (SparkleAnimation)
-                            {
-                                PlayAnimation(SparkleAnimation, 0.0f, 1, EUMGSequencePlayMode::Forward, 1.0f);
-                            }
-                        })
-                    );
-                }
-            })
-        );
     }
-} 
\ No newline at end of file
+}
+
+void UBadgeRewardWidget::OnFadeInFinished()
+{
+    if (PulseAnimation)
+    {
+        PlayAnimation(PulseAnimation, 0.0f, 1, EUMGSequencePlayMode::Forward, 1.0f);
+    }
+}
+
+void UBadgeRewardWidget::OnPulseFinished()
+{
+    if (SparkleAnimation)
+    {
+        PlayAnimation(SparkleAnimation, 0.0f, 1, EUMGSequencePlayMode::Forward, 1.0f);
+    }
+}
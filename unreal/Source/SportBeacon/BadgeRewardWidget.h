@@ -6,34 +6,11 @@
 #include "Components/TextBlock.h"
 #include "Components/Border.h"
 #include "Components/WidgetAnimation.h"
+#include "FeedEntryWidget.h"
 #include "BadgeRewardWidget.generated.h"
 
-USTRUCT(BlueprintType)
-struct FBadgeData
-{
-    GENERATED_BODY()
-
-    UPROPERTY(EditAnywhere, BlueprintReadWrite)
-    FString BadgeID;
-
-    UPROPERTY(EditAnywhere, BlueprintReadWrite)
-    FString Name;
-
-    UPROPERTY(EditAnywhere, BlueprintReadWrite)
-    FString Description;
-
-    UPROPERTY(EditAnywhere, BlueprintReadWrite)
-    UTexture2D* Icon;
-
-    UPROPERTY(EditAnywhere, BlueprintReadWrite)
-    FString EarnedDate;
-
-    UPROPERTY(EditAnywhere, BlueprintReadWrite)
-    FLinearColor BadgeColor;
-};
-
 UCLASS()
-class SPORTBEACON_API UBadgeRewardWidget : public UUserWidget
+class SPORTBEACON_API UBadgeRewardWidget : public UUserWidget, public IFeedEntryWidget
 {
     GENERATED_BODY()
 
@@ -45,6 +22,13 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Badge")
     void DisplayEarnedBadge(const FBadgeData& BadgeData);
 
+    // Fills in the badge without the earned animation, for rows that are only being redrawn
+    UFUNCTION(BlueprintCallable, Category = "Badge")
+    void SetBadgeData(const FBadgeData& BadgeData);
+
+    // IFeedEntryWidget
+    virtual void BindFeedEntry(const FFeedEntry& Entry, bool bIsNewEntry) override;
+
     UFUNCTION(BlueprintCallable, Category = "Badge")
     void SetBadgeIcon(UTexture2D* Icon);
 
@@ -91,4 +75,11 @@ protected:
 private:
     void InitializeAnimations();
     void PlayAnimationSequence();
+
+    // Chain steps, bound once so recycled widgets do not stack handlers
+    UFUNCTION()
+    void OnFadeInFinished();
+
+    UFUNCTION()
+    void OnPulseFinished();
 }; 
\ No newline at end of file
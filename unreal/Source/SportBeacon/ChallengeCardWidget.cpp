@@ -9,6 +9,13 @@ void UChallengeCardWidget::NativeConstruct()
 {
     Super::NativeConstruct();
     InitializeVisuals();
+
+    // Setup usually runs before construction, when the lookup tables were still empty
+    if (bHasAppliedChallenge)
+    {
+        SetDifficultyColor(AppliedChallenge.Difficulty);
+        SetCategoryIcon(AppliedChallenge.Category);
+    }
 }
 
 void UChallengeCardWidget::InitializeVisuals()
@@ -38,21 +45,36 @@ void UChallengeCardWidget::InitializeVisuals()
 
 void UChallengeCardWidget::SetupChallenge(const FChallengeData& ChallengeData)
 {
+    const bool bFirstSetup = !bHasAppliedChallenge;
+    const FChallengeData& Previous = AppliedChallenge;
+
     ChallengeId = ChallengeData.Id;
     TargetProgress = ChallengeData.Target;
 
-    if (TitleText)
+    if (TitleText && (bFirstSetup || !Previous.Title.Equals(ChallengeData.Title, ESearchCase::CaseSensitive)))
         TitleText->SetText(FText::FromString(ChallengeData.Title));
     
-    if (DescriptionText)
+    if (DescriptionText && (bFirstSetup || !Previous.Description.Equals(ChallengeData.Description, ESearchCase::CaseSensitive)))
         DescriptionText->SetText(FText::FromString(ChallengeData.Description));
     
-    if (XPRewardText)
+    if (XPRewardText && (bFirstSetup || Previous.XPReward != ChallengeData.XPReward))
         XPRewardText->SetText(FText::FromString(FString::Printf(TEXT("+%d XP"), ChallengeData.XPReward)));
 
-    SetDifficultyColor(ChallengeData.Difficulty);
-    SetCategoryIcon(ChallengeData.Category);
-    UpdateProgress(ChallengeData.CurrentProgress);
+    if (bFirstSetup || !Previous.Difficulty.Equals(ChallengeData.Difficulty, ESearchCase::IgnoreCase))
+        SetDifficultyColor(ChallengeData.Difficulty);
+
+    if (bFirstSetup || !Previous.Category.Equals(ChallengeData.Category, ESearchCase::IgnoreCase))
+        SetCategoryIcon(ChallengeData.Category);
+
+    const bool bProgressChanged = bFirstSetup
+        || Previous.CurrentProgress != ChallengeData.CurrentProgress
+        || Previous.Target != ChallengeData.Target;
+
+    AppliedChallenge = ChallengeData;
+    bHasAppliedChallenge = true;
+
+    if (bProgressChanged)
+        UpdateProgress(ChallengeData.CurrentProgress);
 }
 
 void UChallengeCardWidget::UpdateProgress(float NewProgress)
@@ -65,7 +87,7 @@ void UChallengeCardWidget::UpdateProgressDisplay(float CurrentProgress)
 {
     if (ProgressBar)
     {
-        float ProgressRatio = FMath::Clamp(CurrentProgress / TargetProgress, 0.0f, 1.0f);
+        float ProgressRatio = FMath::Clamp(CurrentProgress / FMath::Max(TargetProgress, 1), 0.0f, 1.0f);
         ProgressBar->SetPercent(ProgressRatio);
     }
 
@@ -37,6 +37,7 @@ public:
     UPROPERTY(BlueprintAssignable, Category = "Challenge")
     FOnChallengeProgressedSignature OnChallengeProgressed;
 
+    // Safe to call repeatedly on the same card, only fields that changed are touched
     UFUNCTION(BlueprintCallable, Category = "Challenge")
     void SetupChallenge(const FChallengeData& ChallengeData);
 
@@ -52,6 +53,10 @@ protected:
 private:
     FString ChallengeId;
     int32 TargetProgress;
+
+    // Last data pushed into the widgets, compared against on every SetupChallenge
+    FChallengeData AppliedChallenge;
+    bool bHasAppliedChallenge = false;
     
     UPROPERTY()
     TMap<FString, UTexture2D*> CategoryIcons;
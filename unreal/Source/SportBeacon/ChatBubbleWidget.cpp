@@ -22,6 +22,15 @@ void UChatBubbleWidget::NativeConstruct()
     {
         MetadataBox->SetVisibility(ESlateVisibility::Collapsed);
     }
+
+    // Construct runs again whenever a pooled bubble is re-added, put its style back over the defaults
+    if (AppliedStyle.IsSet())
+    {
+        const EChatBubbleStyle Style = AppliedStyle.GetValue();
+        AppliedStyle.Reset();
+        UpdateBubbleStyle(Style);
+        UpdateMetadataVisibility();
+    }
 }
 
 void UChatBubbleWidget::SetupBubble(const FString& Message, EChatBubbleStyle Style, const FChatMetadata& Metadata)
@@ -46,17 +55,18 @@ void UChatBubbleWidget::SetStyle(EChatBubbleStyle Style)
 
 void UChatBubbleWidget::SetMetadata(const FChatMetadata& Metadata)
 {
-    if (TagText && !Metadata.Tag.IsEmpty())
+    // Empty fields clear too, so a recycled bubble never shows its previous message's tags
+    if (TagText)
     {
         TagText->SetText(FText::FromString(Metadata.Tag));
     }
 
-    if (FocusText && !Metadata.Focus.IsEmpty())
+    if (FocusText)
     {
         FocusText->SetText(FText::FromString(Metadata.Focus));
     }
 
-    if (SourceText && !Metadata.Source.IsEmpty())
+    if (SourceText)
     {
         SourceText->SetText(FText::FromString(Metadata.Source));
     }
@@ -69,49 +79,51 @@ void UChatBubbleWidget::SetMetadata(const FChatMetadata& Metadata)
     UpdateMetadataVisibility();
 }
 
+const UChatBubbleWidget::FBubbleStyleParams& UChatBubbleWidget::GetStyleParams(EChatBubbleStyle Style)
+{
+    static const TArray<FBubbleStyleParams> StyleParams = []()
+    {
+        auto MakeParams = [](const FLinearColor& BorderColor, const FLinearColor& TextColor, float CornerRadius, const FMargin& Padding)
+        {
+            FBubbleStyleParams Params;
+            Params.Brush.DrawAs = ESlateBrushDrawType::Box;
+            Params.Brush.OutlineSettings.Width = 1.0f;
+            Params.Brush.Margin = FMargin(CornerRadius);
+            Params.Brush.TintColor = FSlateColor(BorderColor);
+            Params.TextColor = TextColor;
+            Params.Padding = Padding;
+            return Params;
+        };
+
+        // Indexed by EChatBubbleStyle
+        TArray<FBubbleStyleParams> Params;
+        Params.Add(MakeParams(FLinearColor(0.2f, 0.6f, 1.0f, 0.95f), FLinearColor::White, 16.0f, FMargin(12.0f, 8.0f, 16.0f, 8.0f))); // Blue
+        Params.Add(MakeParams(FLinearColor(0.2f, 0.8f, 0.2f, 0.95f), FLinearColor::White, 16.0f, FMargin(16.0f, 8.0f, 12.0f, 8.0f))); // Green
+        Params.Add(MakeParams(FLinearColor(0.5f, 0.5f, 0.5f, 0.95f), FLinearColor(0.8f, 0.8f, 0.8f, 1.0f), 8.0f, FMargin(12.0f, 4.0f))); // Gray
+        return Params;
+    }();
+
+    const int32 Index = static_cast<int32>(Style);
+    return StyleParams.IsValidIndex(Index) ? StyleParams[Index] : StyleParams[0];
+}
+
 void UChatBubbleWidget::UpdateBubbleStyle(EChatBubbleStyle Style)
 {
-    if (!MessageBorder)
+    if (!MessageBorder || (AppliedStyle.IsSet() && AppliedStyle.GetValue() == Style))
         return;
 
-    FLinearColor BorderColor;
-    FLinearColor TextColor = FLinearColor::White;
-    float CornerRadius = 16.0f;
+    const FBubbleStyleParams& Params = GetStyleParams(Style);
 
-    switch (Style)
-    {
-        case EChatBubbleStyle::Player:
-            BorderColor = FLinearColor(0.2f, 0.6f, 1.0f, 0.95f); // Blue
-            MessageBorder->SetPadding(FMargin(12.0f, 8.0f, 16.0f, 8.0f));
-            break;
-
-        case EChatBubbleStyle::Coach:
-            BorderColor = FLinearColor(0.2f, 0.8f, 0.2f, 0.95f); // Green
-            MessageBorder->SetPadding(FMargin(16.0f, 8.0f, 12.0f, 8.0f));
-            break;
-
-        case EChatBubbleStyle::System:
-            BorderColor = FLinearColor(0.5f, 0.5f, 0.5f, 0.95f); // Gray
-            TextColor = FLinearColor(0.8f, 0.8f, 0.8f, 1.0f);
-            CornerRadius = 8.0f;
-            MessageBorder->SetPadding(FMargin(12.0f, 4.0f));
-            break;
-    }
+    // The cached brush carries the border colour as its tint
+    MessageBorder->SetBrush(Params.Brush);
+    MessageBorder->SetPadding(Params.Padding);
 
-    // Apply styles
-    MessageBorder->SetBrushColor(BorderColor);
-    
     if (MessageText)
     {
-        MessageText->SetColorAndOpacity(FSlateColor(TextColor));
+        MessageText->SetColorAndOpacity(FSlateColor(Params.TextColor));
     }
 
-    // Update corner radius
-    FSlateBrush NewBrush;
-    NewBrush.DrawAs = ESlateBrushDrawType::Box;
-    NewBrush.OutlineSettings.Width = 1.0f;
-    NewBrush.Margin = FMargin(CornerRadius);
-    MessageBorder->SetBrush(NewBrush);
+    AppliedStyle = Style;
 }
 
 void UChatBubbleWidget::UpdateMetadataVisibility()
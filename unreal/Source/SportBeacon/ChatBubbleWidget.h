@@ -86,7 +86,20 @@ protected:
     virtual void NativeConstruct() override;
 
 private:
+    // Colours, padding and brush per style, built once and shared by every bubble
+    struct FBubbleStyleParams
+    {
+        FSlateBrush Brush;
+        FLinearColor TextColor;
+        FMargin Padding;
+    };
+
+    static const FBubbleStyleParams& GetStyleParams(EChatBubbleStyle Style);
+
     void UpdateBubbleStyle(EChatBubbleStyle Style);
     void UpdateMetadataVisibility();
     FString FormatTimestamp(const FDateTime& Timestamp);
+
+    // Pooled bubbles are restyled often, skip the brush swap when nothing changed
+    TOptional<EChatBubbleStyle> AppliedStyle;
 }; 
\ No newline at end of file
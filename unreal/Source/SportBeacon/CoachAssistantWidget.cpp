@@ -1,4 +1,5 @@
 #include "CoachAssistantWidget.h"
+#include "SportBeaconStats.h"
 #include "Components/TextBlock.h"
 #include "Components/Button.h"
 #include "Components/EditableTextBox.h"
@@ -8,11 +9,27 @@
 #include "Animation/WidgetAnimation.h"
 #include "Kismet/GameplayStatics.h"
 #include "Sound/SoundBase.h"
+#include "WebSocketsModule.h"
+#include "IWebSocket.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "TimerManager.h"
 
 const float UCoachAssistantWidget::MESSAGE_ANIMATION_DURATION = 0.3f;
 
 UCoachAssistantWidget::UCoachAssistantWidget(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
+    , MaxMessageHistory(10)
+    , MaxVisibleBubbles(20)
+    , StreamingBubble(nullptr)
+    , bIsStreamingResponse(false)
+    , bStreamingTextDirty(false)
+    , bDiscardingStreamedResponse(false)
+    , ResponseRequestTime(0.0)
+    , ResponseStartTime(0.0)
+    , bResponseSocketConnecting(false)
+    , AnimationStartTime(0.0)
     , bVoiceOutputEnabled(false)
     , VoiceVolume(1.0f)
 {
@@ -44,6 +61,29 @@ void UCoachAssistantWidget::NativeConstruct()
     UpdateSuggestedQuestions();
 }
 
+void UCoachAssistantWidget::NativeDestruct()
+{
+    CloseResponseStream();
+
+    if (UWorld* World = GetWorld())
+    {
+        World->GetTimerManager().ClearTimer(ResponseAnimationTimer);
+    }
+
+    Super::NativeDestruct();
+}
+
+void UCoachAssistantWidget::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
+{
+    Super::NativeTick(MyGeometry, InDeltaTime);
+
+    // Chunks arriving faster than the frame rate collapse into one text update
+    if (bStreamingTextDirty)
+    {
+        FlushStreamingText();
+    }
+}
+
 void UCoachAssistantWidget::AskQuestion(const FString& Question)
 {
     if (Question.IsEmpty())
@@ -61,8 +101,14 @@ void UCoachAssistantWidget::AskQuestion(const FString& Question)
     CreateMessageBubble(UserMessage);
 
     // Broadcast question event
+    ResponseRequestTime = FPlatformTime::Seconds();
     OnQuestionAsked.Broadcast(Question);
 
+    if (!ResponseStreamURL.IsEmpty())
+    {
+        SendStreamQuestion(Question);
+    }
+
     // Clear input
     if (QuestionInputBox)
     {
@@ -78,39 +124,122 @@ void UCoachAssistantWidget::AskQuestion(const FString& Question)
 
 void UCoachAssistantWidget::DisplayCoachResponse(const FString& Response, const TArray<FString>& RelatedStats)
 {
-    // Create and add coach message
-    FCoachMessage CoachMessage;
-    CoachMessage.Message = Response;
-    CoachMessage.bIsUserMessage = false;
-    CoachMessage.Timestamp = FDateTime::Now();
-    CoachMessage.RelatedStats = RelatedStats;
+    // A complete response is a stream with a single chunk
+    BeginStreamingResponse(RelatedStats);
+    AppendResponseChunk(Response);
+    EndStreamingResponse();
+}
+
+void UCoachAssistantWidget::BeginStreamingResponse(const TArray<FString>& RelatedStats)
+{
+    if (bIsStreamingResponse)
+    {
+        EndStreamingResponse();
+    }
+
+    StreamingMessage = FCoachMessage();
+    StreamingMessage.bIsUserMessage = false;
+    StreamingMessage.Timestamp = FDateTime::Now();
+    StreamingMessage.RelatedStats = RelatedStats;
+
+    StreamingMetrics = FCoachResponseMetrics();
+    ResponseStartTime = FPlatformTime::Seconds();
+    bIsStreamingResponse = true;
+    bStreamingTextDirty = false;
+
+    // The bubble goes up empty and only its text changes from here on
+    StreamingBubble = CreateMessageBubble(StreamingMessage);
+    if (StreamingBubble)
+    {
+        AnimateResponse(StreamingBubble);
+    }
+
+    if (ChatScrollBox)
+    {
+        ChatScrollBox->ScrollToEnd();
+    }
+}
+
+void UCoachAssistantWidget::AppendResponseChunk(const FString& Chunk)
+{
+    if (Chunk.IsEmpty())
+    {
+        return;
+    }
 
-    AddMessageToHistory(CoachMessage);
-    UWidget* MessageWidget = CreateMessageBubble(CoachMessage);
+    if (!bIsStreamingResponse)
+    {
+        BeginStreamingResponse(TArray<FString>());
+    }
 
-    // Animate the response
-    if (MessageWidget)
+    StreamingMessage.Message += Chunk;
+    ++StreamingMetrics.NumChunks;
+    bStreamingTextDirty = true;
+}
+
+void UCoachAssistantWidget::EndStreamingResponse()
+{
+    if (!bIsStreamingResponse)
     {
-        AnimateResponse(MessageWidget);
+        return;
     }
 
+    FlushStreamingText();
+
+    const double StartTime = ResponseRequestTime > 0.0 ? ResponseRequestTime : ResponseStartTime;
+    StreamingMetrics.TotalLatencyMs = static_cast<float>((FPlatformTime::Seconds() - StartTime) * 1000.0);
+    StreamingMetrics.NumCharacters = StreamingMessage.Message.Len();
+    LastResponseMetrics = StreamingMetrics;
+
+    bIsStreamingResponse = false;
+    ResponseRequestTime = 0.0;
+    StreamingBubble = nullptr;
+
+    AddMessageToHistory(StreamingMessage);
+
+    UE_LOG(LogTemp, Verbose, TEXT("Coach response: first token %.0f ms, total %.0f ms, %d chunks"),
+        LastResponseMetrics.TimeToFirstTokenMs, LastResponseMetrics.TotalLatencyMs, LastResponseMetrics.NumChunks);
+
     // Play voice response if enabled
     if (bVoiceOutputEnabled)
     {
-        PlayVoiceResponse(Response);
+        PlayVoiceResponse(StreamingMessage.Message);
     }
 
     // Broadcast response event
-    OnResponseReceived.Broadcast(Response);
+    OnResponseReceived.Broadcast(StreamingMessage.Message);
+    OnResponseMetrics.Broadcast(LastResponseMetrics);
 
-    // Auto-scroll to bottom
-    if (ChatScrollBox)
+    // Update suggested questions based on context
+    UpdateSuggestedQuestions();
+}
+
+void UCoachAssistantWidget::FlushStreamingText()
+{
+    SPORTBEACON_SCOPE_CYCLE(CoachStreaming);
+    bStreamingTextDirty = false;
+    if (!StreamingBubble)
     {
-        ChatScrollBox->ScrollToEnd();
+        return;
     }
 
-    // Update suggested questions based on context
-    UpdateSuggestedQuestions();
+    // Only follow the stream if the reader hasn't scrolled up
+    const bool bWasAtEnd = !ChatScrollBox
+        || ChatScrollBox->GetScrollOffset() >= ChatScrollBox->GetScrollOffsetOfEnd() - 1.0f;
+
+    StreamingBubble->SetMessage(StreamingMessage.Message);
+
+    // Measured here rather than on arrival, this is when the text actually reaches the screen
+    if (StreamingMetrics.TimeToFirstTokenMs <= 0.0f && !StreamingMessage.Message.IsEmpty())
+    {
+        const double StartTime = ResponseRequestTime > 0.0 ? ResponseRequestTime : ResponseStartTime;
+        StreamingMetrics.TimeToFirstTokenMs = static_cast<float>((FPlatformTime::Seconds() - StartTime) * 1000.0);
+    }
+
+    if (ChatScrollBox && bWasAtEnd)
+    {
+        ChatScrollBox->ScrollToEnd();
+    }
 }
 
 void UCoachAssistantWidget::UpdateWeeklyFocus(const TArray<FWeeklyFocusItem>& FocusItems)
@@ -213,99 +342,311 @@ void UCoachAssistantWidget::UpdateSuggestedQuestions()
 
 void UCoachAssistantWidget::AnimateResponse(UWidget* ResponseWidget)
 {
-    if (!ResponseWidget)
+    UWorld* World = GetWorld();
+    if (!ResponseWidget || !World)
     {
         return;
     }
 
+    // Only one bubble animates at a time, a new one snaps the previous to its end state
+    if (UWidget* Previous = AnimatingWidget.Get())
+    {
+        Previous->SetRenderOpacity(1.0f);
+        Previous->SetRenderScale(FVector2D(1.0f, 1.0f));
+    }
+
     // Set initial state
     ResponseWidget->SetRenderOpacity(0.0f);
     ResponseWidget->SetRenderScale(FVector2D(0.8f, 0.8f));
 
-    // Create animation timeline
-    FTimerHandle AnimationTimer;
-    float StartTime = GetWorld()->GetTimeSeconds();
+    AnimatingWidget = ResponseWidget;
+    AnimationStartTime = World->GetTimeSeconds();
+    World->GetTimerManager().SetTimer(ResponseAnimationTimer, this, &UCoachAssistantWidget::TickResponseAnimation, 0.016f, true);
+}
 
-    GetWorld()->GetTimerManager().SetTimer(AnimationTimer, [this, ResponseWidget, StartTime]()
+void UCoachAssistantWidget::TickResponseAnimation()
+{
+    UWorld* World = GetWorld();
+    UWidget* ResponseWidget = AnimatingWidget.Get();
+    if (!World || !ResponseWidget)
     {
-        float CurrentTime = GetWorld()->GetTimeSeconds();
-        float Alpha = FMath::Min((CurrentTime - StartTime) / MESSAGE_ANIMATION_DURATION, 1.0f);
+        if (World)
+        {
+            World->GetTimerManager().ClearTimer(ResponseAnimationTimer);
+        }
+        return;
+    }
 
-        // Ease-out function
-        Alpha = 1.0f - (1.0f - Alpha) * (1.0f - Alpha);
+    float Alpha = FMath::Min(static_cast<float>(World->GetTimeSeconds() - AnimationStartTime) / MESSAGE_ANIMATION_DURATION, 1.0f);
 
-        ResponseWidget->SetRenderOpacity(Alpha);
-        ResponseWidget->SetRenderScale(FVector2D(0.8f + (0.2f * Alpha)));
+    // Ease-out function
+    Alpha = 1.0f - (1.0f - Alpha) * (1.0f - Alpha);
 
-        if (Alpha >= 1.0f)
-        {
-            GetWorld()->GetTimerManager().ClearTimer(AnimationTimer);
-        }
-    }, 0.016f, true);
+    ResponseWidget->SetRenderOpacity(Alpha);
+    ResponseWidget->SetRenderScale(FVector2D(0.8f + (0.2f * Alpha)));
+
+    if (Alpha >= 1.0f)
+    {
+        World->GetTimerManager().ClearTimer(ResponseAnimationTimer);
+        AnimatingWidget.Reset();
+    }
 }
 
 void UCoachAssistantWidget::AddMessageToHistory(const FCoachMessage& Message)
 {
-    MessageHistory.Add(Message);
-    TrimMessageHistory();
+    // Sized lazily so edits to MaxMessageHistory take effect, keeping the newest messages
+    MessageHistory.Resize(FMath::Max(MaxMessageHistory, 1));
+    MessageHistory.Push(Message);
 }
 
-void UCoachAssistantWidget::TrimMessageHistory()
+TArray<FCoachMessage> UCoachAssistantWidget::GetMessageHistory() const
 {
-    while (MessageHistory.Num() > MAX_MESSAGE_HISTORY)
+    TArray<FCoachMessage> Messages;
+    Messages.Reserve(MessageHistory.Num());
+    for (const FCoachMessage& Message : MessageHistory)
     {
-        MessageHistory.RemoveAt(0);
+        Messages.Add(Message);
     }
+    return Messages;
 }
 
-UWidget* UCoachAssistantWidget::CreateMessageBubble(const FCoachMessage& Message)
+UChatBubbleWidget* UCoachAssistantWidget::CreateMessageBubble(const FCoachMessage& Message)
 {
+    SPORTBEACON_SCOPE_CYCLE(CoachingMessages);
+
     if (!ChatScrollBox)
     {
         return nullptr;
     }
 
-    // Create message container
-    UBorder* MessageBorder = NewObject<UBorder>(ChatScrollBox);
-    MessageBorder->SetPadding(FMargin(10.0f));
-    
-    // Style based on message type
-    if (Message.bIsUserMessage)
+    UChatBubbleWidget* Bubble = AcquireBubble();
+    if (!Bubble)
+    {
+        return nullptr;
+    }
+
+    FChatMetadata Metadata;
+    Metadata.Tag = FString::Join(Message.RelatedStats, TEXT("  "));
+    Metadata.Timestamp = Message.Timestamp;
+
+    // A recycled bubble may still carry the end state of its last animation
+    Bubble->SetRenderOpacity(1.0f);
+    Bubble->SetRenderScale(FVector2D(1.0f, 1.0f));
+    Bubble->SetupBubble(Message.Message, Message.bIsUserMessage ? EChatBubbleStyle::Player : EChatBubbleStyle::Coach, Metadata);
+
+    ChatScrollBox->AddChild(Bubble);
+    ActiveBubbles.Add(Bubble);
+
+    return Bubble;
+}
+
+UChatBubbleWidget* UCoachAssistantWidget::AcquireBubble()
+{
+    // Past the cap the oldest bubble scrolls off and becomes the new one
+    if (ActiveBubbles.Num() >= FMath::Max(MaxVisibleBubbles, 1))
     {
-        MessageBorder->SetBrushColor(FLinearColor(0.1f, 0.1f, 0.1f));
-        MessageBorder->SetPadding(FMargin(50.0f, 5.0f, 10.0f, 5.0f));
+        UChatBubbleWidget* Oldest = ActiveBubbles[0];
+        ActiveBubbles.RemoveAt(0, 1, false);
+        if (Oldest)
+        {
+            // A response still streaming into it keeps its text but loses its bubble
+            if (Oldest == StreamingBubble)
+            {
+                StreamingBubble = nullptr;
+            }
+            Oldest->RemoveFromParent();
+            return Oldest;
+        }
     }
-    else
+
+    if (BubblePool.Num() > 0)
     {
-        MessageBorder->SetBrushColor(FLinearColor(0.2f, 0.2f, 0.3f));
-        MessageBorder->SetPadding(FMargin(10.0f, 5.0f, 50.0f, 5.0f));
+        return BubblePool.Pop(false);
     }
 
-    // Create message content
-    UVerticalBox* ContentBox = NewObject<UVerticalBox>(MessageBorder);
-    
-    // Add message text
-    UTextBlock* MessageText = NewObject<UTextBlock>(ContentBox);
-    MessageText->SetText(FText::FromString(Message.Message));
-    ContentBox->AddChild(MessageText);
+    if (!ChatBubbleClass)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("CoachAssistantWidget has no ChatBubbleClass set, messages will not be shown"));
+        return nullptr;
+    }
+
+    return CreateWidget<UChatBubbleWidget>(this, ChatBubbleClass);
+}
+
+void UCoachAssistantWidget::ReleaseBubble(UChatBubbleWidget* Bubble)
+{
+    if (Bubble)
+    {
+        Bubble->RemoveFromParent();
+        BubblePool.Add(Bubble);
+    }
+}
+
+void UCoachAssistantWidget::ClearConversation()
+{
+    // The streaming bubble goes back to the pool below, so nothing may write to it afterwards
+    if (bIsStreamingResponse)
+    {
+        bDiscardingStreamedResponse = ResponseSocket.IsValid();
+        bIsStreamingResponse = false;
+        bStreamingTextDirty = false;
+        ResponseRequestTime = 0.0;
+    }
+    StreamingBubble = nullptr;
+
+    for (UChatBubbleWidget* Bubble : ActiveBubbles)
+    {
+        ReleaseBubble(Bubble);
+    }
+    ActiveBubbles.Reset();
+    MessageHistory.Reset();
+}
+
+void UCoachAssistantWidget::SendStreamQuestion(const FString& Question)
+{
+    TSharedRef<FJsonObject> Request = MakeShared<FJsonObject>();
+    Request->SetStringField(TEXT("type"), TEXT("ask"));
+    Request->SetStringField(TEXT("question"), Question);
+
+    FString RequestString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&RequestString);
+    FJsonSerializer::Serialize(Request, Writer);
+
+    if (ResponseSocket && ResponseSocket->IsConnected())
+    {
+        ResponseSocket->Send(RequestString);
+        return;
+    }
+
+    // Sent once the connection is up
+    QueuedStreamQuestions.Add(MoveTemp(RequestString));
+    ConnectResponseStream();
+}
 
-    // Add related stats if any
-    if (!Message.RelatedStats.IsEmpty())
+void UCoachAssistantWidget::ConnectResponseStream()
+{
+    if (ResponseSocket)
     {
-        UHorizontalBox* StatsBox = NewObject<UHorizontalBox>(ContentBox);
-        for (const FString& Stat : Message.RelatedStats)
+        // Questions asked while the handshake runs just wait in the queue
+        if (!ResponseSocket->IsConnected() && !bResponseSocketConnecting)
         {
-            UTextBlock* StatText = NewObject<UTextBlock>(StatsBox);
-            StatText->SetText(FText::FromString(Stat));
-            StatsBox->AddChild(StatText);
+            bResponseSocketConnecting = true;
+            ResponseSocket->Connect();
         }
-        ContentBox->AddChild(StatsBox);
+        return;
     }
 
-    MessageBorder->SetContent(ContentBox);
-    ChatScrollBox->AddChild(MessageBorder);
+    if (!FModuleManager::Get().IsModuleLoaded(TEXT("WebSockets")))
+    {
+        FModuleManager::Get().LoadModule(TEXT("WebSockets"));
+    }
 
-    return MessageBorder;
+    ResponseSocket = FWebSocketsModule::Get().CreateWebSocket(ResponseStreamURL);
+    ResponseSocket->OnConnected().AddUObject(this, &UCoachAssistantWidget::OnResponseStreamConnected);
+    ResponseSocket->OnMessage().AddUObject(this, &UCoachAssistantWidget::OnResponseStreamMessage);
+    ResponseSocket->OnConnectionError().AddUObject(this, &UCoachAssistantWidget::OnResponseStreamError);
+    ResponseSocket->OnClosed().AddUObject(this, &UCoachAssistantWidget::OnResponseStreamClosed);
+    bResponseSocketConnecting = true;
+    ResponseSocket->Connect();
+}
+
+void UCoachAssistantWidget::CloseResponseStream()
+{
+    if (ResponseSocket)
+    {
+        ResponseSocket->OnConnected().RemoveAll(this);
+        ResponseSocket->OnMessage().RemoveAll(this);
+        ResponseSocket->OnConnectionError().RemoveAll(this);
+        ResponseSocket->OnClosed().RemoveAll(this);
+        if (ResponseSocket->IsConnected())
+        {
+            ResponseSocket->Close();
+        }
+        ResponseSocket.Reset();
+    }
+    bResponseSocketConnecting = false;
+    QueuedStreamQuestions.Reset();
+}
+
+void UCoachAssistantWidget::OnResponseStreamConnected()
+{
+    bResponseSocketConnecting = false;
+    for (const FString& Request : QueuedStreamQuestions)
+    {
+        ResponseSocket->Send(Request);
+    }
+    QueuedStreamQuestions.Reset();
+}
+
+void UCoachAssistantWidget::OnResponseStreamMessage(const FString& Message)
+{
+    TSharedPtr<FJsonObject> JsonMessage;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Message);
+
+    if (!FJsonSerializer::Deserialize(Reader, JsonMessage) || !JsonMessage.IsValid())
+    {
+        return;
+    }
+
+    const FString MessageType = JsonMessage->GetStringField(TEXT("type"));
+
+    // Tail of a response whose conversation was cleared
+    if (bDiscardingStreamedResponse && MessageType != TEXT("start"))
+    {
+        if (MessageType == TEXT("done") || MessageType == TEXT("error"))
+        {
+            bDiscardingStreamedResponse = false;
+        }
+        return;
+    }
+    bDiscardingStreamedResponse = false;
+
+    if (MessageType == TEXT("start"))
+    {
+        TArray<FString> RelatedStats;
+        JsonMessage->TryGetStringArrayField(TEXT("related_stats"), RelatedStats);
+        BeginStreamingResponse(RelatedStats);
+    }
+    else if (MessageType == TEXT("token"))
+    {
+        AppendResponseChunk(JsonMessage->GetStringField(TEXT("text")));
+    }
+    else if (MessageType == TEXT("done"))
+    {
+        EndStreamingResponse();
+    }
+    else if (MessageType == TEXT("error"))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Coach response stream error: %s"), *JsonMessage->GetStringField(TEXT("message")));
+        EndStreamingResponse();
+    }
+}
+
+void UCoachAssistantWidget::OnResponseStreamError(const FString& Error)
+{
+    UE_LOG(LogTemp, Warning, TEXT("Coach response stream connection failed: %s"), *Error);
+    bResponseSocketConnecting = false;
+
+    // Keep what arrived, the next question reconnects
+    bDiscardingStreamedResponse = false;
+    EndStreamingResponse();
+    QueuedStreamQuestions.Reset();
+}
+
+void UCoachAssistantWidget::OnResponseStreamClosed(int32 StatusCode, const FString& Reason, bool bWasClean)
+{
+    UE_LOG(LogTemp, Log, TEXT("Coach response stream closed (%d): %s"), StatusCode, *Reason);
+    bResponseSocketConnecting = false;
+
+    // Whatever arrived of an unfinished response is kept, the rest is never coming
+    bDiscardingStreamedResponse = false;
+    EndStreamingResponse();
+
+    // Questions asked while the socket was going down still get sent
+    if (QueuedStreamQuestions.Num() > 0)
+    {
+        ConnectResponseStream();
+    }
 }
 
 void UCoachAssistantWidget::PlayVoiceResponse(const FString& Text)
@@ -13,6 +13,8 @@
 #include "Components/WidgetSwitcher.h"
 #include "Components/CarouselNavigator.h"
 #include "Sound/SoundBase.h"
+#include "FixedRingBuffer.h"
+#include "ChatBubbleWidget.h"
 #include "CoachAssistantWidget.generated.h"
 
 USTRUCT(BlueprintType)
@@ -54,8 +56,31 @@ struct FWeeklyFocusItem
     float Priority;
 };
 
+USTRUCT(BlueprintType)
+struct FCoachResponseMetrics
+{
+    GENERATED_BODY()
+
+    // From the question going out, or the response starting if nothing was sent, to the first visible text
+    UPROPERTY(BlueprintReadOnly, Category = "Coach Assistant")
+    float TimeToFirstTokenMs = 0.0f;
+
+    // Same start point to the end of the response
+    UPROPERTY(BlueprintReadOnly, Category = "Coach Assistant")
+    float TotalLatencyMs = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Coach Assistant")
+    int32 NumChunks = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Coach Assistant")
+    int32 NumCharacters = 0;
+};
+
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnCoachQuestionAsked, const FString&, Question);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnCoachResponseReceived, const FString&, Response);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnCoachResponseMetrics, const FCoachResponseMetrics&, Metrics);
+
+class IWebSocket;
 
 UCLASS()
 class SPORTBEACON_API UCoachAssistantWidget : public UUserWidget
@@ -66,6 +91,8 @@ public:
     UCoachAssistantWidget(const FObjectInitializer& ObjectInitializer);
 
     virtual void NativeConstruct() override;
+    virtual void NativeDestruct() override;
+    virtual void NativeTick(const FGeometry& MyGeometry, float InDeltaTime) override;
 
     // Main Interface Functions
     UFUNCTION(BlueprintCallable, Category = "Coach Assistant")
@@ -74,6 +101,24 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Coach Assistant")
     void DisplayCoachResponse(const FString& Response, const TArray<FString>& RelatedStats = TArray<FString>());
 
+    // Streaming responses: one bubble is opened by Begin, grows with each chunk and is
+    // committed to the history by End. Text is pushed to the bubble at most once a frame.
+    UFUNCTION(BlueprintCallable, Category = "Coach Assistant|Streaming")
+    void BeginStreamingResponse(const TArray<FString>& RelatedStats);
+
+    // Starts a response implicitly if none is open
+    UFUNCTION(BlueprintCallable, Category = "Coach Assistant|Streaming")
+    void AppendResponseChunk(const FString& Chunk);
+
+    UFUNCTION(BlueprintCallable, Category = "Coach Assistant|Streaming")
+    void EndStreamingResponse();
+
+    UFUNCTION(BlueprintPure, Category = "Coach Assistant|Streaming")
+    bool IsStreamingResponse() const { return bIsStreamingResponse; }
+
+    UFUNCTION(BlueprintPure, Category = "Coach Assistant|Streaming")
+    FCoachResponseMetrics GetLastResponseMetrics() const { return LastResponseMetrics; }
+
     UFUNCTION(BlueprintCallable, Category = "Coach Assistant")
     void UpdateWeeklyFocus(const TArray<FWeeklyFocusItem>& FocusItems);
 
@@ -90,6 +135,18 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Coach Assistant")
     void SetVoiceVolume(float Volume);
 
+    // Oldest first
+    UFUNCTION(BlueprintPure, Category = "Coach Assistant")
+    TArray<FCoachMessage> GetMessageHistory() const;
+
+    // Drops the history and returns every bubble to the pool
+    UFUNCTION(BlueprintCallable, Category = "Coach Assistant")
+    void ClearConversation();
+
+    // Messages kept in memory, the oldest is overwritten once full
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Coach Assistant")
+    int32 MaxMessageHistory;
+
 protected:
     // UI Components
     UPROPERTY(BlueprintReadWrite, meta = (BindWidget))
@@ -110,6 +167,14 @@ protected:
     UPROPERTY(BlueprintReadWrite, meta = (BindWidget))
     UVerticalBox* SuggestedQuestionsBox;
 
+    // Bubble template for chat messages, instances are pooled and reused
+    UPROPERTY(EditDefaultsOnly, Category = "Chat")
+    TSubclassOf<UChatBubbleWidget> ChatBubbleClass;
+
+    // Bubbles kept in the scroll box, the oldest is recycled for each new message past this
+    UPROPERTY(EditAnywhere, Category = "Chat")
+    int32 MaxVisibleBubbles;
+
     // Voice Components
     UPROPERTY(EditDefaultsOnly, Category = "Voice")
     USoundBase* MessageSound;
@@ -124,9 +189,48 @@ protected:
     UPROPERTY(BlueprintAssignable, Category = "Coach Assistant")
     FOnCoachResponseReceived OnResponseReceived;
 
+    UPROPERTY(BlueprintAssignable, Category = "Coach Assistant|Streaming")
+    FOnCoachResponseMetrics OnResponseMetrics;
+
+    // When set, questions are also sent over this websocket and its start/token/done
+    // messages drive the streaming API
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Coach Assistant|Streaming")
+    FString ResponseStreamURL;
+
 private:
     // Chat Management
-    TArray<FCoachMessage> MessageHistory;
+    TFixedRingBuffer<FCoachMessage> MessageHistory;
+
+    // Bubbles in the scroll box, oldest first
+    UPROPERTY()
+    TArray<UChatBubbleWidget*> ActiveBubbles;
+
+    UPROPERTY()
+    TArray<UChatBubbleWidget*> BubblePool;
+
+    // Response being streamed into StreamingBubble
+    UPROPERTY()
+    UChatBubbleWidget* StreamingBubble;
+
+    FCoachMessage StreamingMessage;
+    bool bIsStreamingResponse;
+    bool bStreamingTextDirty;
+    // The conversation was cleared mid-stream, the rest of that response is ignored
+    bool bDiscardingStreamedResponse;
+    FCoachResponseMetrics StreamingMetrics;
+    FCoachResponseMetrics LastResponseMetrics;
+    // FPlatformTime seconds, zero when unset
+    double ResponseRequestTime;
+    double ResponseStartTime;
+
+    TSharedPtr<IWebSocket> ResponseSocket;
+    // Connect() was called and neither OnConnected nor an error has come back yet
+    bool bResponseSocketConnecting;
+    TArray<FString> QueuedStreamQuestions;
+
+    TWeakObjectPtr<UWidget> AnimatingWidget;
+    FTimerHandle ResponseAnimationTimer;
+    double AnimationStartTime;
     bool bVoiceOutputEnabled;
     float VoiceVolume;
 
@@ -143,10 +247,23 @@ private:
     UFUNCTION()
     void AnimateResponse(UWidget* ResponseWidget);
 
+    void TickResponseAnimation();
+    void FlushStreamingText();
+
+    // Response stream transport
+    void SendStreamQuestion(const FString& Question);
+    void ConnectResponseStream();
+    void CloseResponseStream();
+    void OnResponseStreamConnected();
+    void OnResponseStreamMessage(const FString& Message);
+    void OnResponseStreamError(const FString& Error);
+    void OnResponseStreamClosed(int32 StatusCode, const FString& Reason, bool bWasClean);
+
     // Message History Management
     void AddMessageToHistory(const FCoachMessage& Message);
-    void TrimMessageHistory();
-    void CreateMessageBubble(const FCoachMessage& Message);
+    UChatBubbleWidget* CreateMessageBubble(const FCoachMessage& Message);
+    UChatBubbleWidget* AcquireBubble();
+    void ReleaseBubble(UChatBubbleWidget* Bubble);
 
     // Voice Output
     void PlayVoiceResponse(const FString& Text);
@@ -157,6 +274,5 @@ private:
     void UpdateFocusCarousel();
 
     // Constants
-    static const int32 MAX_MESSAGE_HISTORY = 10;
     static const float MESSAGE_ANIMATION_DURATION;
 }; 
\ No newline at end of file
@@ -1,14 +1,24 @@
 #include "CoachingFlowWidget.h"
-#include "JsonObjectConverter.h"
+#include "SportBeaconStats.h"
+#include "MapView.h"
+#include "CoachingJournal.h"
+#include "VoiceInputManager.h"
 #include "Kismet/GameplayStatics.h"
-#include "Serialization/JsonSerializer.h"
-#include "Misc/FileHelper.h"
-#include "HAL/PlatformFilemanager.h"
+#include "Misc/Paths.h"
 
 UCoachingFlowWidget::UCoachingFlowWidget(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
+    , MapView(nullptr)
+    , NearbyVenueRadiusKm(10.0f)
+    , MaxSuggestedVenues(3)
+    , MaxMessageHistory(100)
+    , MaxRestoredMessages(50)
+    , MaxJournalMessages(200)
+    , JournalCompactionInterval(100)
     , CurrentState(ECoachingFlowState::Initial)
     , bIsVoiceInputActive(false)
+    , VoiceInput(nullptr)
+    , LoadGeneration(0)
 {
 }
 
@@ -32,15 +42,40 @@ void UCoachingFlowWidget::NativeConstruct()
         MessageInputBox->OnTextCommitted.AddDynamic(this, &UCoachingFlowWidget::OnMessageInputCommitted);
     }
 
+    if (!VoiceInput)
+    {
+        VoiceInput = NewObject<UVoiceInputManager>(this);
+        VoiceInput->OnSpeechRecognized.AddDynamic(this, &UCoachingFlowWidget::OnSpeechRecognized);
+    }
+    // Encoder and socket only, the microphone opens on the first voice input
+    VoiceInput->PrewarmSession();
+
     // Load previous conversation state if available
     LoadConversationState();
 }
 
+void UCoachingFlowWidget::NativeDestruct()
+{
+    if (VoiceInput)
+    {
+        VoiceInput->StopRecording();
+        VoiceInput->EndSession();
+    }
+    bIsVoiceInputActive = false;
+
+    Super::NativeDestruct();
+}
+
 void UCoachingFlowWidget::StartCoachingFlow()
 {
-    // Clear previous state
-    MessageHistory.Empty();
+    // Clear previous state, including any restore still on its way
+    ++LoadGeneration;
+    MessageHistory.Reset();
     CurrentState = ECoachingFlowState::Initial;
+    if (Journal)
+    {
+        Journal->Reset();
+    }
 
     // Send welcome message
     FCoachingMessage WelcomeMessage;
@@ -104,7 +139,7 @@ void UCoachingFlowWidget::ProcessUserInput(const FString& Input)
             break;
 
         case ECoachingFlowState::MealPlan:
-            Response.MessageText = TEXT("I've found some nearby facilities where you can practice these drills. Would you like to see the locations?");
+            Response.MessageText = BuildLocationSuggestionText();
             UpdateFlowState(ECoachingFlowState::LocationSuggestion);
             break;
 
@@ -119,12 +154,23 @@ void UCoachingFlowWidget::ProcessUserInput(const FString& Input)
     }
 
     AddMessageToUI(Response);
-    SaveConversationState();
 }
 
 void UCoachingFlowWidget::AddMessageToUI(const FCoachingMessage& Message)
 {
-    MessageHistory.Add(Message);
+    if (Journal)
+    {
+        Journal->AppendMessage(Message);
+    }
+
+    DisplayMessage(Message);
+}
+
+void UCoachingFlowWidget::DisplayMessage(const FCoachingMessage& Message)
+{
+    SPORTBEACON_SCOPE_CYCLE(CoachingMessages);
+    MessageHistory.Resize(FMath::Max(MaxMessageHistory, 1));
+    MessageHistory.Push(Message);
     OnMessageReceived.Broadcast(Message);
 
     // Display media if present
@@ -172,78 +218,62 @@ void UCoachingFlowWidget::UpdateFlowState(ECoachingFlowState NewState)
 {
     CurrentState = NewState;
     OnFlowStateChanged.Broadcast(NewState);
+
+    if (Journal)
+    {
+        Journal->AppendFlowState(static_cast<int32>(NewState));
+    }
 }
 
-void UCoachingFlowWidget::SaveConversationState()
+void UCoachingFlowWidget::LoadConversationState()
 {
-    // Convert message history to JSON
-    TArray<TSharedPtr<FJsonValue>> MessageArray;
-    for (const FCoachingMessage& Message : MessageHistory)
+    if (!Journal)
     {
-        TSharedPtr<FJsonObject> MessageObj = MakeShared<FJsonObject>();
-        MessageObj->SetStringField(TEXT("SenderName"), Message.SenderName);
-        MessageObj->SetStringField(TEXT("MessageText"), Message.MessageText);
-        MessageObj->SetStringField(TEXT("MediaURL"), Message.MediaURL);
-        MessageObj->SetBoolField(TEXT("bIsCoach"), Message.bIsCoach);
-        MessageObj->SetStringField(TEXT("Timestamp"), Message.Timestamp.ToString());
-
-        MessageArray.Add(MakeShared<FJsonValueObject>(MessageObj));
+        const FString JournalPath = FPaths::ProjectSavedDir() / TEXT("CoachingFlow.journal");
+        Journal = MakeShared<FCoachingJournal>(JournalPath, MaxJournalMessages, JournalCompactionInterval);
     }
 
-    TSharedPtr<FJsonObject> SaveData = MakeShared<FJsonObject>();
-    SaveData->SetArrayField(TEXT("Messages"), MessageArray);
-    SaveData->SetNumberField(TEXT("CurrentState"), static_cast<int32>(CurrentState));
+    TWeakObjectPtr<UCoachingFlowWidget> WeakThis(this);
+    const uint32 Generation = ++LoadGeneration;
+    Journal->LoadTailAsync(MaxRestoredMessages, [WeakThis, Generation](FCoachingJournal::FLoadResult&& Result)
+    {
+        UCoachingFlowWidget* Widget = WeakThis.Get();
+        if (!Widget || Widget->LoadGeneration != Generation)
+        {
+            return;
+        }
 
-    FString SaveString;
-    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&SaveString);
-    FJsonSerializer::Serialize(SaveData.ToSharedRef(), Writer);
+        // Already on disk, so these only go to the UI
+        for (const FCoachingMessage& Message : Result.Messages)
+        {
+            Widget->DisplayMessage(Message);
+        }
 
-    // Save to file
-    FString SavePath = FPaths::ProjectSavedDir() / TEXT("CoachingFlow.json");
-    FFileHelper::SaveStringToFile(SaveString, *SavePath);
+        if (Result.FlowState != INDEX_NONE)
+        {
+            Widget->CurrentState = static_cast<ECoachingFlowState>(Result.FlowState);
+            Widget->OnFlowStateChanged.Broadcast(Widget->CurrentState);
+        }
+    });
 }
 
-void UCoachingFlowWidget::LoadConversationState()
+TArray<FCoachingMessage> UCoachingFlowWidget::GetMessageHistory() const
 {
-    FString LoadPath = FPaths::ProjectSavedDir() / TEXT("CoachingFlow.json");
-    FString JsonString;
-    
-    if (FFileHelper::LoadFileToString(JsonString, *LoadPath))
+    TArray<FCoachingMessage> Messages;
+    Messages.Reserve(MessageHistory.Num());
+    for (const FCoachingMessage& Message : MessageHistory)
     {
-        TSharedPtr<FJsonObject> SaveData;
-        TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
-        
-        if (FJsonSerializer::Deserialize(Reader, SaveData))
-        {
-            // Load messages
-            const TArray<TSharedPtr<FJsonValue>>& MessageArray = SaveData->GetArrayField(TEXT("Messages"));
-            for (const auto& MessageValue : MessageArray)
-            {
-                const TSharedPtr<FJsonObject>& MessageObj = MessageValue->AsObject();
-                
-                FCoachingMessage Message;
-                Message.SenderName = MessageObj->GetStringField(TEXT("SenderName"));
-                Message.MessageText = MessageObj->GetStringField(TEXT("MessageText"));
-                Message.MediaURL = MessageObj->GetStringField(TEXT("MediaURL"));
-                Message.bIsCoach = MessageObj->GetBoolField(TEXT("bIsCoach"));
-                FDateTime::Parse(MessageObj->GetStringField(TEXT("Timestamp")), Message.Timestamp);
-
-                AddMessageToUI(Message);
-            }
-
-            // Load state
-            CurrentState = static_cast<ECoachingFlowState>(SaveData->GetIntegerField(TEXT("CurrentState")));
-            OnFlowStateChanged.Broadcast(CurrentState);
-        }
+        Messages.Add(Message);
     }
+    return Messages;
 }
 
 void UCoachingFlowWidget::StartVoiceInput()
 {
-    if (!bIsVoiceInputActive)
+    if (!bIsVoiceInputActive && VoiceInput)
     {
         bIsVoiceInputActive = true;
-        // TODO: Initialize voice input system
+        VoiceInput->StartRecording();
     }
 }
 
@@ -252,7 +282,11 @@ void UCoachingFlowWidget::StopVoiceInput()
     if (bIsVoiceInputActive)
     {
         bIsVoiceInputActive = false;
-        // TODO: Stop voice input system and process results
+        // Results arrive through OnSpeechRecognized
+        if (VoiceInput)
+        {
+            VoiceInput->StopRecording();
+        }
     }
 }
 
@@ -284,6 +318,11 @@ void UCoachingFlowWidget::OnMessageInputCommitted(const FText& Text, ETextCommit
     }
 }
 
+void UCoachingFlowWidget::OnSpeechRecognized(const FString& RecognizedText)
+{
+    SendMessage(RecognizedText);
+}
+
 void UCoachingFlowWidget::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
 {
     Super::NativeTick(MyGeometry, InDeltaTime);
@@ -293,4 +332,25 @@ void UCoachingFlowWidget::NativeTick(const FGeometry& MyGeometry, float InDeltaT
     {
         // TODO: Update voice input visualization
     }
-} 
\ No newline at end of file
+} 
+
+FString UCoachingFlowWidget::BuildLocationSuggestionText() const
+{
+    const FString DefaultText = TEXT("I've found some nearby facilities where you can practice these drills. Would you like to see the locations?");
+
+    TArray<FVenueData> NearbyVenues;
+    if (!MapView || !MapView->GetVenuesNearPlayer(PlayerId, NearbyVenueRadiusKm, NearbyVenues) || NearbyVenues.Num() == 0)
+    {
+        return DefaultText;
+    }
+
+    // Venues come back nearest first
+    TArray<FString> VenueNames;
+    for (int32 Index = 0; Index < FMath::Min(NearbyVenues.Num(), MaxSuggestedVenues); ++Index)
+    {
+        VenueNames.Add(NearbyVenues[Index].Name);
+    }
+
+    return FString::Printf(TEXT("I've found some nearby facilities where you can practice these drills: %s. Would you like to see the locations?"),
+        *FString::Join(VenueNames, TEXT(", ")));
+}
@@ -8,8 +8,13 @@
 #include "Components/Button.h"
 #include "MediaPlayerWidget.h"
 #include "ImageDisplayWidget.h"
+#include "FixedRingBuffer.h"
 #include "CoachingFlowWidget.generated.h"
 
+class AMapView;
+class FCoachingJournal;
+class UVoiceInputManager;
+
 UENUM(BlueprintType)
 enum class ECoachingFlowState : uint8
 {
@@ -95,6 +100,39 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Coaching Flow")
     void StopVoiceInput();
 
+    // Oldest first, at most MaxMessageHistory messages
+    UFUNCTION(BlueprintPure, Category = "Coaching Flow")
+    TArray<FCoachingMessage> GetMessageHistory() const;
+
+    // Map used to find facilities near the player for LocationSuggestion
+    UPROPERTY(BlueprintReadWrite, Category = "Coaching Flow|Location")
+    AMapView* MapView;
+
+    UPROPERTY(BlueprintReadWrite, Category = "Coaching Flow|Location")
+    FString PlayerId;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Coaching Flow|Location")
+    float NearbyVenueRadiusKm;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Coaching Flow|Location")
+    int32 MaxSuggestedVenues;
+
+    // Messages kept in memory, the journal keeps the rest
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Coaching Flow|Persistence")
+    int32 MaxMessageHistory;
+
+    // Messages restored into the UI at startup, older ones stay in the journal only
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Coaching Flow|Persistence")
+    int32 MaxRestoredMessages;
+
+    // Messages kept when the journal is compacted
+    UPROPERTY(EditAnywhere, Category = "Coaching Flow|Persistence")
+    int32 MaxJournalMessages;
+
+    // Records appended between compactions
+    UPROPERTY(EditAnywhere, Category = "Coaching Flow|Persistence")
+    int32 JournalCompactionInterval;
+
     // State Management
     UPROPERTY(BlueprintAssignable, Category = "Coaching Flow|Events")
     FOnFlowStateChangedSignature OnFlowStateChanged;
@@ -104,14 +142,26 @@ public:
 
 protected:
     virtual void NativeConstruct() override;
+    virtual void NativeDestruct() override;
     virtual void NativeTick(const FGeometry& MyGeometry, float InDeltaTime) override;
 
 private:
     // Internal state
     ECoachingFlowState CurrentState;
-    TArray<FCoachingMessage> MessageHistory;
+    TFixedRingBuffer<FCoachingMessage> MessageHistory;
     bool bIsVoiceInputActive;
 
+    // Its session is pre-warmed at construct so push-to-talk doesn't wait on the handshake
+    UPROPERTY()
+    UVoiceInputManager* VoiceInput;
+
+    // Written incrementally on a background pipe. Destroying it waits for queued
+    // writes, so they still reach disk after the widget is gone.
+    TSharedPtr<FCoachingJournal> Journal;
+
+    // Bumped whenever the conversation restarts, so a restore that lands afterwards is dropped
+    uint32 LoadGeneration;
+
     // UI Event handlers
     UFUNCTION()
     void OnSendMessageClicked();
@@ -122,12 +172,16 @@ private:
     UFUNCTION()
     void OnMessageInputCommitted(const FText& Text, ETextCommit::Type CommitMethod);
 
+    UFUNCTION()
+    void OnSpeechRecognized(const FString& RecognizedText);
+
     // Helper functions
     void AddMessageToUI(const FCoachingMessage& Message);
+    void DisplayMessage(const FCoachingMessage& Message);
     void UpdateFlowState(ECoachingFlowState NewState);
     void ProcessUserInput(const FString& Input);
-    void SaveConversationState();
     void LoadConversationState();
+    FString BuildLocationSuggestionText() const;
     
     // Media handling
     void DisplayMedia(const FString& URL, bool bIsVideo);
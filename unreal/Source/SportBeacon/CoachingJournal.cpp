@@ -0,0 +1,330 @@
+#include "CoachingJournal.h"
+#include "CoachingFlowWidget.h"
+#include "Async/Async.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonSerializer.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+
+namespace
+{
+    const TCHAR* MessageRecordType = TEXT("message");
+    const TCHAR* StateRecordType = TEXT("state");
+
+    enum class ECoachingRecord : uint8
+    {
+        Invalid,
+        Message,
+        FlowState
+    };
+
+    FString SerializeRecord(const TSharedRef<FJsonObject>& Record)
+    {
+        FString Line;
+        TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer =
+            TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Line);
+        FJsonSerializer::Serialize(Record, Writer);
+        Line.AppendChar(TEXT('\n'));
+        return Line;
+    }
+
+    FString MakeMessageRecord(const FCoachingMessage& Message)
+    {
+        TSharedRef<FJsonObject> Record = MakeShared<FJsonObject>();
+        Record->SetStringField(TEXT("Type"), MessageRecordType);
+        Record->SetStringField(TEXT("SenderName"), Message.SenderName);
+        Record->SetStringField(TEXT("MessageText"), Message.MessageText);
+        Record->SetStringField(TEXT("MediaURL"), Message.MediaURL);
+        Record->SetBoolField(TEXT("bIsCoach"), Message.bIsCoach);
+        Record->SetStringField(TEXT("Timestamp"), Message.Timestamp.ToString());
+        return SerializeRecord(Record);
+    }
+
+    FString MakeStateRecord(int32 FlowState)
+    {
+        TSharedRef<FJsonObject> Record = MakeShared<FJsonObject>();
+        Record->SetStringField(TEXT("Type"), StateRecordType);
+        Record->SetNumberField(TEXT("CurrentState"), FlowState);
+        return SerializeRecord(Record);
+    }
+
+    void ReadMessage(const FJsonObject& Object, FCoachingMessage& OutMessage)
+    {
+        OutMessage.SenderName = Object.GetStringField(TEXT("SenderName"));
+        OutMessage.MessageText = Object.GetStringField(TEXT("MessageText"));
+        OutMessage.MediaURL = Object.GetStringField(TEXT("MediaURL"));
+        OutMessage.bIsCoach = Object.GetBoolField(TEXT("bIsCoach"));
+        FDateTime::Parse(Object.GetStringField(TEXT("Timestamp")), OutMessage.Timestamp);
+    }
+
+    // Lines that fail to parse, e.g. one cut short by a crash, are skipped
+    ECoachingRecord ParseRecord(const FString& Line, FCoachingMessage& OutMessage, int32& OutFlowState)
+    {
+        TSharedPtr<FJsonObject> Record;
+        TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Line);
+        if (!FJsonSerializer::Deserialize(Reader, Record) || !Record.IsValid())
+        {
+            return ECoachingRecord::Invalid;
+        }
+
+        const FString Type = Record->GetStringField(TEXT("Type"));
+        if (Type == MessageRecordType)
+        {
+            ReadMessage(*Record, OutMessage);
+            return ECoachingRecord::Message;
+        }
+        if (Type == StateRecordType)
+        {
+            OutFlowState = Record->GetIntegerField(TEXT("CurrentState"));
+            return ECoachingRecord::FlowState;
+        }
+        return ECoachingRecord::Invalid;
+    }
+
+    // Only the record type is needed to decide what compaction keeps
+    ECoachingRecord PeekRecordType(const FString& Line)
+    {
+        if (Line.Contains(TEXT("\"Type\":\"message\"")))
+        {
+            return ECoachingRecord::Message;
+        }
+        if (Line.Contains(TEXT("\"Type\":\"state\"")))
+        {
+            return ECoachingRecord::FlowState;
+        }
+        return ECoachingRecord::Invalid;
+    }
+
+    // Converts the single-document CoachingFlow.json the widget used to rewrite on every response
+    bool ImportLegacySave(const FString& LegacyPath, const FString& JournalPath)
+    {
+        FString JsonString;
+        if (!FFileHelper::LoadFileToString(JsonString, *LegacyPath))
+        {
+            return false;
+        }
+
+        TSharedPtr<FJsonObject> SaveData;
+        TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+        if (!FJsonSerializer::Deserialize(Reader, SaveData) || !SaveData.IsValid())
+        {
+            return false;
+        }
+
+        FString Journal;
+        const TArray<TSharedPtr<FJsonValue>>* MessageArray = nullptr;
+        if (SaveData->TryGetArrayField(TEXT("Messages"), MessageArray))
+        {
+            for (const TSharedPtr<FJsonValue>& MessageValue : *MessageArray)
+            {
+                const TSharedPtr<FJsonObject>* MessageObj = nullptr;
+                if (MessageValue->TryGetObject(MessageObj))
+                {
+                    FCoachingMessage Message;
+                    ReadMessage(**MessageObj, Message);
+                    Journal += MakeMessageRecord(Message);
+                }
+            }
+        }
+        Journal += MakeStateRecord(SaveData->GetIntegerField(TEXT("CurrentState")));
+
+        if (!FFileHelper::SaveStringToFile(Journal, *JournalPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+        {
+            return false;
+        }
+
+        IFileManager::Get().Delete(*LegacyPath);
+        return true;
+    }
+}
+
+FCoachingJournal::FCoachingJournal(const FString& InPath, int32 InRetainedMessages, int32 InCompactionInterval)
+    : Pipe(TEXT("CoachingJournal"))
+    , Path(InPath)
+    , RetainedMessages(FMath::Max(InRetainedMessages, 1))
+    , CompactionInterval(FMath::Max(InCompactionInterval, 1))
+    , RecordsSinceCompaction(0)
+{
+}
+
+FCoachingJournal::~FCoachingJournal()
+{
+    Flush();
+    CloseWriter();
+}
+
+void FCoachingJournal::AppendMessage(const FCoachingMessage& Message)
+{
+    AppendRecord(MakeMessageRecord(Message));
+}
+
+void FCoachingJournal::AppendFlowState(int32 FlowState)
+{
+    AppendRecord(MakeStateRecord(FlowState));
+}
+
+void FCoachingJournal::AppendRecord(FString&& Record)
+{
+    Pipe.Launch(TEXT("CoachingJournalAppend"), [this, Record = MoveTemp(Record)]()
+    {
+        WriteRecord(Record);
+    });
+
+    if (++RecordsSinceCompaction >= CompactionInterval)
+    {
+        RecordsSinceCompaction = 0;
+        Pipe.Launch(TEXT("CoachingJournalCompact"), [this]()
+        {
+            Compact();
+        });
+    }
+}
+
+void FCoachingJournal::Reset()
+{
+    RecordsSinceCompaction = 0;
+    Pipe.Launch(TEXT("CoachingJournalReset"), [this]()
+    {
+        CloseWriter();
+        IFileManager::Get().Delete(*Path);
+    });
+}
+
+void FCoachingJournal::LoadTailAsync(int32 MaxMessages, TFunction<void(FLoadResult&&)> OnLoaded)
+{
+    // Runs on the pipe so it sees every record appended before it
+    Pipe.Launch(TEXT("CoachingJournalLoad"), [this, MaxMessages, OnLoaded = MoveTemp(OnLoaded)]() mutable
+    {
+        if (!IFileManager::Get().FileExists(*Path))
+        {
+            ImportLegacySave(FPaths::GetPath(Path) / TEXT("CoachingFlow.json"), Path);
+        }
+
+        TArray<FString> Lines;
+        FFileHelper::LoadFileToStringArray(Lines, *Path);
+
+        // Walk back from the end so only the tail gets parsed
+        FLoadResult Result;
+        TArray<FCoachingMessage> NewestFirst;
+        for (int32 Index = Lines.Num() - 1; Index >= 0; --Index)
+        {
+            const bool bNeedMessages = NewestFirst.Num() < MaxMessages;
+            const bool bNeedState = Result.FlowState == INDEX_NONE;
+            if (!bNeedMessages && !bNeedState)
+            {
+                break;
+            }
+
+            const ECoachingRecord Type = PeekRecordType(Lines[Index]);
+            if ((Type == ECoachingRecord::Message && !bNeedMessages) || (Type == ECoachingRecord::FlowState && !bNeedState))
+            {
+                continue;
+            }
+
+            FCoachingMessage Message;
+            int32 FlowState = INDEX_NONE;
+            switch (ParseRecord(Lines[Index], Message, FlowState))
+            {
+                case ECoachingRecord::Message:
+                    NewestFirst.Add(MoveTemp(Message));
+                    break;
+
+                case ECoachingRecord::FlowState:
+                    Result.FlowState = FlowState;
+                    break;
+
+                default:
+                    break;
+            }
+        }
+
+        Result.Messages.Reserve(NewestFirst.Num());
+        for (int32 Index = NewestFirst.Num() - 1; Index >= 0; --Index)
+        {
+            Result.Messages.Add(MoveTemp(NewestFirst[Index]));
+        }
+
+        AsyncTask(ENamedThreads::GameThread, [OnLoaded = MoveTemp(OnLoaded), Result = MoveTemp(Result)]() mutable
+        {
+            OnLoaded(MoveTemp(Result));
+        });
+    });
+}
+
+void FCoachingJournal::Flush()
+{
+    Pipe.WaitUntilEmpty();
+}
+
+void FCoachingJournal::WriteRecord(const FString& Record)
+{
+    if (!Writer)
+    {
+        Writer.Reset(IFileManager::Get().CreateFileWriter(*Path, FILEWRITE_Append | FILEWRITE_AllowRead));
+        if (!Writer)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("Could not open coaching journal %s"), *Path);
+            return;
+        }
+    }
+
+    FTCHARToUTF8 Utf8(*Record);
+    Writer->Serialize(const_cast<ANSICHAR*>(Utf8.Get()), Utf8.Length());
+    Writer->Flush();
+}
+
+void FCoachingJournal::CloseWriter()
+{
+    if (Writer)
+    {
+        Writer->Close();
+        Writer.Reset();
+    }
+}
+
+void FCoachingJournal::Compact()
+{
+    CloseWriter();
+
+    TArray<FString> Lines;
+    if (!FFileHelper::LoadFileToStringArray(Lines, *Path))
+    {
+        return;
+    }
+
+    // Keep the newest RetainedMessages messages and the latest state record
+    TArray<int32> KeptLines;
+    int32 KeptMessages = 0;
+    bool bKeptState = false;
+    for (int32 Index = Lines.Num() - 1; Index >= 0; --Index)
+    {
+        const ECoachingRecord Type = PeekRecordType(Lines[Index]);
+        if (Type == ECoachingRecord::Message && KeptMessages < RetainedMessages)
+        {
+            KeptLines.Add(Index);
+            ++KeptMessages;
+        }
+        else if (Type == ECoachingRecord::FlowState && !bKeptState)
+        {
+            KeptLines.Add(Index);
+            bKeptState = true;
+        }
+    }
+
+    FString Compacted;
+    for (int32 Index = KeptLines.Num() - 1; Index >= 0; --Index)
+    {
+        Compacted += Lines[KeptLines[Index]];
+        Compacted.AppendChar(TEXT('\n'));
+    }
+
+    // Write aside and swap in so a crash mid-compaction leaves the old journal intact
+    const FString TempPath = Path + TEXT(".tmp");
+    if (!FFileHelper::SaveStringToFile(Compacted, *TempPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM)
+        || !IFileManager::Get().Move(*Path, *TempPath, true))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Failed to compact coaching journal %s"), *Path);
+        IFileManager::Get().Delete(*TempPath);
+    }
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Tasks/Pipe.h"
+
+struct FCoachingMessage;
+
+// Append-only JSON-lines log of a coaching conversation. One record per
+// message or state change, written in order on a background pipe, and
+// compacted down to the most recent messages every so often.
+class SPORTBEACON_API FCoachingJournal
+{
+public:
+    struct FLoadResult
+    {
+        // Oldest first, at most the requested count
+        TArray<FCoachingMessage> Messages;
+        // Last recorded flow state, INDEX_NONE if none was written
+        int32 FlowState = INDEX_NONE;
+    };
+
+    FCoachingJournal(const FString& InPath, int32 InRetainedMessages, int32 InCompactionInterval);
+    ~FCoachingJournal();
+
+    void AppendMessage(const FCoachingMessage& Message);
+    void AppendFlowState(int32 FlowState);
+
+    // Drops everything written so far
+    void Reset();
+
+    // Reads the tail of the journal in the background and calls OnLoaded on the game thread.
+    // A CoachingFlow.json from before the journal is imported the first time.
+    void LoadTailAsync(int32 MaxMessages, TFunction<void(FLoadResult&&)> OnLoaded);
+
+    // Blocks until every queued write has reached the file
+    void Flush();
+
+private:
+    void AppendRecord(FString&& Record);
+
+    // Pipe-only helpers
+    void WriteRecord(const FString& Record);
+    void CloseWriter();
+    void Compact();
+
+    UE::Tasks::FPipe Pipe;
+    FString Path;
+    int32 RetainedMessages;
+    int32 CompactionInterval;
+
+    // Game thread only
+    int32 RecordsSinceCompaction;
+
+    // Touched only by tasks on the pipe
+    TUniquePtr<FArchive> Writer;
+};
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Interface.h"
+#include "FeedEntryWidget.generated.h"
+
+class UTexture2D;
+
+USTRUCT(BlueprintType)
+struct FBadgeData
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    FString BadgeID;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    FString Name;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    FString Description;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    UTexture2D* Icon;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    FString EarnedDate;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    FLinearColor BadgeColor;
+};
+
+USTRUCT(BlueprintType)
+struct FFeedEntry
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    FString Title;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    FString Subtitle;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    UTexture2D* Icon;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    FDateTime Timestamp;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    FString EntryType;  // "badge", "highlight", "stat", etc.
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    FBadgeData BadgeData;  // Optional, only for badge entries
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    FString MediaUrl;  // Optional, clip for highlight entries
+};
+
+UINTERFACE(BlueprintType)
+class SPORTBEACON_API UFeedEntryWidget : public UInterface
+{
+    GENERATED_BODY()
+};
+
+/**
+ * Implemented by widgets that show one timeline feed row. C++ widgets override
+ * BindFeedEntry and are called directly; Blueprint widgets implement
+ * OnBindFeedEntry instead. The same widget may be rebound many times when the
+ * feed recycles rows, bIsNewEntry is only set the first time an entry appears.
+ */
+class SPORTBEACON_API IFeedEntryWidget
+{
+    GENERATED_BODY()
+
+public:
+    virtual void BindFeedEntry(const FFeedEntry& Entry, bool bIsNewEntry) {}
+
+    UFUNCTION(BlueprintImplementableEvent, Category = "Timeline")
+    void OnBindFeedEntry(const FFeedEntry& Entry, bool bIsNewEntry);
+};
@@ -0,0 +1,220 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Fixed-capacity FIFO over a single allocation made up front. Steady-state
+// use never allocates, which is the point for per-frame and per-callback
+// paths. Not thread safe.
+template <typename ElementType>
+class TFixedRingBuffer
+{
+    // Walks oldest to newest
+    template <typename BufferType, typename ReferenceType>
+    class TIterator
+    {
+    public:
+        TIterator(BufferType& InBuffer, int32 InIndex)
+            : Buffer(InBuffer)
+            , Index(InIndex)
+        {}
+
+        TIterator& operator++()
+        {
+            ++Index;
+            return *this;
+        }
+
+        ReferenceType operator*() const { return Buffer[Index]; }
+        bool operator!=(const TIterator& Other) const { return Index != Other.Index; }
+
+    private:
+        BufferType& Buffer;
+        int32 Index;
+    };
+
+public:
+    explicit TFixedRingBuffer(int32 InCapacity = 0)
+    {
+        SetCapacity(InCapacity);
+    }
+
+    // Reallocates and drops the current contents
+    void SetCapacity(int32 NewCapacity)
+    {
+        Storage.Reset();
+        Storage.SetNum(FMath::Max(NewCapacity, 0));
+        Head = 0;
+        Count = 0;
+    }
+
+    // Changes capacity keeping the newest elements that still fit
+    void Resize(int32 NewCapacity)
+    {
+        NewCapacity = FMath::Max(NewCapacity, 0);
+        if (NewCapacity == Storage.Num())
+        {
+            return;
+        }
+
+        TArray<ElementType> NewStorage;
+        NewStorage.SetNum(NewCapacity);
+
+        const int32 NumToKeep = FMath::Min(Count, NewCapacity);
+        for (int32 Index = 0; Index < NumToKeep; ++Index)
+        {
+            NewStorage[Index] = MoveTemp((*this)[Count - NumToKeep + Index]);
+        }
+
+        Storage = MoveTemp(NewStorage);
+        Head = 0;
+        Count = NumToKeep;
+    }
+
+    int32 Capacity() const { return Storage.Num(); }
+    int32 Num() const { return Count; }
+    int32 Slack() const { return Storage.Num() - Count; }
+    bool IsEmpty() const { return Count == 0; }
+    bool IsFull() const { return Count == Storage.Num(); }
+
+    void Reset()
+    {
+        Head = 0;
+        Count = 0;
+    }
+
+    // Appends one element, overwriting the oldest when full. Returns false if something was overwritten.
+    bool Push(const ElementType& Item)
+    {
+        if (Storage.Num() == 0)
+        {
+            return false;
+        }
+
+        if (IsFull())
+        {
+            Storage[Head] = Item;
+            Head = WrapIndex(Head + 1);
+            return false;
+        }
+
+        Storage[WrapIndex(Head + Count)] = Item;
+        ++Count;
+        return true;
+    }
+
+    bool Push(ElementType&& Item)
+    {
+        if (Storage.Num() == 0)
+        {
+            return false;
+        }
+
+        if (IsFull())
+        {
+            Storage[Head] = MoveTemp(Item);
+            Head = WrapIndex(Head + 1);
+            return false;
+        }
+
+        Storage[WrapIndex(Head + Count)] = MoveTemp(Item);
+        ++Count;
+        return true;
+    }
+
+    // Appends as many elements as fit without overwriting, returns how many were copied
+    int32 Write(const ElementType* Items, int32 NumItems)
+    {
+        if (Storage.Num() == 0)
+        {
+            return 0;
+        }
+
+        const int32 NumToWrite = FMath::Min(NumItems, Slack());
+        const int32 Tail = WrapIndex(Head + Count);
+        const int32 FirstSpan = FMath::Min(NumToWrite, Storage.Num() - Tail);
+
+        CopyElements(&Storage[Tail], Items, FirstSpan);
+        CopyElements(Storage.GetData(), Items + FirstSpan, NumToWrite - FirstSpan);
+
+        Count += NumToWrite;
+        return NumToWrite;
+    }
+
+    // Copies up to NumItems of the oldest elements out and drops them, returns how many were copied
+    int32 Read(ElementType* OutItems, int32 NumItems)
+    {
+        if (Storage.Num() == 0)
+        {
+            return 0;
+        }
+
+        const int32 NumToRead = FMath::Min(NumItems, Count);
+        const int32 FirstSpan = FMath::Min(NumToRead, Storage.Num() - Head);
+
+        CopyElements(OutItems, &Storage[Head], FirstSpan);
+        CopyElements(OutItems + FirstSpan, Storage.GetData(), NumToRead - FirstSpan);
+
+        PopFront(NumToRead);
+        return NumToRead;
+    }
+
+    // Drops up to NumItems of the oldest elements
+    void PopFront(int32 NumItems = 1)
+    {
+        NumItems = FMath::Min(NumItems, Count);
+        Head = WrapIndex(Head + NumItems);
+        Count -= NumItems;
+    }
+
+    // Index 0 is the oldest element
+    ElementType& operator[](int32 Index)
+    {
+        check(Index >= 0 && Index < Count);
+        return Storage[WrapIndex(Head + Index)];
+    }
+
+    const ElementType& operator[](int32 Index) const
+    {
+        check(Index >= 0 && Index < Count);
+        return Storage[WrapIndex(Head + Index)];
+    }
+
+    ElementType& Last() { return (*this)[Count - 1]; }
+    const ElementType& Last() const { return (*this)[Count - 1]; }
+
+    // Range-for support, oldest first
+    TIterator<TFixedRingBuffer, ElementType&> begin() { return { *this, 0 }; }
+    TIterator<TFixedRingBuffer, ElementType&> end() { return { *this, Count }; }
+    TIterator<const TFixedRingBuffer, const ElementType&> begin() const { return { *this, 0 }; }
+    TIterator<const TFixedRingBuffer, const ElementType&> end() const { return { *this, Count }; }
+
+private:
+    int32 WrapIndex(int32 Index) const
+    {
+        return Index >= Storage.Num() ? Index - Storage.Num() : Index;
+    }
+
+    static void CopyElements(ElementType* Dest, const ElementType* Source, int32 NumItems)
+    {
+        if (NumItems <= 0)
+        {
+            return;
+        }
+
+        if constexpr (TIsTriviallyCopyAssignable<ElementType>::Value)
+        {
+            FMemory::Memcpy(Dest, Source, NumItems * sizeof(ElementType));
+        }
+        else
+        {
+            for (int32 Index = 0; Index < NumItems; ++Index)
+            {
+                Dest[Index] = Source[Index];
+            }
+        }
+    }
+
+    TArray<ElementType> Storage;
+    int32 Head = 0;
+    int32 Count = 0;
+};
@@ -0,0 +1,691 @@
+#include "ImageCacheSubsystem.h"
+#include "SportBeaconStats.h"
+#include "Engine/GameInstance.h"
+#include "Engine/Texture2D.h"
+#include "Engine/World.h"
+#include "HttpModule.h"
+#include "Interfaces/IHttpResponse.h"
+#include "IImageWrapper.h"
+#include "IImageWrapperModule.h"
+#include "Modules/ModuleManager.h"
+#include "Async/Async.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/SecureHash.h"
+#include "UObject/Package.h"
+
+namespace
+{
+    // Area-averaging resample, good for any downscale factor including the 2:1 mip steps
+    void DownsampleImage(const TArray<FColor>& Source, int32 SourceWidth, int32 SourceHeight, TArray<FColor>& OutPixels, int32 TargetWidth, int32 TargetHeight)
+    {
+        OutPixels.SetNumUninitialized(TargetWidth * TargetHeight);
+
+        const double StepX = double(SourceWidth) / TargetWidth;
+        const double StepY = double(SourceHeight) / TargetHeight;
+
+        for (int32 Y = 0; Y < TargetHeight; ++Y)
+        {
+            const int32 MinY = FMath::FloorToInt(Y * StepY);
+            const int32 MaxY = FMath::Clamp(FMath::CeilToInt((Y + 1) * StepY), MinY + 1, SourceHeight);
+
+            for (int32 X = 0; X < TargetWidth; ++X)
+            {
+                const int32 MinX = FMath::FloorToInt(X * StepX);
+                const int32 MaxX = FMath::Clamp(FMath::CeilToInt((X + 1) * StepX), MinX + 1, SourceWidth);
+
+                uint32 Sum[4] = { 0, 0, 0, 0 };
+                for (int32 SampleY = MinY; SampleY < MaxY; ++SampleY)
+                {
+                    const FColor* Row = &Source[SampleY * SourceWidth];
+                    for (int32 SampleX = MinX; SampleX < MaxX; ++SampleX)
+                    {
+                        Sum[0] += Row[SampleX].B;
+                        Sum[1] += Row[SampleX].G;
+                        Sum[2] += Row[SampleX].R;
+                        Sum[3] += Row[SampleX].A;
+                    }
+                }
+
+                const uint32 Count = uint32((MaxX - MinX) * (MaxY - MinY));
+                FColor& Out = OutPixels[Y * TargetWidth + X];
+                Out.B = uint8(Sum[0] / Count);
+                Out.G = uint8(Sum[1] / Count);
+                Out.R = uint8(Sum[2] / Count);
+                Out.A = uint8(Sum[3] / Count);
+            }
+        }
+    }
+}
+
+UImageCacheSubsystem* UImageCacheSubsystem::Get(const UObject* WorldContextObject)
+{
+    const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+    const UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+    return GameInstance ? GameInstance->GetSubsystem<UImageCacheSubsystem>() : nullptr;
+}
+
+void UImageCacheSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    // Loaded here so workers never race the module manager
+    FModuleManager::LoadModuleChecked<IImageWrapperModule>(FName("ImageWrapper"));
+
+    DiskCacheDirectory = FPaths::ProjectSavedDir() / TEXT("ImageCache");
+
+    if (bEnableDiskCache && MaxDiskCacheAgeDays > 0)
+    {
+        const FString Directory = DiskCacheDirectory;
+        const FTimespan MaxAge = FTimespan::FromDays(MaxDiskCacheAgeDays);
+        Async(EAsyncExecution::ThreadPool, [Directory, MaxAge]()
+        {
+            IFileManager& FileManager = IFileManager::Get();
+            TArray<FString> Files;
+            FileManager.FindFiles(Files, *(Directory / TEXT("*.img")), true, false);
+
+            const FDateTime Now = FDateTime::UtcNow();
+            for (const FString& File : Files)
+            {
+                const FString Path = Directory / File;
+                if (Now - FileManager.GetTimeStamp(*Path) > MaxAge)
+                {
+                    FileManager.Delete(*Path, false, true, true);
+                }
+            }
+        });
+    }
+}
+
+void UImageCacheSubsystem::Deinitialize()
+{
+    for (auto& Download : PendingDownloads)
+    {
+        Download.Value.HttpRequest->OnProcessRequestComplete().Unbind();
+        Download.Value.HttpRequest->CancelRequest();
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("ImageCache: %d memory hits, %d coalesced, %d disk hits, %d downloads, %d evictions"),
+        Stats.MemoryHits, Stats.CoalescedRequests, Stats.DiskHits, Stats.Downloads, Stats.Evictions);
+
+    PendingImages.Reset();
+    PendingDownloads.Reset();
+    PendingHandles.Reset();
+    LowPriorityQueue.Reset();
+    ClearMemoryCache();
+
+    Super::Deinitialize();
+}
+
+int32 UImageCacheSubsystem::GetDimensionBucket(int32 MaxDimension)
+{
+    return MaxDimension > 0 ? int32(FMath::RoundUpToPowerOfTwo(uint32(MaxDimension))) : 0;
+}
+
+FString UImageCacheSubsystem::MakeCacheKey(const FString& URL, int32 DimensionBucket)
+{
+    return DimensionBucket > 0 ? FString::Printf(TEXT("%s#%d"), *URL, DimensionBucket) : URL;
+}
+
+uint64 UImageCacheSubsystem::RequestImage(const FString& URL, FOnCachedImageReady OnReady, int32 MaxDimension, EImageRequestPriority Priority)
+{
+    if (URL.IsEmpty())
+    {
+        OnReady.ExecuteIfBound(nullptr, TEXT("Invalid URL provided"));
+        return 0;
+    }
+
+    if (UTexture2D* Cached = FindCachedImage(URL, MaxDimension))
+    {
+        ++Stats.MemoryHits;
+        OnReady.ExecuteIfBound(Cached, FString());
+        return 0;
+    }
+
+    const int32 DimensionBucket = GetDimensionBucket(MaxDimension);
+    const FString CacheKey = MakeCacheKey(URL, DimensionBucket);
+
+    const uint64 Handle = NextRequestHandle++;
+    PendingHandles.Add(Handle, CacheKey);
+
+    if (FPendingImage* Pending = PendingImages.Find(CacheKey))
+    {
+        ++Stats.CoalescedRequests;
+        Pending->Subscribers.Emplace(Handle, MoveTemp(OnReady));
+
+        // Someone needs it now, so it stops waiting behind the idle queue
+        if (Priority == EImageRequestPriority::Normal && Pending->Priority == EImageRequestPriority::Low)
+        {
+            Pending->Priority = EImageRequestPriority::Normal;
+            if (!Pending->bStarted)
+            {
+                LowPriorityQueue.Remove(CacheKey);
+                StartLoad(CacheKey);
+            }
+        }
+        return Handle;
+    }
+
+    FPendingImage& Pending = PendingImages.Add(CacheKey);
+    Pending.URL = URL;
+    Pending.MaxDimension = DimensionBucket;
+    Pending.Priority = Priority;
+    Pending.Subscribers.Emplace(Handle, MoveTemp(OnReady));
+
+    if (Priority == EImageRequestPriority::Low)
+    {
+        LowPriorityQueue.Add(CacheKey);
+        PumpLowPriorityLoads();
+    }
+    else
+    {
+        StartLoad(CacheKey);
+    }
+
+    return Handle;
+}
+
+void UImageCacheSubsystem::CancelRequest(uint64 RequestHandle)
+{
+    FString CacheKey;
+    if (!PendingHandles.RemoveAndCopyValue(RequestHandle, CacheKey))
+    {
+        return;
+    }
+
+    FPendingImage* Pending = PendingImages.Find(CacheKey);
+    if (!Pending)
+    {
+        return;
+    }
+
+    Pending->Subscribers.RemoveAll([RequestHandle](const TPair<uint64, FOnCachedImageReady>& Subscriber)
+    {
+        return Subscriber.Key == RequestHandle;
+    });
+
+    if (Pending->Subscribers.Num() > 0)
+    {
+        return;
+    }
+
+    // Nobody is waiting any more. A disk read or decode already running just
+    // finds no pending entry when it lands, a download no other size shares is aborted outright.
+    if (FPendingDownload* Download = PendingDownloads.Find(Pending->URL))
+    {
+        Download->CacheKeys.Remove(CacheKey);
+        if (Download->CacheKeys.Num() == 0)
+        {
+            Download->HttpRequest->OnProcessRequestComplete().Unbind();
+            Download->HttpRequest->CancelRequest();
+            PendingDownloads.Remove(Pending->URL);
+        }
+    }
+
+    *Pending->bCancelled = true;
+    ++Stats.CancelledLoads;
+    PendingImages.Remove(CacheKey);
+    LowPriorityQueue.Remove(CacheKey);
+    PumpLowPriorityLoads();
+}
+
+FString UImageCacheSubsystem::GetThumbnailURL(const FString& URL) const
+{
+    for (const FImageThumbnailRule& Rule : ThumbnailRules)
+    {
+        if (Rule.UrlPrefix.IsEmpty() || !URL.StartsWith(Rule.UrlPrefix))
+        {
+            continue;
+        }
+
+        FString Path = URL;
+        FString Query;
+        URL.Split(TEXT("?"), &Path, &Query);
+
+        if (!Rule.FileSuffix.IsEmpty())
+        {
+            // Only look for the extension in the last path segment
+            const int32 SlashIndex = Path.Find(TEXT("/"), ESearchCase::CaseSensitive, ESearchDir::FromEnd);
+            const int32 DotIndex = Path.Find(TEXT("."), ESearchCase::CaseSensitive, ESearchDir::FromEnd);
+            if (DotIndex != INDEX_NONE && DotIndex > SlashIndex)
+            {
+                Path.InsertAt(DotIndex, Rule.FileSuffix);
+            }
+            else
+            {
+                Path += Rule.FileSuffix;
+            }
+        }
+
+        if (!Rule.QueryParameters.IsEmpty())
+        {
+            Query = Query.IsEmpty() ? Rule.QueryParameters : Query + TEXT("&") + Rule.QueryParameters;
+        }
+
+        return Query.IsEmpty() ? Path : Path + TEXT("?") + Query;
+    }
+
+    return FString();
+}
+
+void UImageCacheSubsystem::PumpLowPriorityLoads()
+{
+    int32 NormalInFlight = 0;
+    int32 LowInFlight = 0;
+    for (const auto& Pending : PendingImages)
+    {
+        if (Pending.Value.bStarted)
+        {
+            ++(Pending.Value.Priority == EImageRequestPriority::Low ? LowInFlight : NormalInFlight);
+        }
+    }
+
+    while (NormalInFlight == 0 && LowInFlight < FMath::Max(MaxConcurrentLowPriorityLoads, 1) && LowPriorityQueue.Num() > 0)
+    {
+        const FString CacheKey = LowPriorityQueue[0];
+        LowPriorityQueue.RemoveAt(0);
+
+        const FPendingImage* Pending = PendingImages.Find(CacheKey);
+        if (Pending && !Pending->bStarted)
+        {
+            StartLoad(CacheKey);
+            ++LowInFlight;
+        }
+    }
+}
+
+UTexture2D* UImageCacheSubsystem::FindCachedImage(const FString& URL, int32 MaxDimension)
+{
+    FCachedImage* Entry = CachedImages.Find(MakeCacheKey(URL, GetDimensionBucket(MaxDimension)));
+    if (!Entry || !Entry->Texture)
+    {
+        return nullptr;
+    }
+
+    Entry->LastUsed = ++UseCounter;
+    return Entry->Texture;
+}
+
+void UImageCacheSubsystem::ClearMemoryCache()
+{
+    // Widgets still showing a texture keep it alive through their brush
+    CachedImages.Reset();
+    CachedBytes = 0;
+
+    SPORTBEACON_SET_MEMORY(ImageCacheMemory, 0);
+    SPORTBEACON_SET_COUNT(CachedImages, 0);
+}
+
+FImageCacheStats UImageCacheSubsystem::GetCacheStats() const
+{
+    FImageCacheStats Result = Stats;
+    Result.CachedImages = CachedImages.Num();
+    Result.CachedBytes = CachedBytes;
+    return Result;
+}
+
+void UImageCacheSubsystem::StartLoad(const FString& CacheKey)
+{
+    FPendingImage* Pending = PendingImages.Find(CacheKey);
+    if (!Pending)
+    {
+        return;
+    }
+
+    Pending->bStarted = true;
+
+    if (!bEnableDiskCache)
+    {
+        StartDownload(CacheKey);
+        return;
+    }
+
+    TWeakObjectPtr<UImageCacheSubsystem> WeakThis(this);
+    const FString Path = GetDiskCachePath(Pending->URL);
+    const int32 MaxDimension = Pending->MaxDimension;
+    TSharedRef<FThreadSafeBool, ESPMode::ThreadSafe> bCancelled = Pending->bCancelled;
+
+    Async(EAsyncExecution::ThreadPool, [WeakThis, CacheKey, Path, MaxDimension, bCancelled]()
+    {
+        if (*bCancelled)
+        {
+            return;
+        }
+
+        TArray<uint8> CompressedData;
+        const bool bOnDisk = IFileManager::Get().FileExists(*Path) && FFileHelper::LoadFileToArray(CompressedData, *Path);
+        FDecodedImage Decoded = bOnDisk && !*bCancelled ? DecodeImage(CompressedData, MaxDimension) : FDecodedImage();
+
+        AsyncTask(ENamedThreads::GameThread, [WeakThis, CacheKey, bOnDisk, bCancelled, Decoded = MoveTemp(Decoded)]() mutable
+        {
+            UImageCacheSubsystem* Cache = WeakThis.Get();
+            if (!Cache || *bCancelled)
+            {
+                return;
+            }
+
+            // A missing or corrupt disk entry falls back to the network
+            if (bOnDisk && Decoded.Error.IsEmpty())
+            {
+                ++Cache->Stats.DiskHits;
+                Cache->FinishLoad(CacheKey, MoveTemp(Decoded));
+            }
+            else
+            {
+                Cache->StartDownload(CacheKey);
+            }
+        });
+    });
+}
+
+void UImageCacheSubsystem::StartDownload(const FString& CacheKey)
+{
+    FPendingImage* Pending = PendingImages.Find(CacheKey);
+    if (!Pending)
+    {
+        return;
+    }
+
+    // Another size of the same image is already on its way
+    if (FPendingDownload* Download = PendingDownloads.Find(Pending->URL))
+    {
+        ++Stats.CoalescedRequests;
+        Download->CacheKeys.AddUnique(CacheKey);
+        return;
+    }
+
+    ++Stats.Downloads;
+
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FHttpModule::Get().CreateRequest();
+    HttpRequest->SetVerb(TEXT("GET"));
+    HttpRequest->SetURL(Pending->URL);
+    HttpRequest->OnProcessRequestComplete().BindUObject(this, &UImageCacheSubsystem::OnDownloadComplete, Pending->URL);
+
+    FPendingDownload& Download = PendingDownloads.Add(Pending->URL);
+    Download.HttpRequest = HttpRequest;
+    Download.CacheKeys.Add(CacheKey);
+    HttpRequest->ProcessRequest();
+}
+
+void UImageCacheSubsystem::OnDownloadComplete(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSuccess, FString URL)
+{
+    FPendingDownload Download;
+    if (!PendingDownloads.RemoveAndCopyValue(URL, Download))
+    {
+        return;
+    }
+
+    if (!bSuccess || !Response.IsValid() || !EHttpResponseCodes::IsOk(Response->GetResponseCode()))
+    {
+        for (const FString& CacheKey : Download.CacheKeys)
+        {
+            FailLoad(CacheKey, TEXT("Failed to download image"));
+        }
+        return;
+    }
+
+    struct FDecodeTarget
+    {
+        FString CacheKey;
+        int32 MaxDimension;
+        TSharedRef<FThreadSafeBool, ESPMode::ThreadSafe> bCancelled;
+    };
+
+    TArray<FDecodeTarget> Targets;
+    for (const FString& CacheKey : Download.CacheKeys)
+    {
+        if (const FPendingImage* Pending = PendingImages.Find(CacheKey))
+        {
+            Targets.Add(FDecodeTarget{ CacheKey, Pending->MaxDimension, Pending->bCancelled });
+        }
+    }
+
+    // Decode, resize, mip and persist off the game thread. The worker only
+    // holds the response and plain values, never this object or its state.
+    TWeakObjectPtr<UImageCacheSubsystem> WeakThis(this);
+    const FString Path = bEnableDiskCache ? GetDiskCachePath(URL) : FString();
+
+    Async(EAsyncExecution::ThreadPool, [WeakThis, Path, Response, Targets = MoveTemp(Targets)]()
+    {
+        const TArray<uint8>& CompressedData = Response->GetContent();
+
+        // Persist first, so a later request can still use the bytes if every size was cancelled
+        if (!Path.IsEmpty())
+        {
+            FFileHelper::SaveArrayToFile(CompressedData, *Path);
+        }
+
+        for (const FDecodeTarget& Target : Targets)
+        {
+            if (*Target.bCancelled)
+            {
+                continue;
+            }
+
+            FDecodedImage Decoded = DecodeImage(CompressedData, Target.MaxDimension);
+
+            AsyncTask(ENamedThreads::GameThread, [WeakThis, CacheKey = Target.CacheKey, bCancelled = Target.bCancelled, Decoded = MoveTemp(Decoded)]() mutable
+            {
+                UImageCacheSubsystem* Cache = WeakThis.Get();
+                if (Cache && !*bCancelled)
+                {
+                    if (Decoded.Error.IsEmpty())
+                    {
+                        Cache->FinishLoad(CacheKey, MoveTemp(Decoded));
+                    }
+                    else
+                    {
+                        Cache->FailLoad(CacheKey, Decoded.Error);
+                    }
+                }
+            });
+        }
+    });
+}
+
+void UImageCacheSubsystem::FinishLoad(const FString& CacheKey, FDecodedImage&& Decoded)
+{
+    const int64 SizeBytes = Decoded.SizeBytes;
+    UTexture2D* Texture = CreateTexture(Decoded);
+    if (!Texture)
+    {
+        FailLoad(CacheKey, TEXT("Failed to create texture"));
+        return;
+    }
+
+    AddToCache(CacheKey, Texture, SizeBytes);
+
+    FPendingImage Pending;
+    if (PendingImages.RemoveAndCopyValue(CacheKey, Pending))
+    {
+        for (TPair<uint64, FOnCachedImageReady>& Subscriber : Pending.Subscribers)
+        {
+            PendingHandles.Remove(Subscriber.Key);
+            Subscriber.Value.ExecuteIfBound(Texture, FString());
+        }
+    }
+
+    PumpLowPriorityLoads();
+}
+
+void UImageCacheSubsystem::FailLoad(const FString& CacheKey, const FString& Error)
+{
+    FPendingImage Pending;
+    if (PendingImages.RemoveAndCopyValue(CacheKey, Pending))
+    {
+        for (TPair<uint64, FOnCachedImageReady>& Subscriber : Pending.Subscribers)
+        {
+            PendingHandles.Remove(Subscriber.Key);
+            Subscriber.Value.ExecuteIfBound(nullptr, Error);
+        }
+    }
+
+    PumpLowPriorityLoads();
+}
+
+UImageCacheSubsystem::FDecodedImage UImageCacheSubsystem::DecodeImage(const TArray<uint8>& CompressedData, int32 MaxDimension)
+{
+    SPORTBEACON_SCOPE_CYCLE(ImageDecode);
+
+    FDecodedImage Decoded;
+
+    IImageWrapperModule& ImageWrapperModule = FModuleManager::GetModuleChecked<IImageWrapperModule>(FName("ImageWrapper"));
+
+    // Detect image format
+    EImageFormat ImageFormat = ImageWrapperModule.DetectImageFormat(CompressedData.GetData(), CompressedData.Num());
+    if (ImageFormat == EImageFormat::Invalid)
+    {
+        Decoded.Error = TEXT("Invalid image format");
+        return Decoded;
+    }
+
+    TSharedPtr<IImageWrapper> ImageWrapper = ImageWrapperModule.CreateImageWrapper(ImageFormat);
+    if (!ImageWrapper.IsValid() || !ImageWrapper->SetCompressed(CompressedData.GetData(), CompressedData.Num()))
+    {
+        Decoded.Error = TEXT("Failed to process image data");
+        return Decoded;
+    }
+
+    TArray64<uint8> RawData;
+    if (!ImageWrapper->GetRaw(ERGBFormat::BGRA, 8, RawData))
+    {
+        Decoded.Error = TEXT("Failed to decode image");
+        return Decoded;
+    }
+
+    int32 Width = ImageWrapper->GetWidth();
+    int32 Height = ImageWrapper->GetHeight();
+    TArray<FColor> Pixels;
+    Pixels.SetNumUninitialized(Width * Height);
+    FMemory::Memcpy(Pixels.GetData(), RawData.GetData(), Pixels.Num() * sizeof(FColor));
+    RawData.Empty();
+
+    // Nobody needs more pixels than the widget shows
+    if (MaxDimension > 0 && FMath::Max(Width, Height) > MaxDimension)
+    {
+        const float Scale = float(MaxDimension) / FMath::Max(Width, Height);
+        const int32 TargetWidth = FMath::Max(FMath::RoundToInt(Width * Scale), 1);
+        const int32 TargetHeight = FMath::Max(FMath::RoundToInt(Height * Scale), 1);
+
+        TArray<FColor> Resized;
+        DownsampleImage(Pixels, Width, Height, Resized, TargetWidth, TargetHeight);
+        Pixels = MoveTemp(Resized);
+        Width = TargetWidth;
+        Height = TargetHeight;
+    }
+
+    // Platform data is built here in full, the game thread only attaches it
+    TUniquePtr<FTexturePlatformData> PlatformData = MakeUnique<FTexturePlatformData>();
+    PlatformData->SizeX = Width;
+    PlatformData->SizeY = Height;
+    PlatformData->SetNumSlices(1);
+    PlatformData->PixelFormat = PF_B8G8R8A8;
+
+    auto AddMip = [&PlatformData, &Decoded](const TArray<FColor>& MipPixels, int32 MipWidth, int32 MipHeight)
+    {
+        FTexture2DMipMap* Mip = new FTexture2DMipMap(MipWidth, MipHeight, 1);
+        PlatformData->Mips.Add(Mip);
+
+        const int64 MipBytes = int64(MipPixels.Num()) * sizeof(FColor);
+        Mip->BulkData.Lock(LOCK_READ_WRITE);
+        FMemory::Memcpy(Mip->BulkData.Realloc(MipBytes), MipPixels.GetData(), MipBytes);
+        Mip->BulkData.Unlock();
+
+        Decoded.SizeBytes += MipBytes;
+    };
+
+    AddMip(Pixels, Width, Height);
+
+    // Box-filtered chain so scaled-down brushes do not shimmer
+    TArray<FColor> MipPixels;
+    while (Width > 1 || Height > 1)
+    {
+        const int32 MipWidth = FMath::Max(Width / 2, 1);
+        const int32 MipHeight = FMath::Max(Height / 2, 1);
+        DownsampleImage(Pixels, Width, Height, MipPixels, MipWidth, MipHeight);
+        AddMip(MipPixels, MipWidth, MipHeight);
+
+        Swap(Pixels, MipPixels);
+        Width = MipWidth;
+        Height = MipHeight;
+    }
+
+    Decoded.PlatformData = MoveTemp(PlatformData);
+    return Decoded;
+}
+
+FString UImageCacheSubsystem::GetDiskCachePath(const FString& URL) const
+{
+    return DiskCacheDirectory / (FMD5::HashAnsiString(*URL) + TEXT(".img"));
+}
+
+UTexture2D* UImageCacheSubsystem::CreateTexture(FDecodedImage& Decoded)
+{
+    SPORTBEACON_SCOPE_CYCLE(ImageDisplay);
+
+    if (!Decoded.PlatformData.IsValid())
+    {
+        return nullptr;
+    }
+
+    UTexture2D* NewTexture = NewObject<UTexture2D>(GetTransientPackage(), NAME_None, RF_Transient);
+    if (!NewTexture)
+    {
+        return nullptr;
+    }
+
+    // Ownership of the prebuilt mips moves to the texture. UpdateResource hands
+    // them to the render thread, which does the actual upload.
+    NewTexture->NeverStream = true;
+    NewTexture->SRGB = true;
+    NewTexture->LODGroup = TEXTUREGROUP_UI;
+    NewTexture->SetPlatformData(Decoded.PlatformData.Release());
+    NewTexture->UpdateResource();
+
+    return NewTexture;
+}
+
+void UImageCacheSubsystem::AddToCache(const FString& CacheKey, UTexture2D* Texture, int64 SizeBytes)
+{
+    if (FCachedImage* Existing = CachedImages.Find(CacheKey))
+    {
+        CachedBytes -= Existing->SizeBytes;
+    }
+
+    FCachedImage& Entry = CachedImages.Add(CacheKey);
+    Entry.Texture = Texture;
+    Entry.SizeBytes = SizeBytes;
+    Entry.LastUsed = ++UseCounter;
+    CachedBytes += SizeBytes;
+
+    EvictToBudget();
+}
+
+void UImageCacheSubsystem::EvictToBudget()
+{
+    const int64 BudgetBytes = int64(FMath::Max(MemoryBudgetMB, 1)) * 1024 * 1024;
+
+    // Always keep the newest entry, even if it alone is over budget
+    while (CachedBytes > BudgetBytes && CachedImages.Num() > 1)
+    {
+        FString OldestURL;
+        uint64 OldestUse = MAX_uint64;
+        for (const auto& Entry : CachedImages)
+        {
+            if (Entry.Value.LastUsed < OldestUse)
+            {
+                OldestUse = Entry.Value.LastUsed;
+                OldestURL = Entry.Key;
+            }
+        }
+
+        FCachedImage Evicted;
+        CachedImages.RemoveAndCopyValue(OldestURL, Evicted);
+        CachedBytes -= Evicted.SizeBytes;
+        ++Stats.Evictions;
+    }
+
+    SPORTBEACON_SET_MEMORY(ImageCacheMemory, CachedBytes);
+    SPORTBEACON_SET_COUNT(CachedImages, CachedImages.Num());
+}
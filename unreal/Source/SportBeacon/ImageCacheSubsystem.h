@@ -0,0 +1,206 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "Interfaces/IHttpRequest.h"
+#include "HAL/ThreadSafeBool.h"
+#include "ImageCacheSubsystem.generated.h"
+
+class UTexture2D;
+struct FTexturePlatformData;
+
+// Texture is null on failure, in which case Error says why
+DECLARE_DELEGATE_TwoParams(FOnCachedImageReady, UTexture2D* /*Texture*/, const FString& /*Error*/);
+
+UENUM(BlueprintType)
+enum class EImageRequestPriority : uint8
+{
+    Normal,
+    // Waits until no normal loads are in flight, used for full-resolution swaps
+    Low
+};
+
+// Maps a full-resolution URL to its thumbnail variant for one backend
+USTRUCT(BlueprintType)
+struct FImageThumbnailRule
+{
+    GENERATED_BODY()
+
+    // Rule applies to URLs starting with this
+    UPROPERTY(Config, EditAnywhere, BlueprintReadWrite, Category = "Image Cache")
+    FString UrlPrefix;
+
+    // Inserted before the file extension, e.g. "_thumb"
+    UPROPERTY(Config, EditAnywhere, BlueprintReadWrite, Category = "Image Cache")
+    FString FileSuffix;
+
+    // Appended to the query string, e.g. "w=160&q=60"
+    UPROPERTY(Config, EditAnywhere, BlueprintReadWrite, Category = "Image Cache")
+    FString QueryParameters;
+};
+
+USTRUCT(BlueprintType)
+struct FImageCacheStats
+{
+    GENERATED_BODY()
+
+    // Requests answered straight from memory
+    UPROPERTY(BlueprintReadOnly, Category = "Image Cache")
+    int32 MemoryHits = 0;
+
+    // Requests that joined a download or disk read already in flight
+    UPROPERTY(BlueprintReadOnly, Category = "Image Cache")
+    int32 CoalescedRequests = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Image Cache")
+    int32 DiskHits = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Image Cache")
+    int32 Downloads = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Image Cache")
+    int32 Evictions = 0;
+
+    // Loads dropped because every requester cancelled, including aborted downloads
+    UPROPERTY(BlueprintReadOnly, Category = "Image Cache")
+    int32 CancelledLoads = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Image Cache")
+    int32 CachedImages = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Image Cache")
+    int64 CachedBytes = 0;
+};
+
+USTRUCT()
+struct FCachedImage
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    TObjectPtr<UTexture2D> Texture = nullptr;
+
+    int64 SizeBytes = 0;
+    uint64 LastUsed = 0;
+};
+
+/**
+ * Shares downloaded images across widgets. Textures are kept in a URL-keyed
+ * LRU under a byte budget, compressed bytes optionally persist under
+ * Saved/ImageCache, and concurrent requests for one URL share a single
+ * download and decode.
+ */
+UCLASS(Config = Game)
+class SPORTBEACON_API UImageCacheSubsystem : public UGameInstanceSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    static UImageCacheSubsystem* Get(const UObject* WorldContextObject);
+
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    // Runs OnReady right away on a memory hit, otherwise once the shared load
+    // finishes. Returns a handle for CancelRequest, 0 if OnReady already ran.
+    // A non-zero MaxDimension downsamples on a worker so the longest side fits,
+    // rounded up to a power of two so nearby sizes share one texture.
+    uint64 RequestImage(const FString& URL, FOnCachedImageReady OnReady, int32 MaxDimension = 0,
+        EImageRequestPriority Priority = EImageRequestPriority::Normal);
+
+    // Drops the subscriber. The last one out aborts the download, if any.
+    void CancelRequest(uint64 RequestHandle);
+
+    // Thumbnail variant from the first matching ThumbnailRules entry, empty if none applies
+    FString GetThumbnailURL(const FString& URL) const;
+
+    // Memory lookup only, counts as a use for LRU purposes
+    UTexture2D* FindCachedImage(const FString& URL, int32 MaxDimension = 0);
+
+    UFUNCTION(BlueprintCallable, Category = "Image Cache")
+    void ClearMemoryCache();
+
+    UFUNCTION(BlueprintCallable, Category = "Image Cache")
+    FImageCacheStats GetCacheStats() const;
+
+    UPROPERTY(Config, EditAnywhere, Category = "Image Cache")
+    int32 MemoryBudgetMB = 64;
+
+    UPROPERTY(Config, EditAnywhere, Category = "Image Cache")
+    bool bEnableDiskCache = true;
+
+    // Disk entries older than this are removed on startup
+    UPROPERTY(Config, EditAnywhere, Category = "Image Cache")
+    int32 MaxDiskCacheAgeDays = 7;
+
+    UPROPERTY(Config, EditAnywhere, Category = "Image Cache")
+    TArray<FImageThumbnailRule> ThumbnailRules;
+
+    // Low priority loads allowed at once while the normal queue is idle
+    UPROPERTY(Config, EditAnywhere, Category = "Image Cache")
+    int32 MaxConcurrentLowPriorityLoads = 2;
+
+private:
+    // Fully built texture data, made on a worker and handed to the game thread
+    struct FDecodedImage
+    {
+        TUniquePtr<FTexturePlatformData> PlatformData;
+        int64 SizeBytes = 0;
+        FString Error;
+    };
+
+    struct FPendingImage
+    {
+        FString URL;
+        int32 MaxDimension = 0;
+        EImageRequestPriority Priority = EImageRequestPriority::Normal;
+        bool bStarted = false;
+        // Shared with workers so a cancelled load skips its decode and result
+        TSharedRef<FThreadSafeBool, ESPMode::ThreadSafe> bCancelled = MakeShared<FThreadSafeBool, ESPMode::ThreadSafe>(false);
+        TArray<TPair<uint64, FOnCachedImageReady>> Subscribers;
+    };
+
+    // Keyed by URL, so every size waiting on the same bytes shares one download
+    // and the disk file has a single writer
+    struct FPendingDownload
+    {
+        TSharedPtr<IHttpRequest, ESPMode::ThreadSafe> HttpRequest;
+        // Pending entries decoded from the response
+        TArray<FString> CacheKeys;
+    };
+
+    static int32 GetDimensionBucket(int32 MaxDimension);
+    static FString MakeCacheKey(const FString& URL, int32 DimensionBucket);
+
+    // Pending and cached entries are keyed by MakeCacheKey
+    void StartLoad(const FString& CacheKey);
+    void StartDownload(const FString& CacheKey);
+    void OnDownloadComplete(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSuccess, FString URL);
+    void FinishLoad(const FString& CacheKey, FDecodedImage&& Decoded);
+    void FailLoad(const FString& CacheKey, const FString& Error);
+
+    // Starts queued low priority loads while no normal ones are running
+    void PumpLowPriorityLoads();
+
+    // Decode, downsample and mip generation, worker-thread safe
+    static FDecodedImage DecodeImage(const TArray<uint8>& CompressedData, int32 MaxDimension);
+    FString GetDiskCachePath(const FString& URL) const;
+
+    UTexture2D* CreateTexture(FDecodedImage& Decoded);
+    void AddToCache(const FString& CacheKey, UTexture2D* Texture, int64 SizeBytes);
+    void EvictToBudget();
+
+    UPROPERTY()
+    TMap<FString, FCachedImage> CachedImages;
+
+    TMap<FString, FPendingImage> PendingImages;
+    TMap<FString, FPendingDownload> PendingDownloads;
+    TMap<uint64, FString> PendingHandles;
+    TArray<FString> LowPriorityQueue;
+
+    FString DiskCacheDirectory;
+    int64 CachedBytes = 0;
+    uint64 UseCounter = 0;
+    uint64 NextRequestHandle = 1;
+    FImageCacheStats Stats;
+};
@@ -1,16 +1,17 @@
 #include "ImageDisplayWidget.h"
+#include "ImageCacheSubsystem.h"
+#include "SportBeaconStats.h"
 #include "Engine/Texture2D.h"
-#include "IImageWrapper.h"
-#include "IImageWrapperModule.h"
-#include "Modules/ModuleManager.h"
-#include "Engine/TextureRenderTarget2D.h"
-#include "HttpModule.h"
-#include "Interfaces/IHttpResponse.h"
 
 UImageDisplayWidget::UImageDisplayWidget(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
+    , MaxImageDimension(1024)
+    , bProgressiveLoading(true)
     , bIsLoading(false)
     , bHoverEffectsEnabled(true)
+    , ImageRequestHandle(0)
+    , ThumbnailRequestHandle(0)
+    , bShowingFullImage(false)
 {
 }
 
@@ -30,6 +31,13 @@ void UImageDisplayWidget::NativeConstruct()
     UpdateLoadingState(false);
 }
 
+void UImageDisplayWidget::NativeDestruct()
+{
+    CancelImageRequest();
+
+    Super::NativeDestruct();
+}
+
 void UImageDisplayWidget::LoadImage(const FString& URL, const FString& ImageId, const FString& Title, const FString& Caption)
 {
     if (URL.IsEmpty())
@@ -58,88 +66,117 @@ void UImageDisplayWidget::LoadImage(const FString& URL, const FString& ImageId,
 
 void UImageDisplayWidget::LoadImageTexture()
 {
-    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FHttpModule::Get().CreateRequest();
-    HttpRequest->SetVerb(TEXT("GET"));
-    HttpRequest->SetURL(CurrentImageURL);
-    
-    HttpRequest->OnProcessRequestComplete().BindLambda([this](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSuccess)
+    // Whatever this widget asked for before is no longer wanted, which also
+    // aborts the download if no other widget is waiting on it
+    CancelImageRequest();
+    bShowingFullImage = false;
+
+    UImageCacheSubsystem* ImageCache = UImageCacheSubsystem::Get(this);
+    if (!ImageCache)
     {
-        if (!bSuccess || !Response.IsValid())
-        {
-            AsyncTask(ENamedThreads::GameThread, [this]()
-            {
-                HandleImageLoadError(TEXT("Failed to download image"));
-            });
-            return;
-        }
+        HandleImageLoadError(TEXT("Image cache unavailable"));
+        return;
+    }
 
-        // Load image data
-        TArray<uint8> ImageData = Response->GetContent();
-        IImageWrapperModule& ImageWrapperModule = FModuleManager::LoadModuleChecked<IImageWrapperModule>(FName("ImageWrapper"));
-        
-        // Detect image format
-        EImageFormat ImageFormat = ImageWrapperModule.DetectImageFormat(ImageData.GetData(), ImageData.Num());
-        if (ImageFormat == EImageFormat::Invalid)
-        {
-            AsyncTask(ENamedThreads::GameThread, [this]()
-            {
-                HandleImageLoadError(TEXT("Invalid image format"));
-            });
-            return;
-        }
+    const int32 TargetDimension = GetTargetImageDimension();
+
+    // Full resolution already in memory, or no thumbnail convention for this backend
+    const FString ThumbnailURL = bProgressiveLoading && !ImageCache->FindCachedImage(CurrentImageURL, TargetDimension)
+        ? ImageCache->GetThumbnailURL(CurrentImageURL)
+        : FString();
 
-        // Create image wrapper
-        TSharedPtr<IImageWrapper> ImageWrapper = ImageWrapperModule.CreateImageWrapper(ImageFormat);
-        if (!ImageWrapper.IsValid() || !ImageWrapper->SetCompressed(ImageData.GetData(), ImageData.Num()))
+    if (!ThumbnailURL.IsEmpty())
+    {
+        ThumbnailRequestHandle = ImageCache->RequestImage(ThumbnailURL,
+            FOnCachedImageReady::CreateUObject(this, &UImageDisplayWidget::OnThumbnailReady, CurrentImageURL),
+            TargetDimension);
+    }
+
+    // Cache hits call straight back, either way the widget is held weakly
+    ImageRequestHandle = ImageCache->RequestImage(CurrentImageURL,
+        FOnCachedImageReady::CreateUObject(this, &UImageDisplayWidget::OnCachedImageReady, CurrentImageURL),
+        TargetDimension,
+        ThumbnailURL.IsEmpty() ? EImageRequestPriority::Normal : EImageRequestPriority::Low);
+}
+
+int32 UImageDisplayWidget::GetTargetImageDimension() const
+{
+    // Before the first layout there is no size yet, so fall back to the cap
+    const FVector2D PixelSize = GetCachedGeometry().GetAbsoluteSize();
+    const int32 OnScreen = FMath::CeilToInt(FMath::Max(PixelSize.X, PixelSize.Y));
+
+    return OnScreen > 0 ? FMath::Min(OnScreen, MaxImageDimension) : MaxImageDimension;
+}
+
+void UImageDisplayWidget::CancelImageRequest()
+{
+    if (ImageRequestHandle != 0 || ThumbnailRequestHandle != 0)
+    {
+        if (UImageCacheSubsystem* ImageCache = UImageCacheSubsystem::Get(this))
         {
-            AsyncTask(ENamedThreads::GameThread, [this]()
-            {
-                HandleImageLoadError(TEXT("Failed to process image data"));
-            });
-            return;
+            ImageCache->CancelRequest(ImageRequestHandle);
+            ImageCache->CancelRequest(ThumbnailRequestHandle);
         }
+        ImageRequestHandle = 0;
+        ThumbnailRequestHandle = 0;
+    }
+}
 
-        // Create texture
-        const TArray<uint8>* RawData = nullptr;
-        if (!ImageWrapper->GetRaw(ERGBFormat::BGRA, 8, RawData))
+void UImageDisplayWidget::OnCachedImageReady(UTexture2D* LoadedTexture, const FString& ErrorMessage, FString RequestedURL)
+{
+    if (RequestedURL != CurrentImageURL)
+    {
+        return;
+    }
+
+    ImageRequestHandle = 0;
+
+    if (LoadedTexture)
+    {
+        bShowingFullImage = true;
+
+        // A thumbnail still loading has nothing left to add
+        if (ThumbnailRequestHandle != 0)
         {
-            AsyncTask(ENamedThreads::GameThread, [this]()
+            if (UImageCacheSubsystem* ImageCache = UImageCacheSubsystem::Get(this))
             {
-                HandleImageLoadError(TEXT("Failed to decode image"));
-            });
-            return;
+                ImageCache->CancelRequest(ThumbnailRequestHandle);
+            }
+            ThumbnailRequestHandle = 0;
         }
 
-        // Create texture on game thread
-        AsyncTask(ENamedThreads::GameThread, [this, RawData, ImageWrapper]()
-        {
-            UTexture2D* NewTexture = UTexture2D::CreateTransient(
-                ImageWrapper->GetWidth(),
-                ImageWrapper->GetHeight(),
-                PF_B8G8R8A8
-            );
+        HandleImageLoaded(LoadedTexture);
+    }
+    else
+    {
+        // A thumbnail already on screen stays there
+        HandleImageLoadError(ErrorMessage);
+    }
+}
 
-            if (NewTexture)
-            {
-                void* TextureData = NewTexture->PlatformData->Mips[0].BulkData.Lock(LOCK_READ_WRITE);
-                FMemory::Memcpy(TextureData, RawData->GetData(), RawData->Num());
-                NewTexture->PlatformData->Mips[0].BulkData.Unlock();
-                NewTexture->UpdateResource();
+void UImageDisplayWidget::OnThumbnailReady(UTexture2D* LoadedTexture, const FString& ErrorMessage, FString RequestedURL)
+{
+    SPORTBEACON_SCOPE_CYCLE(ImageDisplay);
 
-                HandleImageLoaded(NewTexture);
-            }
-            else
-            {
-                HandleImageLoadError(TEXT("Failed to create texture"));
-            }
-        });
-    });
+    if (RequestedURL != CurrentImageURL)
+    {
+        return;
+    }
+
+    ThumbnailRequestHandle = 0;
 
-    HttpRequest->ProcessRequest();
+    // A failed thumbnail is not an error, the full image is still on its way
+    if (LoadedTexture && !bShowingFullImage && ImageDisplay)
+    {
+        ImageDisplay->SetBrushFromTexture(LoadedTexture);
+        UpdateLoadingState(false);
+    }
 }
 
 void UImageDisplayWidget::HandleImageLoaded(UTexture2D* LoadedTexture)
 {
+    SPORTBEACON_SCOPE_CYCLE(ImageDisplay);
+
     if (ImageDisplay && LoadedTexture)
     {
         ImageDisplay->SetBrushFromTexture(LoadedTexture);
@@ -154,7 +191,7 @@ void UImageDisplayWidget::HandleImageLoadError(const FString& ErrorMessage)
     OnImageError.Broadcast(CurrentImageId, ErrorMessage);
 }
 
-void UImageDisplayWidget::SetImageDisplayMode(TEnumAsByte<EImageDisplayMode> Mode)
+void UImageDisplayWidget::SetImageDisplayMode(EImageDisplayMode Mode)
 {
     if (ImageDisplay)
     {
@@ -8,6 +8,14 @@
 #include "Components/Button.h"
 #include "ImageDisplayWidget.generated.h"
 
+UENUM(BlueprintType)
+enum class EImageDisplayMode : uint8
+{
+    Fit,
+    Fill,
+    Original
+};
+
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnImageClickedSignature, const FString&, ImageId);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnImageLoadedSignature, const FString&, ImageId);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnImageErrorSignature, const FString&, ImageId, const FString&, ErrorMessage);
@@ -29,7 +37,7 @@ public:
 
     // Set image display mode (fit, fill, etc.)
     UFUNCTION(BlueprintCallable, Category = "Image Display")
-    void SetImageDisplayMode(TEnumAsByte<EImageDisplayMode> Mode);
+    void SetImageDisplayMode(EImageDisplayMode Mode);
 
     // Enable/disable hover effects
     UFUNCTION(BlueprintCallable, Category = "Image Display")
@@ -37,6 +45,7 @@ public:
 
 protected:
     virtual void NativeConstruct() override;
+    virtual void NativeDestruct() override;
     virtual void NativeTick(const FGeometry& MyGeometry, float InDeltaTime) override;
 
     // UI Components
@@ -55,6 +64,14 @@ protected:
     UPROPERTY(BlueprintReadWrite, meta = (BindWidget))
     UButton* ImageButton;
 
+    // Longest side decoded for this widget, further capped by its on-screen size once laid out
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Image Display")
+    int32 MaxImageDimension;
+
+    // Show the backend's thumbnail variant first and swap in full resolution once the cache is idle
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Image Display")
+    bool bProgressiveLoading;
+
     // Delegates
     UPROPERTY(BlueprintAssignable, Category = "Image Display|Events")
     FOnImageClickedSignature OnImageClicked;
@@ -72,8 +89,17 @@ private:
     bool bIsLoading;
     bool bHoverEffectsEnabled;
 
-    // Async texture loading
+    // Outstanding UImageCacheSubsystem request, 0 when none
+    uint64 ImageRequestHandle;
+    uint64 ThumbnailRequestHandle;
+    bool bShowingFullImage;
+
+    // Async texture loading, shared with every other widget showing the same URL
     void LoadImageTexture();
+    void CancelImageRequest();
+    int32 GetTargetImageDimension() const;
+    void OnCachedImageReady(UTexture2D* LoadedTexture, const FString& ErrorMessage, FString RequestedURL);
+    void OnThumbnailReady(UTexture2D* LoadedTexture, const FString& ErrorMessage, FString RequestedURL);
     void HandleImageLoaded(UTexture2D* LoadedTexture);
     void HandleImageLoadError(const FString& ErrorMessage);
 
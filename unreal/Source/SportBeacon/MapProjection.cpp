@@ -0,0 +1,96 @@
+#include "MapProjection.h"
+
+namespace
+{
+    // Web Mercator is undefined at the poles, clamp to its usual square extent
+    constexpr double MaxMercatorLatitude = 85.05112878;
+}
+
+FMapProjection::FMapProjection(double InWorldScale)
+    : WorldScale(InWorldScale)
+    , Origin(FVector2D::ZeroVector)
+    , OriginMercatorY(0.0)
+    , Revision(1)
+{
+}
+
+void FMapProjection::SetWorldScale(double InWorldScale)
+{
+    if (InWorldScale != WorldScale && InWorldScale > 0.0)
+    {
+        WorldScale = InWorldScale;
+        ++Revision;
+    }
+}
+
+void FMapProjection::SetOrigin(const FVector2D& InOrigin)
+{
+    Origin = InOrigin;
+    OriginMercatorY = MercatorY(InOrigin.Y);
+    ++Revision;
+}
+
+FVector FMapProjection::Project(const FVector2D& Coordinates) const
+{
+    return FVector(
+        (Coordinates.X - Origin.X) * WorldScale,
+        (MercatorY(Coordinates.Y) - OriginMercatorY) * WorldScale,
+        0.0);
+}
+
+FVector2D FMapProjection::Unproject(const FVector& Location) const
+{
+    const double Longitude = Location.X / WorldScale + Origin.X;
+    const double Mercator = Location.Y / WorldScale + OriginMercatorY;
+    const double Latitude = FMath::RadiansToDegrees(2.0 * FMath::Atan(FMath::Exp(Mercator)) - UE_DOUBLE_HALF_PI);
+
+    return FVector2D(Longitude, Latitude);
+}
+
+void FMapProjection::ProjectBatch(TArrayView<const FVector2D> Coordinates, TArrayView<FVector> OutLocations) const
+{
+    check(OutLocations.Num() >= Coordinates.Num());
+
+    // Origin offsets are computed once for the whole batch rather than per coordinate
+    const double OffsetX = -Origin.X * WorldScale;
+    const double OffsetY = -OriginMercatorY * WorldScale;
+
+    const int32 Num = Coordinates.Num();
+    for (int32 Index = 0; Index < Num; ++Index)
+    {
+        OutLocations[Index] = FVector(
+            Coordinates[Index].X * WorldScale + OffsetX,
+            MercatorY(Coordinates[Index].Y) * WorldScale + OffsetY,
+            0.0);
+    }
+}
+
+double FMapProjection::MercatorY(double Latitude)
+{
+    // ln(tan(pi/4 + lat/2)), written with a single sin and log
+    const double SinLatitude = FMath::Sin(FMath::DegreesToRadians(FMath::Clamp(Latitude, -MaxMercatorLatitude, MaxMercatorLatitude)));
+    return 0.5 * FMath::Loge((1.0 + SinLatitude) / (1.0 - SinLatitude));
+}
+
+const FVector& FMapProjectionCache::Project(const FMapProjection& Projection, const FString& Id, const FVector2D& Coordinates)
+{
+    FEntry& Entry = Entries.FindOrAdd(Id);
+    if (Entry.Revision != Projection.GetRevision() || Entry.Coordinates != Coordinates)
+    {
+        Entry.Coordinates = Coordinates;
+        Entry.Location = Projection.Project(Coordinates);
+        Entry.Revision = Projection.GetRevision();
+    }
+
+    return Entry.Location;
+}
+
+void FMapProjectionCache::Remove(const FString& Id)
+{
+    Entries.Remove(Id);
+}
+
+void FMapProjectionCache::Reset()
+{
+    Entries.Reset();
+}
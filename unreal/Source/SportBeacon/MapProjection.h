@@ -0,0 +1,57 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Web Mercator projection of map coordinates (X = longitude, Y = latitude in
+// degrees) into world space, in double precision and relative to a movable
+// origin so markers far from the world origin do not jitter.
+class SPORTBEACON_API FMapProjection
+{
+public:
+    explicit FMapProjection(double InWorldScale = 100.0);
+
+    // World units per degree of longitude
+    void SetWorldScale(double InWorldScale);
+    double GetWorldScale() const { return WorldScale; }
+
+    // Coordinates that project to world (0, 0)
+    void SetOrigin(const FVector2D& InOrigin);
+    const FVector2D& GetOrigin() const { return Origin; }
+
+    // Starts at 1 and bumps whenever the origin or scale changes, so cached locations can tell they are stale
+    uint32 GetRevision() const { return Revision; }
+
+    FVector Project(const FVector2D& Coordinates) const;
+    FVector2D Unproject(const FVector& Location) const;
+
+    // Projects many coordinates in one pass, OutLocations must be at least as long as Coordinates
+    void ProjectBatch(TArrayView<const FVector2D> Coordinates, TArrayView<FVector> OutLocations) const;
+
+private:
+    static double MercatorY(double Latitude);
+
+    double WorldScale;
+    FVector2D Origin;
+    double OriginMercatorY;
+    uint32 Revision;
+};
+
+// Projected location per record, reprojected only when its coordinates or
+// the projection change.
+class SPORTBEACON_API FMapProjectionCache
+{
+public:
+    const FVector& Project(const FMapProjection& Projection, const FString& Id, const FVector2D& Coordinates);
+    void Remove(const FString& Id);
+    void Reset();
+
+private:
+    struct FEntry
+    {
+        FVector2D Coordinates = FVector2D::ZeroVector;
+        FVector Location = FVector::ZeroVector;
+        uint32 Revision = 0;
+    };
+
+    TMap<FString, FEntry> Entries;
+};
@@ -0,0 +1,325 @@
+#include "MapSpatialIndex.h"
+
+namespace
+{
+    constexpr double EarthRadiusKm = 6371.0;
+    constexpr double KmPerDegreeLatitude = 111.32;
+
+    // Kilometres per degree of longitude at a latitude, floored so polar queries stay bounded
+    double KmPerDegreeLongitude(double Latitude)
+    {
+        return KmPerDegreeLatitude * FMath::Max(FMath::Cos(FMath::DegreesToRadians(Latitude)), 0.01);
+    }
+
+    struct FRankedId
+    {
+        double DistanceKm;
+        const FString* Id;
+
+        bool operator<(const FRankedId& Other) const { return DistanceKm < Other.DistanceKm; }
+    };
+}
+
+FMapSpatialIndex::FMapSpatialIndex(double InCellSize)
+    : CellSize(FMath::Max(InCellSize, KINDA_SMALL_NUMBER))
+{
+}
+
+void FMapSpatialIndex::SetCellSize(double InCellSize)
+{
+    InCellSize = FMath::Max(InCellSize, KINDA_SMALL_NUMBER);
+    if (InCellSize == CellSize)
+    {
+        return;
+    }
+
+    CellSize = InCellSize;
+
+    // Re-bucket everything under the new cell size
+    Cells.Reset();
+    for (auto& Entry : Entries)
+    {
+        Entry.Value.Cell = GetCell(Entry.Value.Coordinates);
+        Cells.FindOrAdd(Entry.Value.Cell).Add(Entry.Key);
+    }
+}
+
+void FMapSpatialIndex::Reset()
+{
+    Entries.Reset();
+    Cells.Reset();
+}
+
+void FMapSpatialIndex::Update(const FString& Id, const FVector2D& Coordinates)
+{
+    const FIntPoint Cell = GetCell(Coordinates);
+
+    if (FEntry* Existing = Entries.Find(Id))
+    {
+        Existing->Coordinates = Coordinates;
+        if (Existing->Cell != Cell)
+        {
+            RemoveFromCell(Id, Existing->Cell);
+            Existing->Cell = Cell;
+            Cells.FindOrAdd(Cell).Add(Id);
+        }
+        return;
+    }
+
+    FEntry& Entry = Entries.Add(Id);
+    Entry.Coordinates = Coordinates;
+    Entry.Cell = Cell;
+    Cells.FindOrAdd(Cell).Add(Id);
+}
+
+void FMapSpatialIndex::Remove(const FString& Id)
+{
+    FEntry Entry;
+    if (Entries.RemoveAndCopyValue(Id, Entry))
+    {
+        RemoveFromCell(Id, Entry.Cell);
+    }
+}
+
+const FVector2D* FMapSpatialIndex::FindCoordinates(const FString& Id) const
+{
+    const FEntry* Entry = Entries.Find(Id);
+    return Entry ? &Entry->Coordinates : nullptr;
+}
+
+void FMapSpatialIndex::QueryRect(const FBox2D& Bounds, TArray<FString>& OutIds) const
+{
+    if (!Bounds.bIsValid)
+    {
+        return;
+    }
+
+    const FIntPoint MinCell = GetCell(Bounds.Min);
+    const FIntPoint MaxCell = GetCell(Bounds.Max);
+    const int64 CellsInBounds = int64(MaxCell.X - MinCell.X + 1) * int64(MaxCell.Y - MinCell.Y + 1);
+
+    auto CollectCell = [&](const TArray<FString>& CellIds, bool bFullyInside)
+    {
+        for (const FString& Id : CellIds)
+        {
+            if (bFullyInside || Bounds.IsInside(Entries[Id].Coordinates))
+            {
+                OutIds.Add(Id);
+            }
+        }
+    };
+
+    // Zoomed far out the rect covers more cells than are occupied, so walk the occupied ones
+    if (CellsInBounds > Cells.Num())
+    {
+        for (const auto& Cell : Cells)
+        {
+            if (Cell.Key.X >= MinCell.X && Cell.Key.X <= MaxCell.X && Cell.Key.Y >= MinCell.Y && Cell.Key.Y <= MaxCell.Y)
+            {
+                CollectCell(Cell.Value, false);
+            }
+        }
+        return;
+    }
+
+    for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+    {
+        for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+        {
+            if (const TArray<FString>* CellIds = Cells.Find(FIntPoint(X, Y)))
+            {
+                // Interior cells cannot contain anything outside the bounds
+                const bool bInterior = X > MinCell.X && X < MaxCell.X && Y > MinCell.Y && Y < MaxCell.Y;
+                CollectCell(*CellIds, bInterior);
+            }
+        }
+    }
+}
+
+void FMapSpatialIndex::QueryRadius(const FVector2D& Center, double RadiusKm, TArray<FString>& OutIds) const
+{
+    if (RadiusKm <= 0.0)
+    {
+        return;
+    }
+
+    // Coarse pass on the bounding box in degrees, then exact distances
+    const FVector2D HalfExtent(RadiusKm / KmPerDegreeLongitude(Center.Y), RadiusKm / KmPerDegreeLatitude);
+    TArray<FString> Candidates;
+    QueryRect(FBox2D(Center - HalfExtent, Center + HalfExtent), Candidates);
+
+    TArray<FRankedId> Ranked;
+    Ranked.Reserve(Candidates.Num());
+    for (const FString& Id : Candidates)
+    {
+        const double Distance = DistanceKm(Center, Entries[Id].Coordinates);
+        if (Distance <= RadiusKm)
+        {
+            Ranked.Add({ Distance, &Id });
+        }
+    }
+    Ranked.Sort();
+
+    OutIds.Reserve(OutIds.Num() + Ranked.Num());
+    for (const FRankedId& Entry : Ranked)
+    {
+        OutIds.Add(*Entry.Id);
+    }
+}
+
+void FMapSpatialIndex::QueryNearest(const FVector2D& Center, int32 Count, TArray<FString>& OutIds) const
+{
+    if (Count <= 0 || Entries.Num() == 0)
+    {
+        return;
+    }
+
+    const FIntPoint CenterCell = GetCell(Center);
+    TArray<FRankedId> Ranked;
+    int32 Visited = 0;
+
+    // Walk rings of cells outwards until nothing unvisited can beat the current Count-th best
+    for (int32 Ring = 0; Visited < Entries.Num(); ++Ring)
+    {
+        // Sparse grids would need huge rings, at that point ranking everything is cheaper
+        if (int64(2 * Ring + 1) * int64(2 * Ring + 1) > 4 * int64(Cells.Num()))
+        {
+            Ranked.Reset(Entries.Num());
+            for (const auto& Entry : Entries)
+            {
+                Ranked.Add({ DistanceKm(Center, Entry.Value.Coordinates), &Entry.Key });
+            }
+            break;
+        }
+
+        for (int32 Y = CenterCell.Y - Ring; Y <= CenterCell.Y + Ring; ++Y)
+        {
+            // Interior rows only contribute their two edge cells
+            const bool bEdgeRow = Y == CenterCell.Y - Ring || Y == CenterCell.Y + Ring;
+            const int32 Step = bEdgeRow ? 1 : FMath::Max(2 * Ring, 1);
+            for (int32 X = CenterCell.X - Ring; X <= CenterCell.X + Ring; X += Step)
+            {
+                if (const TArray<FString>* CellIds = Cells.Find(FIntPoint(X, Y)))
+                {
+                    for (const FString& Id : *CellIds)
+                    {
+                        Ranked.Add({ DistanceKm(Center, Entries[Id].Coordinates), &Id });
+                    }
+                    Visited += CellIds->Num();
+                }
+            }
+        }
+
+        if (Ranked.Num() >= Count)
+        {
+            // Anything outside this ring is at least Ring cells away on one axis
+            const double FarLatitude = FMath::Min(FMath::Abs(Center.Y) + (Ring + 1) * CellSize, 90.0);
+            const double MinUnvisitedKm = Ring * CellSize * FMath::Min(KmPerDegreeLatitude, KmPerDegreeLongitude(FarLatitude));
+
+            Ranked.Sort();
+            if (Ranked[Count - 1].DistanceKm <= MinUnvisitedKm)
+            {
+                break;
+            }
+        }
+    }
+
+    Ranked.Sort();
+    const int32 NumResults = FMath::Min(Count, Ranked.Num());
+    OutIds.Reserve(OutIds.Num() + NumResults);
+    for (int32 Index = 0; Index < NumResults; ++Index)
+    {
+        OutIds.Add(*Ranked[Index].Id);
+    }
+}
+
+double FMapSpatialIndex::DistanceKm(const FVector2D& A, const FVector2D& B)
+{
+    // Haversine
+    const double LatA = FMath::DegreesToRadians(A.Y);
+    const double LatB = FMath::DegreesToRadians(B.Y);
+    const double SinHalfLat = FMath::Sin((LatB - LatA) * 0.5);
+    const double SinHalfLong = FMath::Sin(FMath::DegreesToRadians(B.X - A.X) * 0.5);
+
+    const double H = SinHalfLat * SinHalfLat + FMath::Cos(LatA) * FMath::Cos(LatB) * SinHalfLong * SinHalfLong;
+    return 2.0 * EarthRadiusKm * FMath::Asin(FMath::Sqrt(FMath::Clamp(H, 0.0, 1.0)));
+}
+
+FIntPoint FMapSpatialIndex::GetCell(const FVector2D& Coordinates) const
+{
+    return FIntPoint(
+        FMath::FloorToInt(Coordinates.X / CellSize),
+        FMath::FloorToInt(Coordinates.Y / CellSize));
+}
+
+void FMapSpatialIndex::RemoveFromCell(const FString& Id, const FIntPoint& Cell)
+{
+    if (TArray<FString>* CellIds = Cells.Find(Cell))
+    {
+        CellIds->RemoveSingleSwap(Id, false);
+        if (CellIds->Num() == 0)
+        {
+            Cells.Remove(Cell);
+        }
+    }
+}
+
+void FMapClusterGrid::Reset(double InCellSize)
+{
+    CellSize = FMath::Max(InCellSize, KINDA_SMALL_NUMBER);
+    Members.Reset();
+    Cells.Reset();
+}
+
+void FMapClusterGrid::Update(const FString& Id, const FVector2D& Coordinates)
+{
+    const FIntPoint Cell = GetCell(Coordinates);
+
+    if (FMember* Existing = Members.Find(Id))
+    {
+        RemoveFromCell(Existing->Cell, Existing->Coordinates);
+        Existing->Coordinates = Coordinates;
+        Existing->Cell = Cell;
+    }
+    else
+    {
+        Members.Add(Id, { Coordinates, Cell });
+    }
+
+    FCell& Target = Cells.FindOrAdd(Cell);
+    ++Target.Count;
+    Target.CoordinateSum += Coordinates;
+}
+
+void FMapClusterGrid::Remove(const FString& Id)
+{
+    FMember Member;
+    if (Members.RemoveAndCopyValue(Id, Member))
+    {
+        RemoveFromCell(Member.Cell, Member.Coordinates);
+    }
+}
+
+const FMapClusterGrid::FCell* FMapClusterGrid::FindCell(const FVector2D& Coordinates) const
+{
+    return Cells.Find(GetCell(Coordinates));
+}
+
+FIntPoint FMapClusterGrid::GetCell(const FVector2D& Coordinates) const
+{
+    return FIntPoint(
+        FMath::FloorToInt(Coordinates.X / CellSize),
+        FMath::FloorToInt(Coordinates.Y / CellSize));
+}
+
+void FMapClusterGrid::RemoveFromCell(const FIntPoint& Cell, const FVector2D& Coordinates)
+{
+    if (FCell* Existing = Cells.Find(Cell))
+    {
+        Existing->CoordinateSum -= Coordinates;
+        if (--Existing->Count <= 0)
+        {
+            Cells.Remove(Cell);
+        }
+    }
+}
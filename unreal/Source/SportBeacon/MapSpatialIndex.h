@@ -0,0 +1,89 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Uniform grid over map coordinates (X = longitude, Y = latitude in degrees).
+// Lets the map cull to the viewport and answer proximity queries without
+// scanning every record.
+class SPORTBEACON_API FMapSpatialIndex
+{
+public:
+    explicit FMapSpatialIndex(double InCellSize = 0.25);
+
+    // Changing the cell size rebuilds the grid from the stored entries
+    void SetCellSize(double InCellSize);
+    double GetCellSize() const { return CellSize; }
+
+    void Reset();
+
+    // Inserts the entry, or moves it if it is already indexed
+    void Update(const FString& Id, const FVector2D& Coordinates);
+    void Remove(const FString& Id);
+
+    const FVector2D* FindCoordinates(const FString& Id) const;
+    int32 Num() const { return Entries.Num(); }
+
+    // Every entry inside the bounds, in no particular order
+    void QueryRect(const FBox2D& Bounds, TArray<FString>& OutIds) const;
+
+    // Entries within RadiusKm of Center, nearest first
+    void QueryRadius(const FVector2D& Center, double RadiusKm, TArray<FString>& OutIds) const;
+
+    // Up to Count entries closest to Center, nearest first
+    void QueryNearest(const FVector2D& Center, int32 Count, TArray<FString>& OutIds) const;
+
+    // Great-circle distance between two coordinates
+    static double DistanceKm(const FVector2D& A, const FVector2D& B);
+
+private:
+    struct FEntry
+    {
+        FVector2D Coordinates;
+        FIntPoint Cell;
+    };
+
+    FIntPoint GetCell(const FVector2D& Coordinates) const;
+    void RemoveFromCell(const FString& Id, const FIntPoint& Cell);
+
+    double CellSize;
+    TMap<FString, FEntry> Entries;
+    TMap<FIntPoint, TArray<FString>> Cells;
+};
+
+// Running per-cell member counts and centroids on a coarse grid, kept up to
+// date one member at a time so clusters never need a full recount while
+// markers move.
+class SPORTBEACON_API FMapClusterGrid
+{
+public:
+    struct FCell
+    {
+        int32 Count = 0;
+        FVector2D CoordinateSum = FVector2D::ZeroVector;
+
+        FVector2D GetCentroid() const { return Count > 0 ? CoordinateSum / Count : FVector2D::ZeroVector; }
+    };
+
+    // Drops every member and switches to the new cell size
+    void Reset(double InCellSize);
+
+    void Update(const FString& Id, const FVector2D& Coordinates);
+    void Remove(const FString& Id);
+
+    const FCell* FindCell(const FVector2D& Coordinates) const;
+    const TMap<FIntPoint, FCell>& GetCells() const { return Cells; }
+
+private:
+    struct FMember
+    {
+        FVector2D Coordinates;
+        FIntPoint Cell;
+    };
+
+    FIntPoint GetCell(const FVector2D& Coordinates) const;
+    void RemoveFromCell(const FIntPoint& Cell, const FVector2D& Coordinates);
+
+    double CellSize = 1.0;
+    TMap<FString, FMember> Members;
+    TMap<FIntPoint, FCell> Cells;
+};
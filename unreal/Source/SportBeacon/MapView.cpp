@@ -1,9 +1,38 @@
 #include "MapView.h"
-#include "Engine/StaticMeshActor.h"
-#include "Materials/MaterialInstanceDynamic.h"
+#include "SportBeaconStats.h"
+#include "Components/HierarchicalInstancedStaticMeshComponent.h"
 #include "Components/WidgetComponent.h"
+#include "Blueprint/UserWidget.h"
 #include "Kismet/GameplayStatics.h"
 #include "TimerManager.h"
+#include "Materials/MaterialParameterCollection.h"
+#include "Materials/MaterialParameterCollectionInstance.h"
+#include "Serialization/MemoryReader.h"
+
+namespace
+{
+    // Everything a coordinate can be, used as the cull region when culling is off
+    const FBox2D WholeWorldBounds(FVector2D(-181.0f, -91.0f), FVector2D(181.0f, 91.0f));
+
+    // FBox2D::IsInside is strict, this counts a box sharing an edge as contained
+    bool ContainsBox(const FBox2D& Outer, const FBox2D& Inner)
+    {
+        return Inner.Min.X >= Outer.Min.X && Inner.Min.Y >= Outer.Min.Y
+            && Inner.Max.X <= Outer.Max.X && Inner.Max.Y <= Outer.Max.Y;
+    }
+
+    // Rebuilds an Id -> slot index for any record array with an Id field
+    template <typename RecordType>
+    void RebuildIdIndex(const TArray<RecordType>& Records, TMap<FString, int32>& OutIndex)
+    {
+        OutIndex.Reset();
+        OutIndex.Reserve(Records.Num());
+        for (int32 Index = 0; Index < Records.Num(); ++Index)
+        {
+            OutIndex.Add(Records[Index].Id, Index);
+        }
+    }
+}
 
 AMapView::AMapView()
 {
@@ -18,12 +47,56 @@ AMapView::AMapView()
     MapCamera->SetRelativeLocation(FVector(0.0f, 0.0f, 1000.0f));
     MapCamera->SetRelativeRotation(FRotator(-90.0f, 0.0f, 0.0f));
 
+    // Tooltip lives in world space so it stays put while the map root pans
+    MarkerTooltip = CreateDefaultSubobject<UWidgetComponent>(TEXT("MarkerTooltip"));
+    MarkerTooltip->SetupAttachment(MapRoot);
+    MarkerTooltip->SetUsingAbsoluteLocation(true);
+    MarkerTooltip->SetWidgetSpace(EWidgetSpace::Screen);
+    MarkerTooltip->SetVisibility(false);
+
+    // Bubbles are rebuilt wholesale when counts change, so a plain ISM avoids HISM tree rebuilds
+    ClusterMarkers = CreateDefaultSubobject<UInstancedStaticMeshComponent>(TEXT("ClusterMarkers"));
+    ClusterMarkers->SetupAttachment(MapRoot);
+    ClusterMarkers->SetUsingAbsoluteLocation(true);
+    ClusterMarkers->SetUsingAbsoluteRotation(true);
+    ClusterMarkers->SetUsingAbsoluteScale(true);
+    ClusterMarkers->SetMobility(EComponentMobility::Movable);
+    ClusterMarkers->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+    ClusterMarkers->SetCollisionResponseToAllChannels(ECR_Block);
+
     // Initialize default values
     MinZoom = 500.0f;
     MaxZoom = 5000.0f;
     ZoomSpeed = 100.0f;
     PanSpeed = 1.0f;
     RotationSpeed = 1.0f;
+    bInterpolatePlayerLocations = true;
+    DefaultLocationInterpolationTime = 0.25f;
+    MaxLocationInterpolationTime = 1.0f;
+    MarkerPoolWarmupSize = 64;
+    PoolHits = 0;
+    PoolMisses = 0;
+    ProjectionWorldScale = 100.0f;
+    RebaseDistance = 2000.0f;
+    bEnableViewportCulling = true;
+    CullingMargin = 1.5f;
+    SpatialIndexCellSize = 0.25f;
+    CullBounds = FBox2D(ForceInit);
+    DirtyCullingTypes = 0;
+    MinClusterSize = 4;
+    MarkerAnimationParameters = nullptr;
+    PulseParameterName = TEXT("MarkerPulse");
+    FadeParameterName = TEXT("MarkerFade");
+    ActiveClusterBand = INDEX_NONE;
+    bClustersDirty = false;
+
+    FMapClusterBand& FarBand = ClusterBands.AddDefaulted_GetRef();
+    FarBand.MinZoom = 2500.0f;
+    FarBand.CellSize = 1.0f;
+
+    FMapClusterBand& MidBand = ClusterBands.AddDefaulted_GetRef();
+    MidBand.MinZoom = 1200.0f;
+    MidBand.CellSize = 0.25f;
     CurrentZoom = 1000.0f;
     MapCenter = FVector2D::ZeroVector;
 }
@@ -31,29 +104,79 @@ AMapView::AMapView()
 void AMapView::BeginPlay()
 {
     Super::BeginPlay();
-    
+
     // Set initial camera position
     MapCamera->SetRelativeLocation(FVector(0.0f, 0.0f, CurrentZoom));
-    
+
+    if (TooltipWidgetClass)
+    {
+        MarkerTooltip->SetWidgetClass(TooltipWidgetClass);
+    }
+
+    ClusterMarkers->SetWorldTransform(FTransform::Identity);
+    ClusterMarkers->SetNumCustomDataFloats(MapClusterCustomData::Num);
+    if (ClusterMarkerMesh)
+    {
+        ClusterMarkers->SetStaticMesh(ClusterMarkerMesh);
+    }
+    if (ClusterMaterial)
+    {
+        ClusterMarkers->SetMaterial(0, ClusterMaterial);
+    }
+
+    Projection.SetWorldScale(ProjectionWorldScale);
+    Projection.SetOrigin(MapCenter);
+
+    VenueSpatialIndex.SetCellSize(SpatialIndexCellSize);
+    PlayerSpatialIndex.SetCellSize(SpatialIndexCellSize);
+    EventSpatialIndex.SetCellSize(SpatialIndexCellSize);
+    HighlightSpatialIndex.SetCellSize(SpatialIndexCellSize);
+
     // Spawn initial markers if we have venue data
+    RebuildIdIndex(Venues, VenueIndexById);
+    for (const FVenueData& Venue : Venues)
+    {
+        IndexRecord(EMarkerType::Venue, Venue.Id, Venue.Coordinates);
+    }
+    CullBounds = bEnableViewportCulling ? GetViewCoordinateBounds(CullingMargin) : WholeWorldBounds;
+    UpdateClusterBand();
+    WarmUpMarkerPools();
     SpawnVenueMarkers();
 }
 
 void AMapView::Tick(float DeltaTime)
 {
+    SPORTBEACON_SCOPE_CYCLE(MapTick);
+
     Super::Tick(DeltaTime);
+
+    UpdateProjectionOrigin();
+    UpdateMarkerCulling();
+    UpdatePlayerLocationTracks();
+    UpdateMarkerAnimations();
+
+    if (bClustersDirty)
+    {
+        RebuildClusterMarkers();
+    }
 }
 
 void AMapView::ZoomIn(float Delta)
 {
-    float NewZoom = FMath::Clamp(CurrentZoom - Delta * ZoomSpeed, MinZoom, MaxZoom);
-    float ZoomDelta = NewZoom - CurrentZoom;
-    CurrentZoom = NewZoom;
-    
+    SetZoom(CurrentZoom - Delta * ZoomSpeed);
+}
+
+void AMapView::SetZoom(float NewZoom)
+{
+    CurrentZoom = FMath::Clamp(NewZoom, MinZoom, MaxZoom);
+
     // Update camera position
     FVector CameraLocation = MapCamera->GetRelativeLocation();
     CameraLocation.Z = CurrentZoom;
     MapCamera->SetRelativeLocation(CameraLocation);
+
+    UpdateMarkerVisuals();
+    UpdateClusterBand();
 }
 
 void AMapView::ZoomOut(float Delta)
@@ -68,7 +191,7 @@ void AMapView::PanCamera(const FVector2D& PanDelta)
     FVector NewLocation = MapRoot->GetRelativeLocation();
     NewLocation.X += PanDelta.X * PanSpeed * PanScale;
     NewLocation.Y += PanDelta.Y * PanSpeed * PanScale;
-    
+
     MapRoot->SetRelativeLocation(NewLocation);
     MapCenter += FVector2D(PanDelta.X, PanDelta.Y) * PanScale;
 }
@@ -80,635 +203,1693 @@ void AMapView::RotateCamera(float YawDelta)
     MapCamera->SetRelativeRotation(NewRotation);
 }
 
+FVector2D AMapView::GetMapCenter() const
+{
+    return MapCamera ? WorldLocationToLatLong(MapCamera->GetComponentLocation()) : MapCenter;
+}
+
 void AMapView::UpdateVenues(const TArray<FVenueData>& NewVenues)
 {
-    // Clear existing markers
-    for (auto& Marker : VenueMarkers)
+    SPORTBEACON_SCOPE_CYCLE(MapMarkerUpdate);
+    FMarkerUpdateStats Stats;
+
+    TSet<FString> IncomingIds;
+    IncomingIds.Reserve(NewVenues.Num());
+    for (const FVenueData& Venue : NewVenues)
     {
-        if (Marker.Value)
-        {
-            Marker.Value->Destroy();
-        }
+        IncomingIds.Add(Venue.Id);
     }
-    VenueMarkers.Empty();
-    
-    // Update venue data
-    Venues = NewVenues;
-    
-    // Spawn new markers
-    SpawnVenueMarkers();
-}
 
-void AMapView::SelectVenue(const FString& VenueId)
-{
+    // Remove stale markers first so their slots get recycled by new venues
     for (const FVenueData& Venue : Venues)
     {
-        if (Venue.Id == VenueId)
+        if (!IncomingIds.Contains(Venue.Id))
         {
-            OnVenueSelected.Broadcast(Venue);
-            
-            // Highlight selected venue marker
-            if (AActor* Marker = VenueMarkers.FindRef(VenueId))
-            {
-                // TODO: Implement marker highlight effect
-            }
-            break;
+            RemoveMarkerInstance(EMarkerType::Venue, Venue.Id);
+            UnindexRecord(EMarkerType::Venue, Venue.Id);
+            ++Stats.Removed;
         }
     }
-}
 
-void AMapView::SpawnVenueMarkers()
-{
-    if (!DefaultVenueMarker)
+    // Restyle changed markers and spawn new ones
+    TArray<FString> MovedVenueIds;
+    for (const FVenueData& Venue : NewVenues)
     {
-        UE_LOG(LogTemp, Warning, TEXT("DefaultVenueMarker not set in MapView"));
-        return;
-    }
+        IndexRecord(EMarkerType::Venue, Venue.Id, Venue.Coordinates);
 
-    for (const FVenueData& Venue : Venues)
-    {
-        // Convert lat/long to world location
-        FVector Location = LatLongToWorldLocation(Venue.Coordinates);
-        
-        // Spawn marker actor
-        FActorSpawnParameters SpawnParams;
-        SpawnParams.Owner = this;
-        
-        AStaticMeshActor* MarkerActor = GetWorld()->SpawnActor<AStaticMeshActor>(
-            AStaticMeshActor::StaticClass(),
-            Location,
-            FRotator::ZeroRotator,
-            SpawnParams
-        );
-        
-        if (MarkerActor)
-        {
-            // Setup marker
-            MarkerActor->SetMobility(EComponentMobility::Movable);
-            MarkerActor->GetStaticMeshComponent()->SetStaticMesh(DefaultVenueMarker);
-            
-            // Apply appropriate material
-            UMaterialInterface* MaterialToUse = Venue.bIsIndoor ? IndoorVenueMaterial : OutdoorVenueMaterial;
-            if (MaterialToUse)
-            {
-                UMaterialInstanceDynamic* DynamicMaterial = UMaterialInstanceDynamic::Create(MaterialToUse, this);
-                MarkerActor->GetStaticMeshComponent()->SetMaterial(0, DynamicMaterial);
-            }
-            
-            // Store reference
-            VenueMarkers.Add(Venue.Id, MarkerActor);
-            
-            // Setup click handling
-            MarkerActor->Tags.Add(FName(*Venue.Id));
+        const int32* ExistingIndex = VenueIndexById.Find(Venue.Id);
+        if (!ExistingIndex)
+        {
+            // Events may have arrived before their venue
+            MovedVenueIds.Add(Venue.Id);
+            SpawnVenueMarker(Venue);
+            ++Stats.Added;
+            continue;
         }
-    }
-}
 
-void AMapView::UpdateMarkerVisuals()
-{
-    // Update marker scale based on zoom level
-    float Scale = FMath::GetMappedRangeValueClamped(
-        FVector2D(MinZoom, MaxZoom),
-        FVector2D(0.5f, 2.0f),
-        CurrentZoom
-    );
-    
-    for (auto& Marker : VenueMarkers)
-    {
-        if (AStaticMeshActor* MarkerActor = Cast<AStaticMeshActor>(Marker.Value))
+        const FVenueData& OldVenue = Venues[*ExistingIndex];
+        if (!OldVenue.Coordinates.Equals(Venue.Coordinates))
+        {
+            MovedVenueIds.Add(Venue.Id);
+        }
+
+        if (ReconcileVenueMarker(OldVenue, Venue))
+        {
+            ++Stats.Changed;
+        }
+        else
         {
-            MarkerActor->SetActorScale3D(FVector(Scale));
+            ++Stats.Unchanged;
         }
     }
-}
 
-FVector AMapView::LatLongToWorldLocation(const FVector2D& Coordinates) const
-{
-    // Simple Mercator projection
-    // Note: For a real implementation, you'd want to use a proper map projection
-    const float WorldScale = 100.0f; // Scale factor for world coordinates
-    
-    float X = Coordinates.X * WorldScale;
-    float Y = FMath::Loge(FMath::Tan(FMath::DegreesToRadians(Coordinates.Y) / 2.0f + PI / 4.0f)) * WorldScale;
-    
-    return FVector(X, Y, 0.0f);
-}
+    // Update venue data
+    Venues = NewVenues;
+    RebuildIdIndex(Venues, VenueIndexById);
 
-void AMapView::EndPlay(const EEndPlayReason::Type EndPlayReason)
-{
-    Super::EndPlay(EndPlayReason);
-    
-    // Clear all timers
-    for (auto& Timer : AnimationTimers)
+    // Events sit on top of their venue, so follow any venue that moved
+    for (const FString& VenueId : MovedVenueIds)
     {
-        GetWorld()->GetTimerManager().ClearTimer(Timer.Value);
+        RefreshEventMarkersAtVenue(VenueId);
     }
-}
 
-void AMapView::UpdatePlayers(const TArray<FPlayerData>& NewPlayers)
-{
-    // Clear existing player markers
-    for (auto& Marker : PlayerMarkers)
-    {
-        if (Marker.Value)
-        {
-            Marker.Value->Destroy();
-        }
-    }
-    PlayerMarkers.Empty();
-    
-    // Update player data
-    Players = NewPlayers;
-    
-    // Spawn new markers
-    SpawnPlayerMarkers();
+    ReportMarkerUpdate(EMarkerType::Venue, Stats);
 }
 
-void AMapView::UpdatePlayerLocation(const FString& PlayerId, const FVector2D& NewLocation)
+bool AMapView::ReconcileVenueMarker(const FVenueData& OldVenue, const FVenueData& NewVenue)
 {
-    // Find player data and update
-    for (FPlayerData& Player : Players)
+    const bool bMoved = !OldVenue.Coordinates.Equals(NewVenue.Coordinates);
+    const bool bRestyled = OldVenue.bIsIndoor != NewVenue.bIsIndoor;
+
+    if (bRestyled)
     {
-        if (Player.Id == PlayerId)
+        UMaterialInterface* MaterialToUse = NewVenue.bIsIndoor ? IndoorVenueMaterial : OutdoorVenueMaterial;
+        MoveMarkerToBatch(EMarkerType::Venue, NewVenue.Id,
+            FindOrCreateMarkerBatch(EMarkerType::Venue, DefaultVenueMarker, MaterialToUse));
+
+        if (const FMarkerInstance* Marker = VenueMarkers.Find(NewVenue.Id))
         {
-            Player.Coordinates = NewLocation;
-            
-            // Update marker position
-            if (AActor* Marker = PlayerMarkers.FindRef(PlayerId))
-            {
-                FVector WorldLocation = LatLongToWorldLocation(NewLocation);
-                Marker->SetActorLocation(WorldLocation);
-            }
-            break;
+            SetMarkerCustomData(*Marker, MapMarkerCustomData::Indoor, NewVenue.bIsIndoor ? 1.0f : 0.0f);
         }
     }
-}
 
-void AMapView::UpdatePlayerStatus(const FString& PlayerId, const FString& NewStatus)
-{
-    for (FPlayerData& Player : Players)
+    if (bMoved)
     {
-        if (Player.Id == PlayerId)
+        if (const FMarkerInstance* Marker = VenueMarkers.Find(NewVenue.Id))
         {
-            Player.Status = NewStatus;
-            
-            // Update marker visuals
-            if (AActor* Marker = PlayerMarkers.FindRef(PlayerId))
-            {
-                UMaterialInterface* MaterialToUse = 
-                    NewStatus == "active" ? ActivePlayerMaterial : InactivePlayerMaterial;
-                
-                if (MaterialToUse)
-                {
-                    UMaterialInstanceDynamic* DynamicMaterial = 
-                        UMaterialInstanceDynamic::Create(MaterialToUse, this);
-                    Cast<AStaticMeshActor>(Marker)->GetStaticMeshComponent()->SetMaterial(0, DynamicMaterial);
-                }
-                
-                // Start fade animation if player becomes inactive
-                if (NewStatus != "active")
-                {
-                    StartFadeAnimation(PlayerId);
-                }
-            }
-            break;
+            SetMarkerLocation(*Marker, ProjectRecord(EMarkerType::Venue, NewVenue.Id, NewVenue.Coordinates));
         }
     }
+
+    // Remaining fields only live in the stored record
+    return bMoved || bRestyled
+        || OldVenue.Name != NewVenue.Name
+        || OldVenue.Description != NewVenue.Description
+        || OldVenue.Sports != NewVenue.Sports
+        || OldVenue.Images != NewVenue.Images;
 }
 
-void AMapView::UpdateEvents(const TArray<FEventData>& NewEvents)
+void AMapView::SelectVenue(const FString& VenueId)
 {
-    // Clear existing event markers
-    for (auto& Marker : EventMarkers)
+    if (const FVenueData* Venue = FindVenue(VenueId))
     {
-        if (Marker.Value)
+        OnVenueSelected.Broadcast(*Venue);
+
+        // Highlight selected venue marker
+        if (const FMarkerInstance* Marker = VenueMarkers.Find(VenueId))
         {
-            Marker.Value->Destroy();
+            // TODO: Implement marker highlight effect
         }
     }
-    EventMarkers.Empty();
-    
-    // Update event data
-    Events = NewEvents;
-    
-    // Spawn new markers
-    SpawnEventMarkers();
 }
 
-void AMapView::UpdateEventStatus(const FString& EventId, const FString& NewStatus)
+bool AMapView::GetVenueById(const FString& VenueId, FVenueData& OutVenue) const
 {
-    for (FEventData& Event : Events)
+    if (const FVenueData* Venue = FindVenue(VenueId))
     {
-        if (Event.Id == EventId)
-        {
-            Event.Status = NewStatus;
-            
-            // Update marker visuals
-            if (AActor* Marker = EventMarkers.FindRef(EventId))
-            {
-                UMaterialInterface* MaterialToUse = 
-                    NewStatus == "active" ? LiveEventMaterial : UpcomingEventMaterial;
-                
-                if (MaterialToUse)
-                {
-                    UMaterialInstanceDynamic* DynamicMaterial = 
-                        UMaterialInstanceDynamic::Create(MaterialToUse, this);
-                    Cast<AStaticMeshActor>(Marker)->GetStaticMeshComponent()->SetMaterial(0, DynamicMaterial);
-                }
-                
-                // Start pulse animation for live events
-                if (NewStatus == "active")
-                {
-                    StartPulseAnimation(EventId);
-                }
-            }
-            break;
-        }
+        OutVenue = *Venue;
+        return true;
     }
+
+    return false;
 }
 
-void AMapView::SpawnPlayerMarkers()
+void AMapView::SpawnVenueMarkers()
 {
-    if (!PlayerMarkerMesh)
+    if (!DefaultVenueMarker)
     {
-        UE_LOG(LogTemp, Warning, TEXT("PlayerMarkerMesh not set in MapView"));
+        UE_LOG(LogTemp, Warning, TEXT("DefaultVenueMarker not set in MapView"));
         return;
     }
 
-    for (const FPlayerData& Player : Players)
+    for (const FVenueData& Venue : Venues)
     {
-        FVector Location = LatLongToWorldLocation(Player.Coordinates);
-        
-        FActorSpawnParameters SpawnParams;
-        SpawnParams.Owner = this;
-        
-        AStaticMeshActor* MarkerActor = GetWorld()->SpawnActor<AStaticMeshActor>(
-            AStaticMeshActor::StaticClass(),
-            Location,
-            FRotator::ZeroRotator,
-            SpawnParams
-        );
-        
-        if (MarkerActor)
-        {
-            // Setup marker
-            MarkerActor->SetMobility(EComponentMobility::Movable);
-            MarkerActor->GetStaticMeshComponent()->SetStaticMesh(PlayerMarkerMesh);
-            
-            // Apply material based on status
-            UMaterialInterface* MaterialToUse = 
-                Player.Status == "active" ? ActivePlayerMaterial : InactivePlayerMaterial;
-            
-            if (MaterialToUse)
-            {
-                UMaterialInstanceDynamic* DynamicMaterial = 
-                    UMaterialInstanceDynamic::Create(MaterialToUse, this);
-                MarkerActor->GetStaticMeshComponent()->SetMaterial(0, DynamicMaterial);
-            }
-            
-            // Add tooltip widget
-            if (TooltipWidgetClass)
-            {
-                UWidgetComponent* TooltipWidget = NewObject<UWidgetComponent>(MarkerActor);
-                TooltipWidget->SetWidgetClass(TooltipWidgetClass);
-                TooltipWidget->AttachToComponent(
-                    MarkerActor->GetRootComponent(),
-                    FAttachmentTransformRules::KeepRelativeTransform
-                );
-                TooltipWidget->SetVisibility(false);
-                MarkerTooltips.Add(Player.Id, TooltipWidget);
-            }
-            
-            // Store reference
-            PlayerMarkers.Add(Player.Id, MarkerActor);
-            MarkerActor->Tags.Add(FName(*Player.Id));
-            
-            // Start animations if needed
-            if (Player.Status != "active")
-            {
-                StartFadeAnimation(Player.Id);
-            }
-        }
+        SpawnVenueMarker(Venue);
     }
 }
 
-void AMapView::SpawnEventMarkers()
+void AMapView::SpawnVenueMarker(const FVenueData& Venue)
 {
-    if (!EventMarkerMesh)
+    if (!ShouldMaterialize(EMarkerType::Venue, Venue.Coordinates))
     {
-        UE_LOG(LogTemp, Warning, TEXT("EventMarkerMesh not set in MapView"));
         return;
     }
 
-    for (const FEventData& Event : Events)
-    {
-        // Get venue location for the event
-        FVector2D VenueCoords;
-        for (const FVenueData& Venue : Venues)
-        {
-            if (Venue.Id == Event.VenueId)
-            {
-                VenueCoords = Venue.Coordinates;
-                break;
-            }
-        }
-        
-        FVector Location = LatLongToWorldLocation(VenueCoords);
-        Location.Z += 100.0f; // Offset above venue marker
-        
-        FActorSpawnParameters SpawnParams;
-        SpawnParams.Owner = this;
-        
-        AStaticMeshActor* MarkerActor = GetWorld()->SpawnActor<AStaticMeshActor>(
-            AStaticMeshActor::StaticClass(),
-            Location,
-            FRotator::ZeroRotator,
-            SpawnParams
-        );
-        
-        if (MarkerActor)
-        {
-            // Setup marker
-            MarkerActor->SetMobility(EComponentMobility::Movable);
-            MarkerActor->GetStaticMeshComponent()->SetStaticMesh(EventMarkerMesh);
-            
-            // Apply material based on status
-            UMaterialInterface* MaterialToUse = 
-                Event.Status == "active" ? LiveEventMaterial : UpcomingEventMaterial;
-            
-            if (MaterialToUse)
-            {
-                UMaterialInstanceDynamic* DynamicMaterial = 
-                    UMaterialInstanceDynamic::Create(MaterialToUse, this);
-                MarkerActor->GetStaticMeshComponent()->SetMaterial(0, DynamicMaterial);
-            }
-            
-            // Add tooltip widget
-            if (TooltipWidgetClass)
-            {
-                UWidgetComponent* TooltipWidget = NewObject<UWidgetComponent>(MarkerActor);
-                TooltipWidget->SetWidgetClass(TooltipWidgetClass);
-                TooltipWidget->AttachToComponent(
-                    MarkerActor->GetRootComponent(),
-                    FAttachmentTransformRules::KeepRelativeTransform
-                );
-                TooltipWidget->SetVisibility(false);
-                MarkerTooltips.Add(Event.Id, TooltipWidget);
-            }
-            
-            // Store reference
-            EventMarkers.Add(Event.Id, MarkerActor);
-            MarkerActor->Tags.Add(FName(*Event.Id));
-            
-            // Start animations if needed
-            if (Event.Status == "active")
-            {
-                StartPulseAnimation(Event.Id);
-            }
-        }
-    }
-}
-
-void AMapView::HandleMarkerHover(AActor* HoveredActor)
-{
-    if (!HoveredActor || HoveredActor->Tags.Num() == 0)
+    // Pick the batch for the venue's material
+    UMaterialInterface* MaterialToUse = Venue.bIsIndoor ? IndoorVenueMaterial : OutdoorVenueMaterial;
+    int32 BatchIndex = FindOrCreateMarkerBatch(EMarkerType::Venue, DefaultVenueMarker, MaterialToUse);
+    if (BatchIndex == INDEX_NONE)
     {
-        HideTooltip();
         return;
     }
-    
-    ShowTooltip(HoveredActor);
+
+    float CustomData[MapMarkerCustomData::Num] = {};
+    CustomData[MapMarkerCustomData::Indoor] = Venue.bIsIndoor ? 1.0f : 0.0f;
+    CustomData[MapMarkerCustomData::Opacity] = 1.0f;
+
+    // Markers materialized by culling after a zoom start at the zoomed scale too
+    FTransform Transform(FQuat::Identity, ProjectRecord(EMarkerType::Venue, Venue.Id, Venue.Coordinates), FVector(GetVenueMarkerScale()));
+    AddMarkerInstance(EMarkerType::Venue, Venue.Id, BatchIndex, Transform, CustomData);
 }
 
-void AMapView::ShowTooltip(AActor* MarkerActor)
+void AMapView::UpdateMarkerVisuals()
 {
-    FString Id = MarkerActor->Tags[0].ToString();
-    if (UWidgetComponent* TooltipWidget = MarkerTooltips.FindRef(Id))
+    SPORTBEACON_SCOPE_CYCLE(MapMarkerUpdate);
+
+    // Update marker scale based on zoom level
+    const float Scale = GetVenueMarkerScale();
+
+    for (const auto& Marker : VenueMarkers)
     {
-        TooltipWidget->SetVisibility(true);
-        
-        // Update tooltip content based on marker type
-        if (PlayerMarkers.Contains(Id))
-        {
-            // Update player tooltip
-            for (const FPlayerData& Player : Players)
-            {
-                if (Player.Id == Id)
-                {
-                    // TODO: Update tooltip widget with player data
-                    break;
-                }
-            }
-        }
-        else if (EventMarkers.Contains(Id))
+        FTransform Transform;
+        if (GetMarkerTransform(Marker.Value, Transform))
         {
-            // Update event tooltip
-            for (const FEventData& Event : Events)
-            {
-                if (Event.Id == Id)
-                {
-                    // TODO: Update tooltip widget with event data
-                    break;
-                }
-            }
+            Transform.SetScale3D(FVector(Scale));
+            SetMarkerTransform(Marker.Value, Transform, false);
         }
     }
-}
 
-void AMapView::HideTooltip()
-{
-    for (auto& Tooltip : MarkerTooltips)
+    // Push all scale changes in a single render state update
+    for (const FMarkerBatch& Batch : MarkerBatches)
     {
-        if (Tooltip.Value)
+        if (Batch.Type == EMarkerType::Venue && Batch.Component)
         {
-            Tooltip.Value->SetVisibility(false);
+            Batch.Component->MarkRenderStateDirty();
         }
     }
 }
 
-void AMapView::StartPulseAnimation(const FString& MarkerId)
+float AMapView::GetVenueMarkerScale() const
 {
-    if (!PulseCurve)
-    {
-        return;
-    }
-    
-    // Clear existing timer if any
-    FTimerHandle& Timer = AnimationTimers.FindOrAdd(MarkerId);
-    GetWorld()->GetTimerManager().ClearTimer(Timer);
-    
-    // Setup pulse animation
-    FTimerDelegate TimerDelegate;
-    TimerDelegate.BindUFunction(this, "OnPulseTimelineUpdate", MarkerId);
-    
-    GetWorld()->GetTimerManager().SetTimer(
-        Timer,
-        TimerDelegate,
-        0.016f, // 60 FPS
-        true
+    return FMath::GetMappedRangeValueClamped(
+        FVector2D(MinZoom, MaxZoom),
+        FVector2D(0.5f, 2.0f),
+        CurrentZoom
     );
 }
 
-void AMapView::StartFadeAnimation(const FString& MarkerId)
+FVector AMapView::LatLongToWorldLocation(const FVector2D& Coordinates) const
+{
+    return Projection.Project(Coordinates);
+}
+
+FVector2D AMapView::WorldLocationToLatLong(const FVector& Location) const
 {
-    if (!FadeCurve)
-    {
-        return;
-    }
-    
-    // Clear existing timer if any
-    FTimerHandle& Timer = AnimationTimers.FindOrAdd(MarkerId);
-    GetWorld()->GetTimerManager().ClearTimer(Timer);
-    
-    // Setup fade animation
-    FTimerDelegate TimerDelegate;
-    TimerDelegate.BindUFunction(this, "OnFadeTimelineUpdate", MarkerId);
-    
-    GetWorld()->GetTimerManager().SetTimer(
-        Timer,
-        TimerDelegate,
-        0.016f, // 60 FPS
-        true
-    );
+    return Projection.Unproject(Location);
 }
 
-void AMapView::OnPulseTimelineUpdate(float Value)
+const FVector& AMapView::ProjectRecord(EMarkerType Type, const FString& Id, const FVector2D& Coordinates) const
 {
-    // Apply pulse effect to marker scale
-    const float BaseScale = 1.0f;
-    const float PulseAmount = 0.2f;
-    float NewScale = BaseScale + (PulseAmount * Value);
-    
-    // Update all active event markers
-    for (const auto& Event : Events)
-    {
-        if (Event.Status == "active")
-        {
-            if (AActor* Marker = EventMarkers.FindRef(Event.Id))
-            {
-                Marker->SetActorScale3D(FVector(NewScale));
-            }
-        }
-    }
+    FMapProjectionCache* Cache = GetLocationCache(Type);
+    check(Cache);
+    return Cache->Project(Projection, Id, Coordinates);
 }
 
-void AMapView::OnFadeTimelineUpdate(float Value)
+FMapProjectionCache* AMapView::GetLocationCache(EMarkerType Type) const
 {
-    // Apply fade effect to marker opacity
-    for (const auto& Player : Players)
+    switch (Type)
     {
-        if (Player.Status != "active")
-        {
-            if (AActor* Marker = PlayerMarkers.FindRef(Player.Id))
-            {
-                if (UMaterialInstanceDynamic* DynamicMaterial = 
-                    Cast<UMaterialInstanceDynamic>(
-                        Cast<AStaticMeshActor>(Marker)->GetStaticMeshComponent()->GetMaterial(0)
-                    ))
-                {
-                    DynamicMaterial->SetScalarParameterValue("Opacity", Value);
-                }
-            }
-        }
+        case EMarkerType::Venue:
+            return &VenueLocationCache;
+        case EMarkerType::Player:
+            return &PlayerLocationCache;
+        case EMarkerType::Highlight:
+            return &HighlightLocationCache;
+        default:
+            return nullptr;
     }
 }
 
-void AMapView::UpdateHighlights(const TArray<FHighlightData>& Highlights)
+void AMapView::UpdateProjectionOrigin()
 {
-    // Clear existing highlight markers
-    for (auto& Pair : HighlightMarkers)
+    if (RebaseDistance <= 0.0f)
     {
-        if (Pair.Value)
-        {
-            Pair.Value->DestroyComponent();
-        }
+        return;
     }
-    HighlightMarkers.Empty();
-    ActiveHighlights = Highlights;
 
-    // Spawn new markers for each highlight
-    for (const auto& Highlight : Highlights)
+    const FVector CameraLocation = MapCamera->GetComponentLocation();
+    if (FVector2D(CameraLocation.X, CameraLocation.Y).SizeSquared() > FMath::Square(RebaseDistance))
     {
-        SpawnHighlightMarker(Highlight);
+        RebaseOrigin(WorldLocationToLatLong(CameraLocation));
     }
 }
 
-void AMapView::SetHighlightFilters(const FString& PlayerFilter, const FString& TeamFilter, const FString& TypeFilter)
+void AMapView::RebaseOrigin(const FVector2D& NewOrigin)
 {
-    CurrentPlayerFilter = PlayerFilter;
-    CurrentTeamFilter = TeamFilter;
-    CurrentTypeFilter = TypeFilter;
+    // Everything in world space shifts so the new origin lands on (0, 0)
+    FVector Offset = -LatLongToWorldLocation(NewOrigin);
+    Offset.Z = 0.0;
 
-    // Update visibility of existing markers based on new filters
-    for (const auto& Highlight : ActiveHighlights)
+    Projection.SetOrigin(NewOrigin);
+
+    for (const FMarkerBatch& Batch : MarkerBatches)
     {
-        if (UStaticMeshComponent* Marker = HighlightMarkers.FindRef(Highlight.Id))
+        if (!Batch.Component)
         {
-            UpdateHighlightMarkerVisibility(Highlight, Marker);
+            continue;
         }
-    }
-}
-
-void AMapView::ClearHighlightFilters()
-{
-    CurrentPlayerFilter.Empty();
-    CurrentTeamFilter.Empty();
-    CurrentTypeFilter.Empty();
 
-    // Show all markers
-    for (const auto& Pair : HighlightMarkers)
-    {
-        if (Pair.Value)
+        const int32 NumInstances = Batch.Component->GetInstanceCount();
+        for (int32 InstanceIndex = 0; InstanceIndex < NumInstances; ++InstanceIndex)
         {
-            Pair.Value->SetVisibility(true);
+            FTransform Transform;
+            if (Batch.Component->GetInstanceTransform(InstanceIndex, Transform, true))
+            {
+                Transform.AddToTranslation(Offset);
+                Batch.Component->UpdateInstanceTransform(InstanceIndex, Transform, true, false, true);
+            }
         }
+        Batch.Component->MarkRenderStateDirty();
     }
-}
 
-void AMapView::SpawnHighlightMarker(const FHighlightData& HighlightData)
-{
-    if (!HighlightMarkerMesh)
+    for (auto& Track : PlayerLocationTracks)
     {
-        UE_LOG(LogTemp, Warning, TEXT("Highlight marker mesh not set"));
-        return;
+        Track.Value.From += Offset;
+        Track.Value.To += Offset;
     }
 
-    FString MarkerName = FString::Printf(TEXT("HighlightMarker_%s"), *HighlightData.Id);
-    UStaticMeshComponent* MarkerComponent = NewObject<UStaticMeshComponent>(this, *MarkerName);
-    MarkerComponent->SetStaticMesh(HighlightMarkerMesh);
-    MarkerComponent->SetMaterial(0, GetHighlightMaterial(HighlightData.HighlightType));
-    MarkerComponent->RegisterComponent();
+    // The camera rides on the map root, so it follows the markers
+    MapRoot->AddWorldOffset(Offset);
+    MarkerTooltip->AddWorldOffset(Offset);
+    bClustersDirty = true;
 
-    // Set world location based on map coordinates
-    FVector WorldLocation = ConvertMapCoordinatesToWorld(HighlightData.Coordinates);
-    MarkerComponent->SetWorldLocation(WorldLocation);
+    UE_LOG(LogTemp, Log, TEXT("MapView: rebased projection origin to (%f, %f)"), NewOrigin.X, NewOrigin.Y);
+}
 
-    // Set up click handling
-    MarkerComponent->OnClicked.AddDynamic(this, &AMapView::HandleHighlightMarkerClicked);
+void AMapView::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    Super::EndPlay(EndPlayReason);
 
-    // Store the marker
-    HighlightMarkers.Add(HighlightData.Id, MarkerComponent);
+    PulsingMarkers.Empty();
+    FadingMarkers.Empty();
 
-    // Update visibility based on current filters
-    UpdateHighlightMarkerVisibility(HighlightData, MarkerComponent);
+    const FMarkerPoolStats PoolStats = GetMarkerPoolStats();
+    UE_LOG(LogTemp, Log, TEXT("MapView: marker pool hits %d misses %d, %d batches with %d/%d slots free"),
+        PoolStats.Hits, PoolStats.Misses, PoolStats.Batches, PoolStats.FreeSlots, PoolStats.TotalSlots);
 }
 
-void AMapView::UpdateHighlightMarkerVisibility(const FHighlightData& HighlightData, UStaticMeshComponent* Marker)
+void AMapView::UpdatePlayers(const TArray<FPlayerData>& NewPlayers)
 {
-    bool bShouldBeVisible = true;
+    SPORTBEACON_SCOPE_CYCLE(MapMarkerUpdate);
+    FMarkerUpdateStats Stats;
 
-    // Apply filters
-    if (!CurrentPlayerFilter.IsEmpty() && HighlightData.PlayerId != CurrentPlayerFilter)
+    TSet<FString> IncomingIds;
+    IncomingIds.Reserve(NewPlayers.Num());
+    for (const FPlayerData& Player : NewPlayers)
     {
-        bShouldBeVisible = false;
+        IncomingIds.Add(Player.Id);
     }
 
-    if (bShouldBeVisible && !CurrentTypeFilter.IsEmpty() && HighlightData.HighlightType != CurrentTypeFilter)
+    // Remove stale markers first so their slots get recycled by new players
+    for (const FPlayerData& Player : Players)
     {
-        bShouldBeVisible = false;
+        if (!IncomingIds.Contains(Player.Id))
+        {
+            StopMarkerAnimation(EMarkerType::Player, Player.Id);
+            RemoveMarkerInstance(EMarkerType::Player, Player.Id);
+            UnindexRecord(EMarkerType::Player, Player.Id);
+            PlayerLocationTracks.Remove(Player.Id);
+            LastLocationSampleTimes.Remove(Player.Id);
+            ++Stats.Removed;
+        }
+    }
+
+    // Move/restyle changed markers and spawn new ones
+    for (const FPlayerData& Player : NewPlayers)
+    {
+        IndexRecord(EMarkerType::Player, Player.Id, Player.Coordinates);
+
+        const int32* ExistingIndex = PlayerIndexById.Find(Player.Id);
+        if (!ExistingIndex)
+        {
+            SpawnPlayerMarker(Player);
+            ++Stats.Added;
+        }
+        else if (ReconcilePlayerMarker(Players[*ExistingIndex], Player))
+        {
+            ++Stats.Changed;
+        }
+        else
+        {
+            ++Stats.Unchanged;
+        }
+    }
+
+    // Update player data
+    Players = NewPlayers;
+    RebuildIdIndex(Players, PlayerIndexById);
+
+    ReportMarkerUpdate(EMarkerType::Player, Stats);
+}
+
+bool AMapView::ReconcilePlayerMarker(const FPlayerData& OldPlayer, const FPlayerData& NewPlayer)
+{
+    const bool bMoved = !OldPlayer.Coordinates.Equals(NewPlayer.Coordinates);
+    const bool bRestyled = OldPlayer.Status != NewPlayer.Status;
+
+    if (bRestyled)
+    {
+        ApplyPlayerStatusVisuals(NewPlayer.Id, NewPlayer.Status);
+    }
+
+    if (bMoved)
+    {
+        // The snapshot position wins over any glide still heading to an older streamed sample
+        PlayerLocationTracks.Remove(NewPlayer.Id);
+
+        if (const FMarkerInstance* Marker = PlayerMarkers.Find(NewPlayer.Id))
+        {
+            SetMarkerLocation(*Marker, ProjectRecord(EMarkerType::Player, NewPlayer.Id, NewPlayer.Coordinates));
+        }
+    }
+
+    // Remaining fields only live in the stored record
+    return bMoved || bRestyled
+        || OldPlayer.Name != NewPlayer.Name
+        || OldPlayer.AvatarUrl != NewPlayer.AvatarUrl
+        || OldPlayer.Sport != NewPlayer.Sport
+        || OldPlayer.LastActive != NewPlayer.LastActive
+        || OldPlayer.VenueId != NewPlayer.VenueId;
+}
+
+void AMapView::UpdatePlayerLocation(const FString& PlayerId, const FVector2D& NewLocation)
+{
+    SPORTBEACON_SCOPE_CYCLE(MapMarkerUpdate);
+
+    // Find player data and update
+    if (FPlayerData* Player = FindPlayer(PlayerId))
+    {
+        Player->Coordinates = NewLocation;
+        IndexRecord(EMarkerType::Player, PlayerId, NewLocation);
+
+        // Direct updates snap, so drop any glide that would override them
+        PlayerLocationTracks.Remove(PlayerId);
+
+        // Update marker position
+        if (const FMarkerInstance* Marker = PlayerMarkers.Find(PlayerId))
+        {
+            SetMarkerLocation(*Marker, ProjectRecord(EMarkerType::Player, PlayerId, NewLocation));
+        }
+    }
+}
+
+void AMapView::UpdatePlayerLocations(const TArray<FPlayerLocationSample>& Samples)
+{
+    SPORTBEACON_SCOPE_CYCLE(MapMarkerUpdate);
+
+    const double Now = GetWorld()->GetTimeSeconds();
+    TArray<int32, TInlineAllocator<4>> DirtyBatches;
+
+    // Every sample moves, so project the whole batch up front instead of going through the cache
+    TArray<FVector2D> SampleCoordinates;
+    SampleCoordinates.Reserve(Samples.Num());
+    for (const FPlayerLocationSample& Sample : Samples)
+    {
+        SampleCoordinates.Add(Sample.Coordinates);
+    }
+    TArray<FVector> SampleLocations;
+    SampleLocations.SetNumUninitialized(Samples.Num());
+    Projection.ProjectBatch(SampleCoordinates, SampleLocations);
+
+    for (int32 SampleIndex = 0; SampleIndex < Samples.Num(); ++SampleIndex)
+    {
+        const FPlayerLocationSample& Sample = Samples[SampleIndex];
+        FPlayerData* Player = FindPlayer(Sample.PlayerId);
+        if (!Player)
+        {
+            continue;
+        }
+
+        // Samples can arrive out of order, only ever move forward in server time
+        double& LastSampleTime = LastLocationSampleTimes.FindOrAdd(Sample.PlayerId, -1.0);
+        const bool bFirstSample = LastSampleTime < 0.0;
+        if (!bFirstSample && Sample.Timestamp <= LastSampleTime)
+        {
+            continue;
+        }
+        const double SampleSpacing = bFirstSample ? DefaultLocationInterpolationTime : Sample.Timestamp - LastSampleTime;
+        LastSampleTime = Sample.Timestamp;
+
+        Player->Coordinates = Sample.Coordinates;
+        IndexRecord(EMarkerType::Player, Sample.PlayerId, Sample.Coordinates);
+
+        const FMarkerInstance* Marker = PlayerMarkers.Find(Sample.PlayerId);
+        if (!Marker)
+        {
+            continue;
+        }
+
+        const FVector& Target = SampleLocations[SampleIndex];
+        if (!bInterpolatePlayerLocations)
+        {
+            SetMarkerLocation(*Marker, Target, false);
+            DirtyBatches.AddUnique(Marker->BatchIndex);
+            continue;
+        }
+
+        // Start from wherever the marker is drawn now, which may be mid-glide
+        FTransform Transform;
+        if (!GetMarkerTransform(*Marker, Transform))
+        {
+            continue;
+        }
+
+        FPlayerLocationTrack& Track = PlayerLocationTracks.FindOrAdd(Sample.PlayerId);
+        Track.From = Transform.GetLocation();
+        Track.To = Target;
+        Track.StartTime = Now;
+        Track.Duration = FMath::Clamp(SampleSpacing, 0.0, (double)MaxLocationInterpolationTime);
+    }
+
+    MarkBatchesRenderStateDirty(DirtyBatches);
+}
+
+int32 AMapView::UpdatePlayerLocationsFromPayload(const TArray<uint8>& Payload)
+{
+    FMemoryReader Reader(Payload);
+    Reader.SetByteSwapping(!PLATFORM_LITTLE_ENDIAN);
+
+    uint32 Count = 0;
+    Reader << Count;
+
+    // Each record is at least the length byte plus three doubles
+    constexpr int64 MinRecordSize = sizeof(uint8) + 3 * sizeof(double);
+    if (Reader.IsError() || (int64)Count > (Payload.Num() - Reader.Tell()) / MinRecordSize)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Malformed player location payload (%d bytes)"), Payload.Num());
+        return 0;
+    }
+
+    TArray<FPlayerLocationSample> Samples;
+    Samples.Reserve(Count);
+
+    TArray<UTF8CHAR, TInlineAllocator<64>> IdBuffer;
+    for (uint32 Index = 0; Index < Count; ++Index)
+    {
+        uint8 IdLength = 0;
+        Reader << IdLength;
+
+        IdBuffer.SetNumUninitialized(IdLength);
+        Reader.Serialize(IdBuffer.GetData(), IdLength);
+
+        double X = 0.0;
+        double Y = 0.0;
+        double Timestamp = 0.0;
+        Reader << X << Y << Timestamp;
+
+        if (Reader.IsError())
+        {
+            UE_LOG(LogTemp, Warning, TEXT("Player location payload truncated at record %u"), Index);
+            break;
+        }
+
+        FPlayerLocationSample& Sample = Samples.AddDefaulted_GetRef();
+        Sample.PlayerId = FString(FUTF8ToTCHAR(reinterpret_cast<const ANSICHAR*>(IdBuffer.GetData()), IdLength));
+        Sample.Coordinates = FVector2D(X, Y);
+        Sample.Timestamp = Timestamp;
+    }
+
+    UpdatePlayerLocations(Samples);
+    return Samples.Num();
+}
+
+void AMapView::UpdatePlayerLocationTracks()
+{
+    SPORTBEACON_SCOPE_CYCLE(MapLocationTracks);
+
+    if (PlayerLocationTracks.Num() == 0)
+    {
+        return;
+    }
+
+    const double Now = GetWorld()->GetTimeSeconds();
+    TArray<int32, TInlineAllocator<4>> DirtyBatches;
+
+    for (auto It = PlayerLocationTracks.CreateIterator(); It; ++It)
+    {
+        const FPlayerLocationTrack& Track = It.Value();
+        const FMarkerInstance* Marker = PlayerMarkers.Find(It.Key());
+        if (!Marker)
+        {
+            It.RemoveCurrent();
+            continue;
+        }
+
+        const float Alpha = Track.Duration > 0.0
+            ? (float)FMath::Clamp((Now - Track.StartTime) / Track.Duration, 0.0, 1.0)
+            : 1.0f;
+
+        SetMarkerLocation(*Marker, FMath::Lerp(Track.From, Track.To, Alpha), false);
+        DirtyBatches.AddUnique(Marker->BatchIndex);
+
+        if (Alpha >= 1.0f)
+        {
+            It.RemoveCurrent();
+        }
+    }
+
+    // One render state update per touched batch instead of one per marker
+    MarkBatchesRenderStateDirty(DirtyBatches);
+}
+
+void AMapView::UpdatePlayerStatus(const FString& PlayerId, const FString& NewStatus)
+{
+    if (FPlayerData* Player = FindPlayer(PlayerId))
+    {
+        Player->Status = NewStatus;
+
+        // Update marker visuals
+        ApplyPlayerStatusVisuals(PlayerId, NewStatus);
+    }
+}
+
+bool AMapView::GetPlayerById(const FString& PlayerId, FPlayerData& OutPlayer) const
+{
+    if (const FPlayerData* Player = FindPlayer(PlayerId))
+    {
+        OutPlayer = *Player;
+        return true;
+    }
+
+    return false;
+}
+
+void AMapView::ApplyPlayerStatusVisuals(const FString& PlayerId, const FString& Status)
+{
+    if (!PlayerMarkers.Contains(PlayerId))
+    {
+        return;
+    }
+
+    const bool bIsActive = Status == "active";
+    UMaterialInterface* MaterialToUse = bIsActive ? ActivePlayerMaterial : InactivePlayerMaterial;
+
+    MoveMarkerToBatch(EMarkerType::Player, PlayerId,
+        FindOrCreateMarkerBatch(EMarkerType::Player, PlayerMarkerMesh, MaterialToUse));
+
+    const FMarkerInstance& Marker = PlayerMarkers[PlayerId];
+    SetMarkerCustomData(Marker, MapMarkerCustomData::Active, bIsActive ? 1.0f : 0.0f);
+
+    // Start fade animation if player becomes inactive
+    if (!bIsActive)
+    {
+        StartFadeAnimation(EMarkerType::Player, PlayerId);
+    }
+    else
+    {
+        StopMarkerAnimation(EMarkerType::Player, PlayerId);
+        SetMarkerCustomData(Marker, MapMarkerCustomData::Opacity, 1.0f);
+    }
+}
+
+void AMapView::UpdateEvents(const TArray<FEventData>& NewEvents)
+{
+    SPORTBEACON_SCOPE_CYCLE(MapMarkerUpdate);
+    FMarkerUpdateStats Stats;
+
+    TSet<FString> IncomingIds;
+    IncomingIds.Reserve(NewEvents.Num());
+    for (const FEventData& Event : NewEvents)
+    {
+        IncomingIds.Add(Event.Id);
+    }
+
+    // Remove stale markers first so their slots get recycled by new events
+    for (const FEventData& Event : Events)
+    {
+        if (!IncomingIds.Contains(Event.Id))
+        {
+            StopMarkerAnimation(EMarkerType::Event, Event.Id);
+            RemoveMarkerInstance(EMarkerType::Event, Event.Id);
+            UnindexRecord(EMarkerType::Event, Event.Id);
+            ++Stats.Removed;
+        }
+    }
+
+    // Move/restyle changed markers and spawn new ones
+    for (const FEventData& Event : NewEvents)
+    {
+        IndexRecord(EMarkerType::Event, Event.Id, FindVenueCoordinates(Event.VenueId));
+
+        const int32* ExistingIndex = EventIndexById.Find(Event.Id);
+        if (!ExistingIndex)
+        {
+            SpawnEventMarker(Event);
+            ++Stats.Added;
+        }
+        else if (ReconcileEventMarker(Events[*ExistingIndex], Event))
+        {
+            ++Stats.Changed;
+        }
+        else
+        {
+            ++Stats.Unchanged;
+        }
+    }
+
+    // Update event data
+    Events = NewEvents;
+    RebuildIdIndex(Events, EventIndexById);
+
+    ReportMarkerUpdate(EMarkerType::Event, Stats);
+}
+
+bool AMapView::ReconcileEventMarker(const FEventData& OldEvent, const FEventData& NewEvent)
+{
+    const bool bMoved = OldEvent.VenueId != NewEvent.VenueId;
+    const bool bRestyled = OldEvent.Status != NewEvent.Status;
+
+    if (bRestyled)
+    {
+        ApplyEventStatusVisuals(NewEvent.Id, NewEvent.Status);
+    }
+
+    if (bMoved)
+    {
+        if (const FMarkerInstance* Marker = EventMarkers.Find(NewEvent.Id))
+        {
+            SetMarkerLocation(*Marker, GetEventMarkerLocation(NewEvent));
+        }
+    }
+
+    // Remaining fields only live in the stored record
+    return bMoved || bRestyled
+        || OldEvent.EventType != NewEvent.EventType
+        || OldEvent.Title != NewEvent.Title
+        || OldEvent.StartTime != NewEvent.StartTime
+        || OldEvent.Description != NewEvent.Description;
+}
+
+void AMapView::UpdateEventStatus(const FString& EventId, const FString& NewStatus)
+{
+    if (FEventData* Event = FindEvent(EventId))
+    {
+        Event->Status = NewStatus;
+
+        // Update marker visuals
+        ApplyEventStatusVisuals(EventId, NewStatus);
+    }
+}
+
+void AMapView::ApplyEventStatusVisuals(const FString& EventId, const FString& Status)
+{
+    if (!EventMarkers.Contains(EventId))
+    {
+        return;
+    }
+
+    const bool bIsLive = Status == "active";
+    UMaterialInterface* MaterialToUse = bIsLive ? LiveEventMaterial : UpcomingEventMaterial;
+
+    MoveMarkerToBatch(EMarkerType::Event, EventId,
+        FindOrCreateMarkerBatch(EMarkerType::Event, EventMarkerMesh, MaterialToUse));
+
+    const FMarkerInstance& Marker = EventMarkers[EventId];
+    SetMarkerCustomData(Marker, MapMarkerCustomData::Active, bIsLive ? 1.0f : 0.0f);
+
+    // Start pulse animation for live events
+    if (bIsLive)
+    {
+        StartPulseAnimation(EMarkerType::Event, EventId);
+    }
+    else
+    {
+        StopMarkerAnimation(EMarkerType::Event, EventId);
+
+        FTransform Transform;
+        if (GetMarkerTransform(Marker, Transform))
+        {
+            Transform.SetScale3D(FVector::OneVector);
+            SetMarkerTransform(Marker, Transform);
+        }
+    }
+}
+
+void AMapView::SpawnPlayerMarker(const FPlayerData& Player)
+{
+    if (!ShouldMaterialize(EMarkerType::Player, Player.Coordinates))
+    {
+        return;
+    }
+
+    // Pick the batch for the player's status
+    const bool bIsActive = Player.Status == "active";
+    UMaterialInterface* MaterialToUse = bIsActive ? ActivePlayerMaterial : InactivePlayerMaterial;
+    int32 BatchIndex = FindOrCreateMarkerBatch(EMarkerType::Player, PlayerMarkerMesh, MaterialToUse);
+    if (BatchIndex == INDEX_NONE)
+    {
+        return;
+    }
+
+    float CustomData[MapMarkerCustomData::Num] = {};
+    CustomData[MapMarkerCustomData::Active] = bIsActive ? 1.0f : 0.0f;
+    CustomData[MapMarkerCustomData::Opacity] = 1.0f;
+
+    FTransform Transform(ProjectRecord(EMarkerType::Player, Player.Id, Player.Coordinates));
+    AddMarkerInstance(EMarkerType::Player, Player.Id, BatchIndex, Transform, CustomData);
+
+    // Start animations if needed
+    if (!bIsActive)
+    {
+        StartFadeAnimation(EMarkerType::Player, Player.Id);
+    }
+}
+
+void AMapView::SpawnEventMarker(const FEventData& Event)
+{
+    if (!ShouldMaterialize(EMarkerType::Event, FindVenueCoordinates(Event.VenueId)))
+    {
+        return;
+    }
+
+    // Pick the batch for the event's status
+    const bool bIsLive = Event.Status == "active";
+    UMaterialInterface* MaterialToUse = bIsLive ? LiveEventMaterial : UpcomingEventMaterial;
+    int32 BatchIndex = FindOrCreateMarkerBatch(EMarkerType::Event, EventMarkerMesh, MaterialToUse);
+    if (BatchIndex == INDEX_NONE)
+    {
+        return;
+    }
+
+    float CustomData[MapMarkerCustomData::Num] = {};
+    CustomData[MapMarkerCustomData::Active] = bIsLive ? 1.0f : 0.0f;
+    CustomData[MapMarkerCustomData::Opacity] = 1.0f;
+
+    AddMarkerInstance(EMarkerType::Event, Event.Id, BatchIndex, FTransform(GetEventMarkerLocation(Event)), CustomData);
+
+    // Start animations if needed
+    if (bIsLive)
+    {
+        StartPulseAnimation(EMarkerType::Event, Event.Id);
+    }
+}
+
+FVector2D AMapView::FindVenueCoordinates(const FString& VenueId) const
+{
+    const FVenueData* Venue = FindVenue(VenueId);
+    return Venue ? Venue->Coordinates : FVector2D::ZeroVector;
+}
+
+const FVenueData* AMapView::FindVenue(const FString& VenueId) const
+{
+    const int32* Index = VenueIndexById.Find(VenueId);
+    return Index && Venues.IsValidIndex(*Index) ? &Venues[*Index] : nullptr;
+}
+
+FPlayerData* AMapView::FindPlayer(const FString& PlayerId)
+{
+    const int32* Index = PlayerIndexById.Find(PlayerId);
+    return Index && Players.IsValidIndex(*Index) ? &Players[*Index] : nullptr;
+}
+
+const FPlayerData* AMapView::FindPlayer(const FString& PlayerId) const
+{
+    const int32* Index = PlayerIndexById.Find(PlayerId);
+    return Index && Players.IsValidIndex(*Index) ? &Players[*Index] : nullptr;
+}
+
+FEventData* AMapView::FindEvent(const FString& EventId)
+{
+    const int32* Index = EventIndexById.Find(EventId);
+    return Index && Events.IsValidIndex(*Index) ? &Events[*Index] : nullptr;
+}
+
+const FEventData* AMapView::FindEvent(const FString& EventId) const
+{
+    const int32* Index = EventIndexById.Find(EventId);
+    return Index && Events.IsValidIndex(*Index) ? &Events[*Index] : nullptr;
+}
+
+const FHighlightData* AMapView::FindHighlight(const FString& HighlightId) const
+{
+    const int32* Index = HighlightIndexById.Find(HighlightId);
+    return Index && ActiveHighlights.IsValidIndex(*Index) ? &ActiveHighlights[*Index] : nullptr;
+}
+
+FVector AMapView::GetEventMarkerLocation(const FEventData& Event) const
+{
+    // Get venue location for the event
+    const FVenueData* Venue = FindVenue(Event.VenueId);
+    FVector Location = Venue
+        ? ProjectRecord(EMarkerType::Venue, Venue->Id, Venue->Coordinates)
+        : LatLongToWorldLocation(FVector2D::ZeroVector);
+    Location.Z += 100.0f; // Offset above venue marker
+    return Location;
+}
+
+void AMapView::RefreshEventMarkersAtVenue(const FString& VenueId)
+{
+    const FVector2D VenueCoordinates = FindVenueCoordinates(VenueId);
+    for (const FEventData& Event : Events)
+    {
+        if (Event.VenueId == VenueId)
+        {
+            IndexRecord(EMarkerType::Event, Event.Id, VenueCoordinates);
+
+            if (const FMarkerInstance* Marker = EventMarkers.Find(Event.Id))
+            {
+                SetMarkerLocation(*Marker, GetEventMarkerLocation(Event));
+            }
+        }
+    }
+}
+
+void AMapView::ReportMarkerUpdate(EMarkerType Type, const FMarkerUpdateStats& Stats)
+{
+    LastUpdateStats.Add(Type, Stats);
+
+    int32 NumMarkers = 0;
+    for (const FMarkerBatch& Batch : MarkerBatches)
+    {
+        NumMarkers += Batch.InstanceIds.Num() - Batch.FreeInstances.Num();
+    }
+    SPORTBEACON_SET_COUNT(MapMarkers, NumMarkers);
+
+    UE_LOG(LogTemp, Verbose, TEXT("MapView: marker update type %d added %d removed %d changed %d unchanged %d"),
+        static_cast<int32>(Type), Stats.Added, Stats.Removed, Stats.Changed, Stats.Unchanged);
+
+    OnMarkersUpdated.Broadcast(Type, Stats);
+}
+
+FMarkerPoolStats AMapView::GetMarkerPoolStats() const
+{
+    FMarkerPoolStats Stats;
+    Stats.Hits = PoolHits;
+    Stats.Misses = PoolMisses;
+    Stats.Batches = MarkerBatches.Num();
+
+    for (const FMarkerBatch& Batch : MarkerBatches)
+    {
+        Stats.TotalSlots += Batch.InstanceIds.Num();
+        Stats.FreeSlots += Batch.FreeInstances.Num();
+    }
+
+    return Stats;
+}
+
+FMarkerUpdateStats AMapView::GetLastUpdateStats(EMarkerType MarkerType) const
+{
+    if (const FMarkerUpdateStats* Stats = LastUpdateStats.Find(MarkerType))
+    {
+        return *Stats;
+    }
+
+    return FMarkerUpdateStats();
+}
+
+void AMapView::GetVenuesWithinRadius(const FVector2D& Center, float RadiusKm, TArray<FVenueData>& OutVenues) const
+{
+    TArray<FString> Ids;
+    VenueSpatialIndex.QueryRadius(Center, RadiusKm, Ids);
+
+    OutVenues.Reset(Ids.Num());
+    for (const FString& Id : Ids)
+    {
+        if (const FVenueData* Venue = FindVenue(Id))
+        {
+            OutVenues.Add(*Venue);
+        }
+    }
+}
+
+bool AMapView::GetVenuesNearPlayer(const FString& PlayerId, float RadiusKm, TArray<FVenueData>& OutVenues) const
+{
+    OutVenues.Reset();
+
+    const FPlayerData* Player = FindPlayer(PlayerId);
+    if (!Player)
+    {
+        return false;
+    }
+
+    GetVenuesWithinRadius(Player->Coordinates, RadiusKm, OutVenues);
+    return true;
+}
+
+void AMapView::GetNearestVenues(const FVector2D& Center, int32 Count, TArray<FVenueData>& OutVenues) const
+{
+    TArray<FString> Ids;
+    VenueSpatialIndex.QueryNearest(Center, Count, Ids);
+
+    OutVenues.Reset(Ids.Num());
+    for (const FString& Id : Ids)
+    {
+        if (const FVenueData* Venue = FindVenue(Id))
+        {
+            OutVenues.Add(*Venue);
+        }
+    }
+}
+
+void AMapView::GetPlayersWithinRadius(const FVector2D& Center, float RadiusKm, TArray<FPlayerData>& OutPlayers) const
+{
+    TArray<FString> Ids;
+    PlayerSpatialIndex.QueryRadius(Center, RadiusKm, Ids);
+
+    OutPlayers.Reset(Ids.Num());
+    for (const FString& Id : Ids)
+    {
+        if (const FPlayerData* Player = FindPlayer(Id))
+        {
+            OutPlayers.Add(*Player);
+        }
+    }
+}
+
+FMapSpatialIndex& AMapView::GetSpatialIndex(EMarkerType Type)
+{
+    switch (Type)
+    {
+        case EMarkerType::Player:
+            return PlayerSpatialIndex;
+        case EMarkerType::Event:
+            return EventSpatialIndex;
+        case EMarkerType::Highlight:
+            return HighlightSpatialIndex;
+        default:
+            return VenueSpatialIndex;
+    }
+}
+
+void AMapView::MarkCullingDirty(EMarkerType Type)
+{
+    DirtyCullingTypes |= 1 << static_cast<uint8>(Type);
+}
+
+void AMapView::IndexRecord(EMarkerType Type, const FString& Id, const FVector2D& Coordinates)
+{
+    GetSpatialIndex(Type).Update(Id, Coordinates);
+
+    // Players move all the time, so their clusters follow incrementally
+    if (Type == EMarkerType::Player && ActiveClusterBand != INDEX_NONE)
+    {
+        PlayerClusters.Update(Id, Coordinates);
+        bClustersDirty = true;
+    }
+
+    MarkCullingDirty(Type);
+}
+
+void AMapView::UnindexRecord(EMarkerType Type, const FString& Id)
+{
+    GetSpatialIndex(Type).Remove(Id);
+
+    if (FMapProjectionCache* Cache = GetLocationCache(Type))
+    {
+        Cache->Remove(Id);
+    }
+
+    if (Type == EMarkerType::Player && ActiveClusterBand != INDEX_NONE)
+    {
+        PlayerClusters.Remove(Id);
+        bClustersDirty = true;
+    }
+
+    MarkCullingDirty(Type);
+}
+
+FBox2D AMapView::GetViewCoordinateBounds(float Scale) const
+{
+    // The camera looks straight down at the marker plane
+    const FVector CameraLocation = MapCamera->GetComponentLocation();
+    const float HalfWidth = MapCamera->ProjectionMode == ECameraProjectionMode::Orthographic
+        ? MapCamera->OrthoWidth * 0.5f
+        : FMath::Max(CameraLocation.Z, 1.0f) * FMath::Tan(FMath::DegreesToRadians(MapCamera->FieldOfView * 0.5f));
+    const float HalfHeight = HalfWidth / FMath::Max(MapCamera->AspectRatio, KINDA_SMALL_NUMBER);
+
+    // Camera yaw rotates the footprint, so cover its circumscribed square
+    const float Radius = FMath::Sqrt(HalfWidth * HalfWidth + HalfHeight * HalfHeight) * Scale;
+    const FVector Extent(Radius, Radius, 0.0f);
+
+    return FBox2D(WorldLocationToLatLong(CameraLocation - Extent), WorldLocationToLatLong(CameraLocation + Extent));
+}
+
+bool AMapView::ShouldMaterialize(EMarkerType Type, const FVector2D& Coordinates) const
+{
+    return (!CullBounds.bIsValid || CullBounds.IsInside(Coordinates)) && !IsClustered(Type, Coordinates);
+}
+
+void AMapView::UpdateMarkerCulling()
+{
+    SPORTBEACON_SCOPE_CYCLE(MapCulling);
+    const FBox2D ViewBounds = bEnableViewportCulling ? GetViewCoordinateBounds(1.0f) : WholeWorldBounds;
+
+    // Keep the current region while the view stays inside it and has not zoomed far into it
+    const bool bViewInside = CullBounds.bIsValid && ContainsBox(CullBounds, ViewBounds);
+    const float MaxAreaRatio = 4.0f * CullingMargin * CullingMargin;
+    const bool bViewShrunk = bEnableViewportCulling && bViewInside && CullBounds.GetArea() > ViewBounds.GetArea() * MaxAreaRatio;
+
+    if (!bViewInside || bViewShrunk)
+    {
+        CullBounds = bEnableViewportCulling ? GetViewCoordinateBounds(CullingMargin) : WholeWorldBounds;
+        DirtyCullingTypes = 0xFF;
+        bClustersDirty = true;
+    }
+
+    if (DirtyCullingTypes == 0)
+    {
+        return;
+    }
+
+    for (EMarkerType Type : { EMarkerType::Venue, EMarkerType::Player, EMarkerType::Event, EMarkerType::Highlight })
+    {
+        if (DirtyCullingTypes & (1 << static_cast<uint8>(Type)))
+        {
+            ApplyMarkerCulling(Type);
+        }
+    }
+    DirtyCullingTypes = 0;
+}
+
+void AMapView::ApplyMarkerCulling(EMarkerType Type)
+{
+    const FMapSpatialIndex& SpatialIndex = GetSpatialIndex(Type);
+    TMap<FString, FMarkerInstance>& Markers = GetMarkerMap(Type);
+
+    // Release markers whose records left the region or folded into a cluster
+    TArray<FString> LeavingIds;
+    for (const auto& Marker : Markers)
+    {
+        const FVector2D* Coordinates = SpatialIndex.FindCoordinates(Marker.Key);
+        if (!Coordinates || !ShouldMaterialize(Type, *Coordinates))
+        {
+            LeavingIds.Add(Marker.Key);
+        }
+    }
+
+    for (const FString& Id : LeavingIds)
+    {
+        StopMarkerAnimation(Type, Id);
+        RemoveMarkerInstance(Type, Id);
+    }
+
+    // Materialize records that entered it, spawning skips anything still clustered
+    TArray<FString> VisibleIds;
+    SpatialIndex.QueryRect(CullBounds, VisibleIds);
+    for (const FString& Id : VisibleIds)
+    {
+        if (!Markers.Contains(Id))
+        {
+            SpawnMarkerById(Type, Id);
+        }
+    }
+}
+
+void AMapView::SpawnMarkerById(EMarkerType Type, const FString& Id)
+{
+    switch (Type)
+    {
+        case EMarkerType::Venue:
+            if (const FVenueData* Venue = FindVenue(Id))
+            {
+                SpawnVenueMarker(*Venue);
+            }
+            break;
+
+        case EMarkerType::Player:
+            if (const FPlayerData* Player = FindPlayer(Id))
+            {
+                SpawnPlayerMarker(*Player);
+            }
+            break;
+
+        case EMarkerType::Event:
+            if (const FEventData* Event = FindEvent(Id))
+            {
+                SpawnEventMarker(*Event);
+            }
+            break;
+
+        case EMarkerType::Highlight:
+            if (const FHighlightData* Highlight = FindHighlight(Id))
+            {
+                SpawnHighlightMarker(*Highlight);
+            }
+            break;
+    }
+}
+
+void AMapView::UpdateClusterBand()
+{
+    // Highest band the current zoom reaches
+    int32 NewBand = INDEX_NONE;
+    for (int32 Index = 0; Index < ClusterBands.Num(); ++Index)
+    {
+        if (CurrentZoom >= ClusterBands[Index].MinZoom
+            && (NewBand == INDEX_NONE || ClusterBands[Index].MinZoom > ClusterBands[NewBand].MinZoom))
+        {
+            NewBand = Index;
+        }
+    }
+
+    if (NewBand == ActiveClusterBand)
+    {
+        return;
+    }
+
+    // Counts only exist for the active band, so a band change recounts once
+    ActiveClusterBand = NewBand;
+    RefillClusterGrid(EMarkerType::Player);
+    RefillClusterGrid(EMarkerType::Highlight);
+}
+
+void AMapView::RefillClusterGrid(EMarkerType Type)
+{
+    const bool bClustering = ClusterBands.IsValidIndex(ActiveClusterBand);
+    const double CellSize = bClustering ? ClusterBands[ActiveClusterBand].CellSize : 1.0;
+
+    if (Type == EMarkerType::Player)
+    {
+        PlayerClusters.Reset(CellSize);
+        if (bClustering)
+        {
+            for (const FPlayerData& Player : Players)
+            {
+                PlayerClusters.Update(Player.Id, Player.Coordinates);
+            }
+        }
+    }
+    else if (Type == EMarkerType::Highlight)
+    {
+        HighlightClusters.Reset(CellSize);
+        if (bClustering)
+        {
+            for (const FHighlightData& Highlight : ActiveHighlights)
+            {
+                if (PassesHighlightFilters(Highlight))
+                {
+                    HighlightClusters.Update(Highlight.Id, Highlight.Coordinates);
+                }
+            }
+        }
+    }
+
+    MarkCullingDirty(Type);
+    bClustersDirty = true;
+}
+
+bool AMapView::IsClustered(EMarkerType Type, const FVector2D& Coordinates) const
+{
+    if (ActiveClusterBand == INDEX_NONE)
+    {
+        return false;
+    }
+
+    const FMapClusterGrid* Grid = Type == EMarkerType::Player ? &PlayerClusters
+        : Type == EMarkerType::Highlight ? &HighlightClusters
+        : nullptr;
+
+    const FMapClusterGrid::FCell* Cell = Grid ? Grid->FindCell(Coordinates) : nullptr;
+    return Cell && Cell->Count >= MinClusterSize;
+}
+
+void AMapView::RebuildClusterMarkers()
+{
+    SPORTBEACON_SCOPE_CYCLE(MapClustering);
+
+    bClustersDirty = false;
+
+    ClusterMarkers->ClearInstances();
+    ClusterCentroids.Reset();
+
+    if (ActiveClusterBand == INDEX_NONE || !ClusterMarkerMesh)
+    {
+        return;
+    }
+
+    TArray<float> Scales;
+    TArray<float> CustomData;
+
+    auto CollectBubbles = [&](const FMapClusterGrid& Grid, EMarkerType Type)
+    {
+        for (const auto& Cell : Grid.GetCells())
+        {
+            const int32 Count = Cell.Value.Count;
+            const FVector2D Centroid = Cell.Value.GetCentroid();
+            if (Count < MinClusterSize || !CullBounds.IsInside(Centroid))
+            {
+                continue;
+            }
+
+            // Grow with the log of the count so huge clusters stay readable
+            const float Scale = FMath::Min(1.0f + 0.25f * FMath::Log2(static_cast<float>(Count)), 3.0f);
+            Scales.Add(Scale);
+
+            CustomData.Add(static_cast<float>(Count));
+            CustomData.Add(static_cast<float>(Type));
+            ClusterCentroids.Add(Centroid);
+        }
+    };
+
+    CollectBubbles(PlayerClusters, EMarkerType::Player);
+    CollectBubbles(HighlightClusters, EMarkerType::Highlight);
+
+    TArray<FVector> Locations;
+    Locations.SetNumUninitialized(ClusterCentroids.Num());
+    Projection.ProjectBatch(ClusterCentroids, Locations);
+
+    TArray<FTransform> Transforms;
+    Transforms.Reserve(Locations.Num());
+    for (int32 Index = 0; Index < Locations.Num(); ++Index)
+    {
+        Transforms.Emplace(FRotator::ZeroRotator, Locations[Index], FVector(Scales[Index]));
+    }
+
+    ClusterMarkers->AddInstances(Transforms, false, true);
+    for (int32 Index = 0; Index < Transforms.Num(); ++Index)
+    {
+        ClusterMarkers->SetCustomData(Index,
+            MakeArrayView(&CustomData[Index * MapClusterCustomData::Num], MapClusterCustomData::Num), false);
+    }
+    ClusterMarkers->MarkRenderStateDirty();
+}
+
+void AMapView::FocusCluster(int32 ClusterIndex)
+{
+    if (!ClusterCentroids.IsValidIndex(ClusterIndex) || !ClusterBands.IsValidIndex(ActiveClusterBand))
+    {
+        return;
+    }
+
+    // Centre the camera over the bubble
+    const FVector2D Centroid = ClusterCentroids[ClusterIndex];
+    const FVector Target = LatLongToWorldLocation(Centroid);
+    FVector RootLocation = MapRoot->GetComponentLocation();
+    RootLocation.X = Target.X;
+    RootLocation.Y = Target.Y;
+    MapRoot->SetWorldLocation(RootLocation);
+    MapCenter = Centroid;
+
+    // Zoom just below the band so the next band (or no band) splits it
+    SetZoom(ClusterBands[ActiveClusterBand].MinZoom - 1.0f);
+}
+
+void AMapView::HandleMarkerClicked(const FHitResult& HitResult)
+{
+    // Clicking a bubble zooms in until it splits
+    if (ClusterMarkers && HitResult.GetComponent() == ClusterMarkers)
+    {
+        FocusCluster(HitResult.Item);
+        return;
+    }
+
+    EMarkerType Type;
+    FString Id;
+    if (!ResolveMarkerHit(HitResult, Type, Id))
+    {
+        return;
+    }
+
+    switch (Type)
+    {
+        case EMarkerType::Venue:
+            SelectVenue(Id);
+            break;
+
+        case EMarkerType::Player:
+            if (const FPlayerData* Player = FindPlayer(Id))
+            {
+                OnPlayerSelected.Broadcast(*Player);
+            }
+            break;
+
+        case EMarkerType::Event:
+            if (const FEventData* Event = FindEvent(Id))
+            {
+                OnEventSelected.Broadcast(*Event);
+            }
+            break;
+
+        case EMarkerType::Highlight:
+            HandleHighlightMarkerClicked(Id);
+            break;
+    }
+}
+
+void AMapView::HandleMarkerHover(const FHitResult& HitResult)
+{
+    EMarkerType Type;
+    FString Id;
+    if (!ResolveMarkerHit(HitResult, Type, Id))
+    {
+        HideTooltip();
+        return;
+    }
+
+    ShowTooltip(Type, Id);
+}
+
+void AMapView::ShowTooltip(EMarkerType Type, const FString& Id)
+{
+    // Only players and events carry tooltips
+    if (!MarkerTooltip || !TooltipWidgetClass || (Type != EMarkerType::Player && Type != EMarkerType::Event))
+    {
+        HideTooltip();
+        return;
+    }
+
+    const FMarkerInstance* Marker = GetMarkerMap(Type).Find(Id);
+    FTransform Transform;
+    if (!Marker || !GetMarkerTransform(*Marker, Transform))
+    {
+        HideTooltip();
+        return;
+    }
+
+    MarkerTooltip->SetWorldLocation(Transform.GetLocation());
+    MarkerTooltip->SetVisibility(true);
+
+    // Update tooltip content based on marker type
+    if (Type == EMarkerType::Player)
+    {
+        // Update player tooltip
+        if (const FPlayerData* Player = FindPlayer(Id))
+        {
+            // TODO: Update tooltip widget with player data
+        }
+    }
+    else
+    {
+        // Update event tooltip
+        if (const FEventData* Event = FindEvent(Id))
+        {
+            // TODO: Update tooltip widget with event data
+        }
+    }
+}
+
+void AMapView::HideTooltip()
+{
+    if (MarkerTooltip)
+    {
+        MarkerTooltip->SetVisibility(false);
+    }
+}
+
+void AMapView::StartPulseAnimation(EMarkerType Type, const FString& MarkerId)
+{
+    if (PulseCurve)
+    {
+        PulsingMarkers.Emplace(Type, MarkerId);
+    }
+}
+
+void AMapView::StartFadeAnimation(EMarkerType Type, const FString& MarkerId)
+{
+    if (FadeCurve)
+    {
+        FadingMarkers.Emplace(Type, MarkerId);
+    }
+}
+
+void AMapView::StopMarkerAnimation(EMarkerType Type, const FString& MarkerId)
+{
+    const TPair<EMarkerType, FString> Key(Type, MarkerId);
+    PulsingMarkers.Remove(Key);
+    FadingMarkers.Remove(Key);
+}
+
+void AMapView::UpdateMarkerAnimations()
+{
+    SPORTBEACON_SCOPE_CYCLE(MapAnimation);
+
+    if (PulsingMarkers.Num() == 0 && FadingMarkers.Num() == 0)
+    {
+        return;
+    }
+
+    // Each curve is evaluated once per frame, whatever the number of animated markers
+    const float PulseValue = PulseCurve ? EvaluateLoopingCurve(PulseCurve) : 0.0f;
+    const float FadeValue = FadeCurve ? EvaluateLoopingCurve(FadeCurve) : 1.0f;
+
+    if (MarkerAnimationParameters)
+    {
+        if (UMaterialParameterCollectionInstance* Parameters = GetWorld()->GetParameterCollectionInstance(MarkerAnimationParameters))
+        {
+            Parameters->SetScalarParameterValue(PulseParameterName, PulseValue);
+            Parameters->SetScalarParameterValue(FadeParameterName, FadeValue);
+            return;
+        }
+    }
+
+    if (PulseCurve)
+    {
+        OnPulseTimelineUpdate(PulseValue);
+    }
+    if (FadeCurve)
+    {
+        OnFadeTimelineUpdate(FadeValue);
+    }
+}
+
+float AMapView::EvaluateLoopingCurve(const UCurveFloat* Curve) const
+{
+    float MinTime, MaxTime;
+    Curve->GetTimeRange(MinTime, MaxTime);
+    const float Time = MinTime + FMath::Fmod(GetWorld()->GetTimeSeconds(), FMath::Max(MaxTime - MinTime, KINDA_SMALL_NUMBER));
+    return Curve->GetFloatValue(Time);
+}
+
+void AMapView::OnPulseTimelineUpdate(float Value)
+{
+    // Apply pulse effect to marker scale
+    const float BaseScale = 1.0f;
+    const float PulseAmount = 0.2f;
+    const FVector NewScale(BaseScale + (PulseAmount * Value));
+
+    TArray<int32, TInlineAllocator<4>> DirtyBatches;
+    for (const TPair<EMarkerType, FString>& Key : PulsingMarkers)
+    {
+        if (const FMarkerInstance* Marker = GetMarkerMap(Key.Key).Find(Key.Value))
+        {
+            FTransform Transform;
+            if (GetMarkerTransform(*Marker, Transform))
+            {
+                Transform.SetScale3D(NewScale);
+                SetMarkerTransform(*Marker, Transform, false);
+                DirtyBatches.AddUnique(Marker->BatchIndex);
+            }
+        }
+    }
+
+    MarkBatchesRenderStateDirty(DirtyBatches);
+}
+
+void AMapView::OnFadeTimelineUpdate(float Value)
+{
+    // Apply fade effect to marker opacity
+    TArray<int32, TInlineAllocator<4>> DirtyBatches;
+    for (const TPair<EMarkerType, FString>& Key : FadingMarkers)
+    {
+        if (const FMarkerInstance* Marker = GetMarkerMap(Key.Key).Find(Key.Value))
+        {
+            SetMarkerCustomData(*Marker, MapMarkerCustomData::Opacity, Value, false);
+            DirtyBatches.AddUnique(Marker->BatchIndex);
+        }
+    }
+
+    MarkBatchesRenderStateDirty(DirtyBatches);
+}
+
+void AMapView::UpdateHighlights(const TArray<FHighlightData>& Highlights)
+{
+    SPORTBEACON_SCOPE_CYCLE(MapMarkerUpdate);
+    FMarkerUpdateStats Stats;
+
+    TSet<FString> IncomingIds;
+    IncomingIds.Reserve(Highlights.Num());
+    for (const FHighlightData& Highlight : Highlights)
+    {
+        IncomingIds.Add(Highlight.Id);
+    }
+
+    // Remove stale markers first so their slots get recycled by new highlights
+    for (const FHighlightData& Highlight : ActiveHighlights)
+    {
+        if (!IncomingIds.Contains(Highlight.Id))
+        {
+            RemoveMarkerInstance(EMarkerType::Highlight, Highlight.Id);
+            UnindexRecord(EMarkerType::Highlight, Highlight.Id);
+            ++Stats.Removed;
+        }
+    }
+
+    // Move/restyle changed markers and spawn new ones
+    for (const FHighlightData& Highlight : Highlights)
+    {
+        IndexRecord(EMarkerType::Highlight, Highlight.Id, Highlight.Coordinates);
+
+        const int32* ExistingIndex = HighlightIndexById.Find(Highlight.Id);
+        if (!ExistingIndex)
+        {
+            SpawnHighlightMarker(Highlight);
+            ++Stats.Added;
+        }
+        else if (ReconcileHighlightMarker(ActiveHighlights[*ExistingIndex], Highlight))
+        {
+            ++Stats.Changed;
+        }
+        else
+        {
+            ++Stats.Unchanged;
+        }
+    }
+
+    ActiveHighlights = Highlights;
+    RebuildIdIndex(ActiveHighlights, HighlightIndexById);
+    RefillClusterGrid(EMarkerType::Highlight);
+
+    ReportMarkerUpdate(EMarkerType::Highlight, Stats);
+}
+
+bool AMapView::ReconcileHighlightMarker(const FHighlightData& OldHighlight, const FHighlightData& NewHighlight)
+{
+    const bool bMoved = !OldHighlight.Coordinates.Equals(NewHighlight.Coordinates);
+    const bool bRestyled = OldHighlight.HighlightType != NewHighlight.HighlightType;
+    const bool bRefiltered = OldHighlight.PlayerId != NewHighlight.PlayerId;
+
+    if (bRestyled)
+    {
+        MoveMarkerToBatch(EMarkerType::Highlight, NewHighlight.Id,
+            FindOrCreateMarkerBatch(EMarkerType::Highlight, HighlightMarkerMesh, GetHighlightMaterial(NewHighlight.HighlightType)));
+
+        if (const FMarkerInstance* Marker = HighlightMarkers.Find(NewHighlight.Id))
+        {
+            SetMarkerCustomData(*Marker, MapMarkerCustomData::HighlightType, GetHighlightTypeIndex(NewHighlight.HighlightType));
+        }
+    }
+
+    // Visibility also places the marker, so it covers moves as well as filter changes
+    if (bMoved || bRestyled || bRefiltered)
+    {
+        UpdateHighlightMarkerVisibility(NewHighlight);
+    }
+
+    // Remaining fields only live in the stored record
+    return bMoved || bRestyled || bRefiltered
+        || OldHighlight.Description != NewHighlight.Description
+        || OldHighlight.ScoreImpact != NewHighlight.ScoreImpact
+        || OldHighlight.ConfidenceScore != NewHighlight.ConfidenceScore
+        || OldHighlight.Timestamp != NewHighlight.Timestamp;
+}
+
+void AMapView::SetHighlightFilters(const FString& PlayerFilter, const FString& TeamFilter, const FString& TypeFilter)
+{
+    SPORTBEACON_SCOPE_CYCLE(MapMarkerUpdate);
+
+    CurrentPlayerFilter = PlayerFilter;
+    CurrentTeamFilter = TeamFilter;
+    CurrentTypeFilter = TypeFilter;
+
+    // Update visibility of existing markers based on new filters
+    for (const auto& Highlight : ActiveHighlights)
+    {
+        UpdateHighlightMarkerVisibility(Highlight);
+    }
+
+    // Filtered highlights do not count towards clusters
+    RefillClusterGrid(EMarkerType::Highlight);
+}
+
+void AMapView::ClearHighlightFilters()
+{
+    CurrentPlayerFilter.Empty();
+    CurrentTeamFilter.Empty();
+    CurrentTypeFilter.Empty();
+
+    // Show all markers
+    for (const auto& Highlight : ActiveHighlights)
+    {
+        UpdateHighlightMarkerVisibility(Highlight);
+    }
+
+    RefillClusterGrid(EMarkerType::Highlight);
+}
+
+void AMapView::SpawnHighlightMarker(const FHighlightData& HighlightData)
+{
+    if (!ShouldMaterialize(EMarkerType::Highlight, HighlightData.Coordinates))
+    {
+        return;
+    }
+
+    if (!HighlightMarkerMesh)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Highlight marker mesh not set"));
+        return;
+    }
+
+    int32 BatchIndex = FindOrCreateMarkerBatch(
+        EMarkerType::Highlight,
+        HighlightMarkerMesh,
+        GetHighlightMaterial(HighlightData.HighlightType)
+    );
+    if (BatchIndex == INDEX_NONE)
+    {
+        return;
+    }
+
+    float CustomData[MapMarkerCustomData::Num] = {};
+    CustomData[MapMarkerCustomData::HighlightType] = GetHighlightTypeIndex(HighlightData.HighlightType);
+    CustomData[MapMarkerCustomData::Opacity] = 1.0f;
+
+    // Set world location based on map coordinates
+    FTransform Transform(ProjectRecord(EMarkerType::Highlight, HighlightData.Id, HighlightData.Coordinates));
+    AddMarkerInstance(EMarkerType::Highlight, HighlightData.Id, BatchIndex, Transform, CustomData);
+
+    // Update visibility based on current filters
+    UpdateHighlightMarkerVisibility(HighlightData);
+}
+
+void AMapView::UpdateHighlightMarkerVisibility(const FHighlightData& HighlightData)
+{
+    const FMarkerInstance* Marker = HighlightMarkers.Find(HighlightData.Id);
+    if (!Marker)
+    {
+        return;
+    }
+
+    const bool bShouldBeVisible = PassesHighlightFilters(HighlightData);
+
+    // Instances cannot be hidden individually, so filtered markers collapse to zero scale
+    FTransform Transform(ProjectRecord(EMarkerType::Highlight, HighlightData.Id, HighlightData.Coordinates));
+    Transform.SetScale3D(bShouldBeVisible ? FVector::OneVector : FVector::ZeroVector);
+    SetMarkerTransform(*Marker, Transform);
+}
+
+bool AMapView::PassesHighlightFilters(const FHighlightData& HighlightData) const
+{
+    if (!CurrentPlayerFilter.IsEmpty() && HighlightData.PlayerId != CurrentPlayerFilter)
+    {
+        return false;
     }
 
-    Marker->SetVisibility(bShouldBeVisible);
+    if (!CurrentTypeFilter.IsEmpty() && HighlightData.HighlightType != CurrentTypeFilter)
+    {
+        return false;
+    }
+
+    return true;
 }
 
 UMaterialInterface* AMapView::GetHighlightMaterial(const FString& HighlightType)
@@ -733,17 +1914,284 @@ UMaterialInterface* AMapView::GetHighlightMaterial(const FString& HighlightType)
     return ClutchPlayMaterial; // Default material
 }
 
-void AMapView::HandleHighlightMarkerClicked(UPrimitiveComponent* ClickedComponent)
+float AMapView::GetHighlightTypeIndex(const FString& HighlightType) const
 {
-    for (const auto& Highlight : ActiveHighlights)
+    if (HighlightType == TEXT("HotStreak"))
     {
-        if (UStaticMeshComponent* Marker = HighlightMarkers.FindRef(Highlight.Id))
+        return 1.0f;
+    }
+    else if (HighlightType == TEXT("MomentumShift"))
+    {
+        return 2.0f;
+    }
+    else if (HighlightType == TEXT("ImpactPlay"))
+    {
+        return 3.0f;
+    }
+
+    return 0.0f; // ClutchPlay and unknown types
+}
+
+void AMapView::HandleHighlightMarkerClicked(const FString& HighlightId)
+{
+    if (const FHighlightData* Highlight = FindHighlight(HighlightId))
+    {
+        OnHighlightSelected.Broadcast(*Highlight);
+    }
+}
+
+int32 AMapView::FindOrCreateMarkerBatch(EMarkerType Type, UStaticMesh* Mesh, UMaterialInterface* Material)
+{
+    if (!Mesh)
+    {
+        return INDEX_NONE;
+    }
+
+    // Only a handful of batches exist, so a linear search is fine
+    for (int32 Index = 0; Index < MarkerBatches.Num(); ++Index)
+    {
+        const FMarkerBatch& Batch = MarkerBatches[Index];
+        if (Batch.Type == Type && Batch.Material == Material && Batch.Component && Batch.Component->GetStaticMesh() == Mesh)
         {
-            if (Marker == ClickedComponent)
-            {
-                OnHighlightSelected.Broadcast(Highlight);
-                break;
-            }
+            return Index;
+        }
+    }
+
+    UHierarchicalInstancedStaticMeshComponent* Component = NewObject<UHierarchicalInstancedStaticMeshComponent>(this);
+    Component->SetupAttachment(MapRoot);
+
+    // Instances are placed in world space, independent of camera panning
+    Component->SetUsingAbsoluteLocation(true);
+    Component->SetUsingAbsoluteRotation(true);
+    Component->SetUsingAbsoluteScale(true);
+    Component->SetWorldTransform(FTransform::Identity);
+
+    Component->SetMobility(EComponentMobility::Movable);
+    Component->SetStaticMesh(Mesh);
+    if (Material)
+    {
+        Component->SetMaterial(0, Material);
+    }
+    Component->SetNumCustomDataFloats(MapMarkerCustomData::Num);
+    Component->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+    Component->SetCollisionResponseToAllChannels(ECR_Block);
+    Component->RegisterComponent();
+    AddInstanceComponent(Component);
+
+    FMarkerBatch& NewBatch = MarkerBatches.AddDefaulted_GetRef();
+    NewBatch.Component = Component;
+    NewBatch.Material = Material;
+    NewBatch.Type = Type;
+
+    const int32 BatchIndex = MarkerBatches.Num() - 1;
+    BatchIndexByComponent.Add(Component, BatchIndex);
+    ReserveMarkerInstances(BatchIndex, MarkerPoolWarmupSize);
+    return BatchIndex;
+}
+
+void AMapView::WarmUpMarkerPools()
+{
+    // Create every batch the configured assets can produce, each with its warm-up slots
+    FindOrCreateMarkerBatch(EMarkerType::Venue, DefaultVenueMarker, IndoorVenueMaterial);
+    FindOrCreateMarkerBatch(EMarkerType::Venue, DefaultVenueMarker, OutdoorVenueMaterial);
+    FindOrCreateMarkerBatch(EMarkerType::Player, PlayerMarkerMesh, ActivePlayerMaterial);
+    FindOrCreateMarkerBatch(EMarkerType::Player, PlayerMarkerMesh, InactivePlayerMaterial);
+    FindOrCreateMarkerBatch(EMarkerType::Event, EventMarkerMesh, LiveEventMaterial);
+    FindOrCreateMarkerBatch(EMarkerType::Event, EventMarkerMesh, UpcomingEventMaterial);
+
+    for (const TCHAR* HighlightType : { TEXT("ClutchPlay"), TEXT("HotStreak"), TEXT("MomentumShift"), TEXT("ImpactPlay") })
+    {
+        FindOrCreateMarkerBatch(EMarkerType::Highlight, HighlightMarkerMesh, GetHighlightMaterial(HighlightType));
+    }
+}
+
+void AMapView::ReserveMarkerInstances(int32 BatchIndex, int32 Count)
+{
+    if (Count <= 0 || !MarkerBatches.IsValidIndex(BatchIndex) || !MarkerBatches[BatchIndex].Component)
+    {
+        return;
+    }
+
+    FMarkerBatch& Batch = MarkerBatches[BatchIndex];
+
+    // Hidden the same way removed markers are, so they behave exactly like recycled slots
+    FTransform HiddenTransform;
+    HiddenTransform.SetScale3D(FVector::ZeroVector);
+
+    TArray<FTransform> Transforms;
+    Transforms.Init(HiddenTransform, Count);
+    const TArray<int32> NewIndices = Batch.Component->AddInstances(Transforms, true, true);
+
+    Batch.InstanceIds.SetNum(Batch.Component->GetInstanceCount());
+
+    // Free slots are popped from the back, so push in reverse to hand out low indices first
+    Batch.FreeInstances.Reserve(Batch.FreeInstances.Num() + NewIndices.Num());
+    for (int32 Index = NewIndices.Num() - 1; Index >= 0; --Index)
+    {
+        Batch.FreeInstances.Add(NewIndices[Index]);
+    }
+}
+
+TMap<FString, FMarkerInstance>& AMapView::GetMarkerMap(EMarkerType Type)
+{
+    switch (Type)
+    {
+        case EMarkerType::Player:
+            return PlayerMarkers;
+        case EMarkerType::Event:
+            return EventMarkers;
+        case EMarkerType::Highlight:
+            return HighlightMarkers;
+        default:
+            return VenueMarkers;
+    }
+}
+
+void AMapView::AddMarkerInstance(EMarkerType Type, const FString& Id, int32 BatchIndex, const FTransform& Transform, TArrayView<const float> CustomData)
+{
+    if (!MarkerBatches.IsValidIndex(BatchIndex))
+    {
+        return;
+    }
+
+    // Replace any marker already registered under this Id
+    RemoveMarkerInstance(Type, Id);
+
+    FMarkerBatch& Batch = MarkerBatches[BatchIndex];
+    int32 InstanceIndex;
+    if (Batch.FreeInstances.Num() > 0)
+    {
+        // Recycle a slot left behind by a removed marker
+        InstanceIndex = Batch.FreeInstances.Pop(false);
+        Batch.Component->UpdateInstanceTransform(InstanceIndex, Transform, true, false, true);
+        ++PoolHits;
+    }
+    else
+    {
+        InstanceIndex = Batch.Component->AddInstance(Transform, true);
+        ++PoolMisses;
+    }
+    Batch.Component->SetCustomData(InstanceIndex, CustomData, true);
+
+    if (Batch.InstanceIds.Num() <= InstanceIndex)
+    {
+        Batch.InstanceIds.SetNum(InstanceIndex + 1);
+    }
+    Batch.InstanceIds[InstanceIndex] = Id;
+
+    FMarkerInstance& Marker = GetMarkerMap(Type).Add(Id);
+    Marker.BatchIndex = BatchIndex;
+    Marker.InstanceIndex = InstanceIndex;
+}
+
+void AMapView::RemoveMarkerInstance(EMarkerType Type, const FString& Id)
+{
+    FMarkerInstance Marker;
+    if (!GetMarkerMap(Type).RemoveAndCopyValue(Id, Marker) || !MarkerBatches.IsValidIndex(Marker.BatchIndex))
+    {
+        return;
+    }
+
+    FMarkerBatch& Batch = MarkerBatches[Marker.BatchIndex];
+    if (!Batch.Component || !Batch.InstanceIds.IsValidIndex(Marker.InstanceIndex))
+    {
+        return;
+    }
+
+    // Collapse the instance instead of removing it, which keeps every other index stable
+    FTransform HiddenTransform;
+    HiddenTransform.SetScale3D(FVector::ZeroVector);
+    Batch.Component->UpdateInstanceTransform(Marker.InstanceIndex, HiddenTransform, true, true, true);
+
+    Batch.InstanceIds[Marker.InstanceIndex].Reset();
+    Batch.FreeInstances.Add(Marker.InstanceIndex);
+}
+
+void AMapView::MoveMarkerToBatch(EMarkerType Type, const FString& Id, int32 NewBatchIndex)
+{
+    const FMarkerInstance* Marker = GetMarkerMap(Type).Find(Id);
+    if (!Marker || Marker->BatchIndex == NewBatchIndex || !MarkerBatches.IsValidIndex(NewBatchIndex))
+    {
+        return;
+    }
+
+    // Carry the transform and custom data over to the new batch
+    FTransform Transform;
+    GetMarkerTransform(*Marker, Transform);
+
+    const FMarkerBatch& OldBatch = MarkerBatches[Marker->BatchIndex];
+    const int32 DataOffset = Marker->InstanceIndex * MapMarkerCustomData::Num;
+    TArray<float, TInlineAllocator<MapMarkerCustomData::Num>> CustomData;
+    CustomData.Append(&OldBatch.Component->PerInstanceSMCustomData[DataOffset], MapMarkerCustomData::Num);
+
+    AddMarkerInstance(Type, Id, NewBatchIndex, Transform, CustomData);
+}
+
+void AMapView::SetMarkerTransform(const FMarkerInstance& Marker, const FTransform& Transform, bool bMarkRenderStateDirty)
+{
+    if (MarkerBatches.IsValidIndex(Marker.BatchIndex) && MarkerBatches[Marker.BatchIndex].Component)
+    {
+        MarkerBatches[Marker.BatchIndex].Component->UpdateInstanceTransform(
+            Marker.InstanceIndex, Transform, true, bMarkRenderStateDirty, true);
+    }
+}
+
+void AMapView::SetMarkerLocation(const FMarkerInstance& Marker, const FVector& Location, bool bMarkRenderStateDirty)
+{
+    FTransform Transform;
+    if (GetMarkerTransform(Marker, Transform))
+    {
+        Transform.SetLocation(Location);
+        SetMarkerTransform(Marker, Transform, bMarkRenderStateDirty);
+    }
+}
+
+void AMapView::SetMarkerCustomData(const FMarkerInstance& Marker, int32 DataIndex, float Value, bool bMarkRenderStateDirty)
+{
+    if (MarkerBatches.IsValidIndex(Marker.BatchIndex) && MarkerBatches[Marker.BatchIndex].Component)
+    {
+        MarkerBatches[Marker.BatchIndex].Component->SetCustomDataValue(
+            Marker.InstanceIndex, DataIndex, Value, bMarkRenderStateDirty);
+    }
+}
+
+void AMapView::MarkBatchesRenderStateDirty(TArrayView<const int32> BatchIndices)
+{
+    for (const int32 BatchIndex : BatchIndices)
+    {
+        if (MarkerBatches.IsValidIndex(BatchIndex) && MarkerBatches[BatchIndex].Component)
+        {
+            MarkerBatches[BatchIndex].Component->MarkRenderStateDirty();
         }
     }
-} 
\ No newline at end of file
+}
+
+bool AMapView::GetMarkerTransform(const FMarkerInstance& Marker, FTransform& OutTransform) const
+{
+    if (MarkerBatches.IsValidIndex(Marker.BatchIndex) && MarkerBatches[Marker.BatchIndex].Component)
+    {
+        return MarkerBatches[Marker.BatchIndex].Component->GetInstanceTransform(Marker.InstanceIndex, OutTransform, true);
+    }
+
+    return false;
+}
+
+bool AMapView::ResolveMarkerHit(const FHitResult& HitResult, EMarkerType& OutType, FString& OutId) const
+{
+    // For instanced components the hit item is the instance index
+    const int32* BatchIndex = BatchIndexByComponent.Find(HitResult.GetComponent());
+    if (!BatchIndex || HitResult.Item == INDEX_NONE)
+    {
+        return false;
+    }
+
+    const FMarkerBatch& Batch = MarkerBatches[*BatchIndex];
+    if (!Batch.InstanceIds.IsValidIndex(HitResult.Item) || Batch.InstanceIds[HitResult.Item].IsEmpty())
+    {
+        return false;
+    }
+
+    OutType = Batch.Type;
+    OutId = Batch.InstanceIds[HitResult.Item];
+    return true;
+}
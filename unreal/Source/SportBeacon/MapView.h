@@ -5,9 +5,14 @@
 #include "Camera/CameraComponent.h"
 #include "Components/SceneComponent.h"
 #include "Components/WidgetComponent.h"
+#include "Components/HierarchicalInstancedStaticMeshComponent.h"
 #include "TimerManager.h"
+#include "MapSpatialIndex.h"
+#include "MapProjection.h"
 #include "MapView.generated.h"
 
+class UMaterialParameterCollection;
+
 UENUM(BlueprintType)
 enum class EMarkerType : uint8
 {
@@ -129,12 +134,146 @@ struct FHighlightData
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite)
     FVector2D Coordinates;
+
+    // Clip for the highlight, empty if it has none
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    FString MediaUrl;
+};
+
+// Per-instance custom data layout shared by all marker materials
+namespace MapMarkerCustomData
+{
+    constexpr int32 Indoor = 0;         // 1 for indoor venues
+    constexpr int32 Active = 1;         // 1 for active players and live events
+    constexpr int32 HighlightType = 2;  // Index into GetHighlightTypeIndex
+    constexpr int32 Opacity = 3;        // Driven by the fade animation
+    constexpr int32 Num = 4;
+}
+
+// Per-instance custom data layout of the cluster bubble material
+namespace MapClusterCustomData
+{
+    constexpr int32 Count = 0;          // Number of markers folded into the bubble
+    constexpr int32 MarkerType = 1;     // EMarkerType of the folded markers
+    constexpr int32 Num = 2;
+}
+
+// Zoom band in which nearby markers fold into count bubbles
+USTRUCT(BlueprintType)
+struct FMapClusterBand
+{
+    GENERATED_BODY()
+
+    // Band applies while CurrentZoom is at or above this, the highest matching band wins
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    float MinZoom = 0.0f;
+
+    // Cluster cell size in degrees
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    float CellSize = 1.0f;
+};
+
+// One instanced mesh component per marker type/material combination
+USTRUCT()
+struct FMarkerBatch
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    UHierarchicalInstancedStaticMeshComponent* Component = nullptr;
+
+    UPROPERTY()
+    UMaterialInterface* Material = nullptr;
+
+    EMarkerType Type = EMarkerType::Venue;
+
+    // Record Id for each instance index, used to resolve hits back to records
+    TArray<FString> InstanceIds;
+
+    // Hidden instances left behind by removed markers, reused before adding new ones
+    TArray<int32> FreeInstances;
+};
+
+// Location of a single marker within the marker batches
+struct FMarkerInstance
+{
+    int32 BatchIndex = INDEX_NONE;
+    int32 InstanceIndex = INDEX_NONE;
+};
+
+// One streamed location ping, Timestamp is the server time in seconds
+USTRUCT(BlueprintType)
+struct FPlayerLocationSample
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    FString PlayerId;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    FVector2D Coordinates;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite)
+    double Timestamp = 0.0;
+};
+
+// In-flight interpolation of a player marker towards its latest sample
+struct FPlayerLocationTrack
+{
+    FVector From = FVector::ZeroVector;
+    FVector To = FVector::ZeroVector;
+    double StartTime = 0.0;
+    double Duration = 0.0;
+};
+
+// Churn report produced by each reconciling Update* call
+USTRUCT(BlueprintType)
+struct FMarkerUpdateStats
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly)
+    int32 Added = 0;
+
+    UPROPERTY(BlueprintReadOnly)
+    int32 Removed = 0;
+
+    UPROPERTY(BlueprintReadOnly)
+    int32 Changed = 0;
+
+    UPROPERTY(BlueprintReadOnly)
+    int32 Unchanged = 0;
+};
+
+// Slot reuse across all marker batches
+USTRUCT(BlueprintType)
+struct FMarkerPoolStats
+{
+    GENERATED_BODY()
+
+    // Markers placed in a recycled or pre-warmed slot
+    UPROPERTY(BlueprintReadOnly)
+    int32 Hits = 0;
+
+    // Markers that had to grow their batch
+    UPROPERTY(BlueprintReadOnly)
+    int32 Misses = 0;
+
+    UPROPERTY(BlueprintReadOnly)
+    int32 Batches = 0;
+
+    UPROPERTY(BlueprintReadOnly)
+    int32 TotalSlots = 0;
+
+    UPROPERTY(BlueprintReadOnly)
+    int32 FreeSlots = 0;
 };
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnVenueSelectedSignature, const FVenueData&, SelectedVenue);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnPlayerSelectedSignature, const FPlayerData&, SelectedPlayer);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnEventSelectedSignature, const FEventData&, SelectedEvent);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnHighlightSelectedSignature, const FHighlightData&, SelectedHighlight);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnMarkersUpdatedSignature, EMarkerType, MarkerType, const FMarkerUpdateStats&, Stats);
 
 UCLASS()
 class SPORTBEACON_API AMapView : public AActor
@@ -161,6 +300,10 @@ public:
     UFUNCTION(BlueprintCallable, Category = "MapView|Camera")
     void RotateCamera(float YawDelta);
 
+    // Map coordinates under the camera, from the camera itself so pans, focus and rebasing all agree
+    UFUNCTION(BlueprintPure, Category = "MapView|Camera")
+    FVector2D GetMapCenter() const;
+
     // Venue management
     UFUNCTION(BlueprintCallable, Category = "MapView|Venues")
     void UpdateVenues(const TArray<FVenueData>& NewVenues);
@@ -168,6 +311,9 @@ public:
     UFUNCTION(BlueprintCallable, Category = "MapView|Venues")
     void SelectVenue(const FString& VenueId);
 
+    UFUNCTION(BlueprintCallable, Category = "MapView|Venues")
+    bool GetVenueById(const FString& VenueId, FVenueData& OutVenue) const;
+
     // Player management
     UFUNCTION(BlueprintCallable, Category = "MapView|Players")
     void UpdatePlayers(const TArray<FPlayerData>& NewPlayers);
@@ -175,9 +321,22 @@ public:
     UFUNCTION(BlueprintCallable, Category = "MapView|Players")
     void UpdatePlayerLocation(const FString& PlayerId, const FVector2D& NewLocation);
 
+    // Applies a batch of location samples in one pass, markers glide to them in Tick
+    UFUNCTION(BlueprintCallable, Category = "MapView|Players")
+    void UpdatePlayerLocations(const TArray<FPlayerLocationSample>& Samples);
+
+    // Decodes a packed websocket payload and forwards it to UpdatePlayerLocations.
+    // Layout (little endian): uint32 Count, then Count x { uint8 IdLength, UTF-8 Id, double X, double Y, double Timestamp }.
+    // Returns the number of samples decoded.
+    UFUNCTION(BlueprintCallable, Category = "MapView|Players")
+    int32 UpdatePlayerLocationsFromPayload(const TArray<uint8>& Payload);
+
     UFUNCTION(BlueprintCallable, Category = "MapView|Players")
     void UpdatePlayerStatus(const FString& PlayerId, const FString& NewStatus);
 
+    UFUNCTION(BlueprintCallable, Category = "MapView|Players")
+    bool GetPlayerById(const FString& PlayerId, FPlayerData& OutPlayer) const;
+
     // Event management
     UFUNCTION(BlueprintCallable, Category = "MapView|Events")
     void UpdateEvents(const TArray<FEventData>& NewEvents);
@@ -199,6 +358,16 @@ public:
     UPROPERTY(BlueprintAssignable, Category = "Events")
     FOnHighlightSelectedSignature OnHighlightSelected;
 
+    // Fired after every Update* call with the added/removed/changed counts
+    UPROPERTY(BlueprintAssignable, Category = "MapView|Events")
+    FOnMarkersUpdatedSignature OnMarkersUpdated;
+
+    UFUNCTION(BlueprintPure, Category = "MapView|Stats")
+    FMarkerUpdateStats GetLastUpdateStats(EMarkerType MarkerType) const;
+
+    UFUNCTION(BlueprintPure, Category = "MapView|Stats")
+    FMarkerPoolStats GetMarkerPoolStats() const;
+
     // Add new functions
     UFUNCTION(BlueprintCallable, Category = "Highlights")
     void UpdateHighlights(const TArray<FHighlightData>& Highlights);
@@ -209,6 +378,26 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Highlights")
     void ClearHighlightFilters();
 
+    // Proximity queries, answered from the spatial index and sorted nearest first
+    UFUNCTION(BlueprintCallable, Category = "MapView|Queries")
+    void GetVenuesWithinRadius(const FVector2D& Center, float RadiusKm, TArray<FVenueData>& OutVenues) const;
+
+    UFUNCTION(BlueprintCallable, Category = "MapView|Queries")
+    bool GetVenuesNearPlayer(const FString& PlayerId, float RadiusKm, TArray<FVenueData>& OutVenues) const;
+
+    UFUNCTION(BlueprintCallable, Category = "MapView|Queries")
+    void GetNearestVenues(const FVector2D& Center, int32 Count, TArray<FVenueData>& OutVenues) const;
+
+    UFUNCTION(BlueprintCallable, Category = "MapView|Queries")
+    void GetPlayersWithinRadius(const FVector2D& Center, float RadiusKm, TArray<FPlayerData>& OutPlayers) const;
+
+    // Marker picking, fed with hit results from the player controller
+    UFUNCTION(BlueprintCallable, Category = "MapView|Selection")
+    void HandleMarkerClicked(const FHitResult& HitResult);
+
+    UFUNCTION(BlueprintCallable, Category = "MapView|Selection")
+    void HandleMarkerHover(const FHitResult& HitResult);
+
 protected:
     // Components
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "MapView")
@@ -217,6 +406,14 @@ protected:
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "MapView")
     UCameraComponent* MapCamera;
 
+    // Shared tooltip, moved to whichever marker is hovered
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "MapView")
+    UWidgetComponent* MarkerTooltip;
+
+    // Count bubbles for clustered players and highlights
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "MapView")
+    UInstancedStaticMeshComponent* ClusterMarkers;
+
     // Map properties
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MapView|Settings")
     float MinZoom;
@@ -233,6 +430,56 @@ protected:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MapView|Settings")
     float RotationSpeed;
 
+    // Streamed player locations
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MapView|Streaming")
+    bool bInterpolatePlayerLocations;
+
+    // Used for the first sample of a player, later ones follow the server's sample spacing
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MapView|Streaming")
+    float DefaultLocationInterpolationTime;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MapView|Streaming")
+    float MaxLocationInterpolationTime;
+
+    // World units per degree of longitude
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MapView|Projection")
+    float ProjectionWorldScale;
+
+    // Once the camera is this far from the world origin, the projection origin moves under it.
+    // World units, so it scales with ProjectionWorldScale: 2000 is 20 degrees at the default 100.
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MapView|Projection")
+    float RebaseDistance;
+
+    // Hidden instance slots created up front for every batch, so early updates do not grow batches
+    UPROPERTY(EditDefaultsOnly, Category = "MapView|Pooling")
+    int32 MarkerPoolWarmupSize;
+
+    // Only records inside the camera footprint get marker instances
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MapView|Culling")
+    bool bEnableViewportCulling;
+
+    // Footprint scale used for the culled region, so small pans do not churn markers
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MapView|Culling")
+    float CullingMargin;
+
+    // Grid cell size of the spatial indices, in degrees
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MapView|Culling")
+    float SpatialIndexCellSize;
+
+    // Players and highlights cluster per zoom band, no band matching means no clustering
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MapView|Clustering")
+    TArray<FMapClusterBand> ClusterBands;
+
+    // Cells with fewer markers than this keep showing them individually
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MapView|Clustering")
+    int32 MinClusterSize;
+
+    UPROPERTY(EditDefaultsOnly, Category = "MapView|Clustering")
+    UStaticMesh* ClusterMarkerMesh;
+
+    UPROPERTY(EditDefaultsOnly, Category = "MapView|Clustering")
+    UMaterialInterface* ClusterMaterial;
+
     // Venue data
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "MapView|Data")
     TArray<FVenueData> Venues;
@@ -273,6 +520,17 @@ protected:
     UPROPERTY(EditDefaultsOnly, Category = "MapView|Animation")
     UCurveFloat* FadeCurve;
 
+    // When set, curve values are published here once per frame and marker materials animate
+    // from it plus their Active custom data, with no per-instance updates at all
+    UPROPERTY(EditDefaultsOnly, Category = "MapView|Animation")
+    UMaterialParameterCollection* MarkerAnimationParameters;
+
+    UPROPERTY(EditDefaultsOnly, Category = "MapView|Animation")
+    FName PulseParameterName;
+
+    UPROPERTY(EditDefaultsOnly, Category = "MapView|Animation")
+    FName FadeParameterName;
+
     // Add new member variables
     UPROPERTY(EditDefaultsOnly, Category = "Markers|Highlights")
     UStaticMesh* HighlightMarkerMesh;
@@ -291,27 +549,76 @@ protected:
 
     // Add new helper functions
     void SpawnHighlightMarker(const FHighlightData& HighlightData);
-    void UpdateHighlightMarkerVisibility(const FHighlightData& HighlightData, UStaticMeshComponent* Marker);
+    void UpdateHighlightMarkerVisibility(const FHighlightData& HighlightData);
+    bool PassesHighlightFilters(const FHighlightData& HighlightData) const;
     UMaterialInterface* GetHighlightMaterial(const FString& HighlightType);
-    void HandleHighlightMarkerClicked(UPrimitiveComponent* ClickedComponent);
-
-    // Cached components
-    TMap<FString, AActor*> VenueMarkers;
-    TMap<FString, AActor*> PlayerMarkers;
-    TMap<FString, AActor*> EventMarkers;
-    TMap<FString, UWidgetComponent*> MarkerTooltips;
-    TMap<FString, FTimerHandle> AnimationTimers;
+    float GetHighlightTypeIndex(const FString& HighlightType) const;
+    void HandleHighlightMarkerClicked(const FString& HighlightId);
+
+    // Instanced marker batches
+    UPROPERTY()
+    TArray<FMarkerBatch> MarkerBatches;
+
+    // Marker Id -> instance lookups
+    TMap<FString, FMarkerInstance> VenueMarkers;
+    TMap<FString, FMarkerInstance> PlayerMarkers;
+    TMap<FString, FMarkerInstance> EventMarkers;
+
+    // Markers driven by the shared pulse (events) and fade (players) animations,
+    // keyed by type as well since ids are only unique within one type
+    TSet<TPair<EMarkerType, FString>> PulsingMarkers;
+    TSet<TPair<EMarkerType, FString>> FadingMarkers;
+    TMap<EMarkerType, FMarkerUpdateStats> LastUpdateStats;
+    int32 PoolHits;
+    int32 PoolMisses;
 
     // Data storage
     TArray<FPlayerData> Players;
     TArray<FEventData> Events;
 
+    // Id -> array slot indices, rebuilt whenever the matching array is replaced
+    TMap<FString, int32> VenueIndexById;
+    TMap<FString, int32> PlayerIndexById;
+    TMap<FString, int32> EventIndexById;
+    TMap<FString, int32> HighlightIndexById;
+
+    // Projection with its origin near the camera, plus projected locations per record.
+    // Events sit on their venue, so they share the venue cache.
+    FMapProjection Projection;
+    mutable FMapProjectionCache VenueLocationCache;
+    mutable FMapProjectionCache PlayerLocationCache;
+    mutable FMapProjectionCache HighlightLocationCache;
+
+    // Spatial indices over record coordinates, events use their venue's coordinates
+    FMapSpatialIndex VenueSpatialIndex;
+    FMapSpatialIndex PlayerSpatialIndex;
+    FMapSpatialIndex EventSpatialIndex;
+    FMapSpatialIndex HighlightSpatialIndex;
+
+    // Coordinate region currently materialized, and a bit per marker type whose records moved since
+    FBox2D CullBounds;
+    uint8 DirtyCullingTypes;
+
+    // Running cluster counts for the active band, and the centroid behind each bubble instance
+    FMapClusterGrid PlayerClusters;
+    FMapClusterGrid HighlightClusters;
+    int32 ActiveClusterBand;
+    bool bClustersDirty;
+    TArray<FVector2D> ClusterCentroids;
+
+    // Streamed location state per player
+    TMap<FString, FPlayerLocationTrack> PlayerLocationTracks;
+    TMap<FString, double> LastLocationSampleTimes;
+
+    // Marker component -> batch index, for resolving clicks without scanning batches
+    TMap<const UPrimitiveComponent*, int32> BatchIndexByComponent;
+
     // Map properties
     FVector2D MapCenter;
     float CurrentZoom;
 
     // Add new member variables
-    TMap<FString, UStaticMeshComponent*> HighlightMarkers;
+    TMap<FString, FMarkerInstance> HighlightMarkers;
     TArray<FHighlightData> ActiveHighlights;
     FString CurrentPlayerFilter;
     FString CurrentTeamFilter;
@@ -321,18 +628,83 @@ private:
     // Internal methods
     void SpawnVenueMarkers();
     void UpdateMarkerVisuals();
+    // Venue marker scale for the current zoom, shared by spawning and UpdateMarkerVisuals
+    float GetVenueMarkerScale() const;
     FVector LatLongToWorldLocation(const FVector2D& Coordinates) const;
+    FVector2D WorldLocationToLatLong(const FVector& Location) const;
+    const FVector& ProjectRecord(EMarkerType Type, const FString& Id, const FVector2D& Coordinates) const;
+    FMapProjectionCache* GetLocationCache(EMarkerType Type) const;
+    void UpdateProjectionOrigin();
+    void RebaseOrigin(const FVector2D& NewOrigin);
     
-    void SpawnPlayerMarkers();
-    void SpawnEventMarkers();
+    void SpawnVenueMarker(const FVenueData& Venue);
+    void SpawnPlayerMarker(const FPlayerData& Player);
+    void SpawnEventMarker(const FEventData& Event);
     void UpdateMarkerAnimations();
-    void HandleMarkerHover(AActor* HoveredActor);
-    void ShowTooltip(AActor* MarkerActor);
+    void UpdatePlayerLocationTracks();
+    void MarkBatchesRenderStateDirty(TArrayView<const int32> BatchIndices);
+    void ShowTooltip(EMarkerType Type, const FString& Id);
     void HideTooltip();
-    
-    UFUNCTION()
+
+    // Instanced marker helpers
+    int32 FindOrCreateMarkerBatch(EMarkerType Type, UStaticMesh* Mesh, UMaterialInterface* Material);
+    void WarmUpMarkerPools();
+    void ReserveMarkerInstances(int32 BatchIndex, int32 Count);
+    TMap<FString, FMarkerInstance>& GetMarkerMap(EMarkerType Type);
+    void AddMarkerInstance(EMarkerType Type, const FString& Id, int32 BatchIndex, const FTransform& Transform, TArrayView<const float> CustomData);
+    void RemoveMarkerInstance(EMarkerType Type, const FString& Id);
+    void MoveMarkerToBatch(EMarkerType Type, const FString& Id, int32 NewBatchIndex);
+    void SetMarkerTransform(const FMarkerInstance& Marker, const FTransform& Transform, bool bMarkRenderStateDirty = true);
+    void SetMarkerLocation(const FMarkerInstance& Marker, const FVector& Location, bool bMarkRenderStateDirty = true);
+    void SetMarkerCustomData(const FMarkerInstance& Marker, int32 DataIndex, float Value, bool bMarkRenderStateDirty = true);
+    bool GetMarkerTransform(const FMarkerInstance& Marker, FTransform& OutTransform) const;
+    bool ResolveMarkerHit(const FHitResult& HitResult, EMarkerType& OutType, FString& OutId) const;
+    FVector2D FindVenueCoordinates(const FString& VenueId) const;
+
+    // O(1) record lookups through the Id indices
+    const FVenueData* FindVenue(const FString& VenueId) const;
+    FPlayerData* FindPlayer(const FString& PlayerId);
+    const FPlayerData* FindPlayer(const FString& PlayerId) const;
+    FEventData* FindEvent(const FString& EventId);
+    const FEventData* FindEvent(const FString& EventId) const;
+    const FHighlightData* FindHighlight(const FString& HighlightId) const;
+    FVector GetEventMarkerLocation(const FEventData& Event) const;
+    void ReportMarkerUpdate(EMarkerType Type, const FMarkerUpdateStats& Stats);
+
+    // Viewport culling
+    FMapSpatialIndex& GetSpatialIndex(EMarkerType Type);
+    void MarkCullingDirty(EMarkerType Type);
+    void IndexRecord(EMarkerType Type, const FString& Id, const FVector2D& Coordinates);
+    void UnindexRecord(EMarkerType Type, const FString& Id);
+    FBox2D GetViewCoordinateBounds(float Scale) const;
+    bool ShouldMaterialize(EMarkerType Type, const FVector2D& Coordinates) const;
+    void UpdateMarkerCulling();
+    void ApplyMarkerCulling(EMarkerType Type);
+    void SpawnMarkerById(EMarkerType Type, const FString& Id);
+
+    // Clustering
+    void SetZoom(float NewZoom);
+    void UpdateClusterBand();
+    void RefillClusterGrid(EMarkerType Type);
+    bool IsClustered(EMarkerType Type, const FVector2D& Coordinates) const;
+    void RebuildClusterMarkers();
+    void FocusCluster(int32 ClusterIndex);
+
+    // Reconciliation of a single changed record, returns true if anything differed
+    bool ReconcileVenueMarker(const FVenueData& OldVenue, const FVenueData& NewVenue);
+    bool ReconcilePlayerMarker(const FPlayerData& OldPlayer, const FPlayerData& NewPlayer);
+    bool ReconcileEventMarker(const FEventData& OldEvent, const FEventData& NewEvent);
+    bool ReconcileHighlightMarker(const FHighlightData& OldHighlight, const FHighlightData& NewHighlight);
+    void ApplyPlayerStatusVisuals(const FString& PlayerId, const FString& Status);
+    void ApplyEventStatusVisuals(const FString& EventId, const FString& Status);
+    void RefreshEventMarkersAtVenue(const FString& VenueId);
+
+    void StartPulseAnimation(EMarkerType Type, const FString& MarkerId);
+    void StartFadeAnimation(EMarkerType Type, const FString& MarkerId);
+    void StopMarkerAnimation(EMarkerType Type, const FString& MarkerId);
+    float EvaluateLoopingCurve(const UCurveFloat* Curve) const;
+
+    // Per-instance fallback when no parameter collection is set
     void OnPulseTimelineUpdate(float Value);
-    
-    UFUNCTION()
     void OnFadeTimelineUpdate(float Value);
 }; 
\ No newline at end of file
@@ -0,0 +1,471 @@
+#include "MediaClipSubsystem.h"
+#include "SportBeaconStats.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "HttpModule.h"
+#include "Interfaces/IHttpResponse.h"
+#include "MediaPlayer.h"
+
+namespace
+{
+    // Same URL scheme as UImageCacheSubsystem thumbnails: suffix before the extension, extra query parameters
+    FString ApplyRenditionVariant(const FString& URL, const FMediaRenditionVariant& Variant)
+    {
+        FString Path = URL;
+        FString Query;
+        URL.Split(TEXT("?"), &Path, &Query);
+
+        if (!Variant.FileSuffix.IsEmpty())
+        {
+            const int32 SlashIndex = Path.Find(TEXT("/"), ESearchCase::CaseSensitive, ESearchDir::FromEnd);
+            const int32 DotIndex = Path.Find(TEXT("."), ESearchCase::CaseSensitive, ESearchDir::FromEnd);
+            if (DotIndex != INDEX_NONE && DotIndex > SlashIndex)
+            {
+                Path.InsertAt(DotIndex, Variant.FileSuffix);
+            }
+            else
+            {
+                Path += Variant.FileSuffix;
+            }
+        }
+
+        if (!Variant.QueryParameters.IsEmpty())
+        {
+            Query = Query.IsEmpty() ? Variant.QueryParameters : Query + TEXT("&") + Variant.QueryParameters;
+        }
+
+        return Query.IsEmpty() ? Path : Path + TEXT("?") + Query;
+    }
+
+    // Weight of the newest probe in the smoothed throughput
+    constexpr float ThroughputSmoothing = 0.3f;
+
+    // Merged prefetch requests are cut to this, only the front few are ever opened
+    constexpr int32 MaxQueuedPrefetches = 32;
+}
+
+UMediaClipSubsystem* UMediaClipSubsystem::Get(const UObject* WorldContextObject)
+{
+    const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+    const UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+    return GameInstance ? GameInstance->GetSubsystem<UMediaClipSubsystem>() : nullptr;
+}
+
+void UMediaClipSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    MaxPooledPlayers = FMath::Max(MaxPooledPlayers, 1);
+    MaxPrefetchedClips = FMath::Clamp(MaxPrefetchedClips, 0, MaxPooledPlayers);
+    ThroughputKbps = DefaultThroughputKbps;
+}
+
+void UMediaClipSubsystem::Deinitialize()
+{
+    UnbindMapView();
+
+    if (ProbeRequest.IsValid())
+    {
+        ProbeRequest->OnProcessRequestComplete().Unbind();
+        ProbeRequest->CancelRequest();
+        ProbeRequest.Reset();
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("MediaClips: %d warm hits, %d opening hits, %d cold opens, %d prefetches, %.0f kbps estimated"),
+        Stats.WarmHits, Stats.OpeningHits, Stats.ColdOpens, Stats.Prefetches, ThroughputKbps);
+
+    for (FPooledMediaPlayer& Entry : Pool)
+    {
+        if (Entry.Player)
+        {
+            Entry.Player->OnMediaOpened.RemoveDynamic(this, &UMediaClipSubsystem::HandlePooledMediaOpened);
+            Entry.Player->OnMediaOpenFailed.RemoveDynamic(this, &UMediaClipSubsystem::HandlePooledMediaFailed);
+            Entry.Player->Close();
+        }
+    }
+
+    Pool.Reset();
+    PrefetchQueue.Reset();
+
+    Super::Deinitialize();
+}
+
+UMediaPlayer* UMediaClipSubsystem::AcquirePlayer(const FString& URL)
+{
+    if (URL.IsEmpty())
+    {
+        return nullptr;
+    }
+
+    PrefetchQueue.Remove(URL);
+
+    FPooledMediaPlayer* Entry = FindEntry(URL);
+    if (Entry)
+    {
+        ++(Entry->bOpened ? Stats.WarmHits : Stats.OpeningHits);
+
+        // A clip another widget is playing is shared as it is, not restarted under it
+        if (Entry->LeaseCount == 0 && Entry->bOpened && Entry->bPlayed)
+        {
+            Entry->Player->Seek(FTimespan::Zero());
+        }
+    }
+    else
+    {
+        ++Stats.ColdOpens;
+
+        Entry = FindReusableEntry();
+        if (!Entry)
+        {
+            Entry = &AddEntry();
+        }
+        OpenEntry(*Entry, URL);
+    }
+
+    ++Entry->LeaseCount;
+    Entry->bPlayed = true;
+    Entry->LastUsed = ++UseCounter;
+
+    UMediaPlayer* Player = Entry->Player;
+
+    // The lease may have taken a player a prefetch wanted
+    PumpPrefetchQueue();
+    return Player;
+}
+
+void UMediaClipSubsystem::ReleasePlayer(UMediaPlayer* Player)
+{
+    FPooledMediaPlayer* Entry = FindEntryByPlayer(Player);
+    if (!Entry || Entry->LeaseCount == 0)
+    {
+        return;
+    }
+
+    Entry->LastUsed = ++UseCounter;
+    if (--Entry->LeaseCount > 0)
+    {
+        return;
+    }
+
+    if (Entry->bOpened)
+    {
+        Entry->Player->Pause();
+    }
+
+    TrimPool();
+    PumpPrefetchQueue();
+}
+
+void UMediaClipSubsystem::PrefetchClips(const TArray<FString>& URLs)
+{
+    // Several widgets prefetch at once, so one list only reorders the others rather than replacing them
+    TArray<FString> Merged;
+    Merged.Reserve(URLs.Num() + PrefetchQueue.Num());
+    for (const FString& URL : URLs)
+    {
+        if (!URL.IsEmpty())
+        {
+            Merged.AddUnique(URL);
+        }
+    }
+    for (const FString& URL : PrefetchQueue)
+    {
+        Merged.AddUnique(URL);
+    }
+
+    if (Merged.Num() > MaxQueuedPrefetches)
+    {
+        Merged.SetNum(MaxQueuedPrefetches, false);
+    }
+    PrefetchQueue = MoveTemp(Merged);
+
+    PumpPrefetchQueue();
+}
+
+void UMediaClipSubsystem::PrefetchClip(const FString& URL)
+{
+    if (URL.IsEmpty())
+    {
+        return;
+    }
+
+    PrefetchQueue.Remove(URL);
+    PrefetchQueue.Insert(URL, 0);
+    if (PrefetchQueue.Num() > MaxQueuedPrefetches)
+    {
+        PrefetchQueue.SetNum(MaxQueuedPrefetches, false);
+    }
+    PumpPrefetchQueue();
+}
+
+FString UMediaClipSubsystem::SelectRendition(const FString& URL) const
+{
+    for (const FMediaRenditionRule& Rule : RenditionRules)
+    {
+        if (Rule.UrlPrefix.IsEmpty() || !URL.StartsWith(Rule.UrlPrefix) || Rule.Variants.Num() == 0)
+        {
+            continue;
+        }
+
+        // Highest bitrate that fits the budget, or the lowest one when none does
+        const float BudgetKbps = ThroughputKbps * ThroughputSafetyFactor;
+        const FMediaRenditionVariant* Best = nullptr;
+        const FMediaRenditionVariant* Lowest = nullptr;
+
+        for (const FMediaRenditionVariant& Variant : Rule.Variants)
+        {
+            if (!Lowest || Variant.BitrateKbps < Lowest->BitrateKbps)
+            {
+                Lowest = &Variant;
+            }
+
+            if (Variant.BitrateKbps <= BudgetKbps && (!Best || Variant.BitrateKbps > Best->BitrateKbps))
+            {
+                Best = &Variant;
+            }
+        }
+
+        return ApplyRenditionVariant(URL, Best ? *Best : *Lowest);
+    }
+
+    return URL;
+}
+
+FPooledMediaPlayer* UMediaClipSubsystem::FindEntry(const FString& SourceURL)
+{
+    return Pool.FindByPredicate([&SourceURL](const FPooledMediaPlayer& Entry)
+    {
+        return Entry.SourceURL == SourceURL;
+    });
+}
+
+FPooledMediaPlayer* UMediaClipSubsystem::FindEntryByPlayer(const UMediaPlayer* Player)
+{
+    return Player ? Pool.FindByPredicate([Player](const FPooledMediaPlayer& Entry) { return Entry.Player == Player; }) : nullptr;
+}
+
+FPooledMediaPlayer* UMediaClipSubsystem::FindReusableEntry()
+{
+    const int32 NumWanted = FMath::Min(PrefetchQueue.Num(), MaxPrefetchedClips);
+
+    FPooledMediaPlayer* Best = nullptr;
+    for (FPooledMediaPlayer& Entry : Pool)
+    {
+        if (Entry.LeaseCount > 0)
+        {
+            continue;
+        }
+
+        const int32 QueueIndex = PrefetchQueue.IndexOfByKey(Entry.SourceURL);
+        if (QueueIndex != INDEX_NONE && QueueIndex < NumWanted)
+        {
+            continue;
+        }
+
+        if (!Best || Entry.LastUsed < Best->LastUsed)
+        {
+            Best = &Entry;
+        }
+    }
+
+    // An empty slot beats evicting an opened clip
+    if (Pool.Num() < MaxPooledPlayers && (!Best || Best->bOpened))
+    {
+        return nullptr;
+    }
+
+    return Best;
+}
+
+FPooledMediaPlayer& UMediaClipSubsystem::AddEntry()
+{
+    FPooledMediaPlayer& Entry = Pool.AddDefaulted_GetRef();
+    Entry.Player = NewObject<UMediaPlayer>(this);
+    Entry.Player->PlayOnOpen = false;
+    Entry.Player->OnMediaOpened.AddDynamic(this, &UMediaClipSubsystem::HandlePooledMediaOpened);
+    Entry.Player->OnMediaOpenFailed.AddDynamic(this, &UMediaClipSubsystem::HandlePooledMediaFailed);
+
+    SPORTBEACON_SET_COUNT(PooledMediaPlayers, Pool.Num());
+    return Entry;
+}
+
+void UMediaClipSubsystem::OpenEntry(FPooledMediaPlayer& Entry, const FString& SourceURL)
+{
+    if (Entry.bOpened || !Entry.OpenedURL.IsEmpty())
+    {
+        ++Stats.Evictions;
+        Entry.Player->Close();
+    }
+
+    Entry.SourceURL = SourceURL;
+    Entry.OpenedURL = SelectRendition(SourceURL);
+    Entry.bOpened = false;
+    Entry.bPlayed = false;
+    Entry.LastUsed = ++UseCounter;
+
+    Entry.Player->OpenUrl(Entry.OpenedURL);
+}
+
+void UMediaClipSubsystem::PumpPrefetchQueue()
+{
+    const int32 NumWanted = FMath::Min(PrefetchQueue.Num(), MaxPrefetchedClips);
+
+    for (int32 Index = 0; Index < NumWanted; ++Index)
+    {
+        const FString URL = PrefetchQueue[Index];
+        if (FindEntry(URL))
+        {
+            continue;
+        }
+
+        FPooledMediaPlayer* Entry = FindReusableEntry();
+        if (!Entry)
+        {
+            if (Pool.Num() >= MaxPooledPlayers)
+            {
+                // Every player is leased or holding a higher priority clip
+                return;
+            }
+            Entry = &AddEntry();
+        }
+
+        ++Stats.Prefetches;
+        OpenEntry(*Entry, URL);
+        StartThroughputProbe(Entry->OpenedURL);
+    }
+}
+
+void UMediaClipSubsystem::TrimPool()
+{
+    // Leases beyond the pool size grew it, shrink back by closing the stalest idle players
+    while (Pool.Num() > MaxPooledPlayers)
+    {
+        int32 Oldest = INDEX_NONE;
+        for (int32 Index = 0; Index < Pool.Num(); ++Index)
+        {
+            if (Pool[Index].LeaseCount == 0 && (Oldest == INDEX_NONE || Pool[Index].LastUsed < Pool[Oldest].LastUsed))
+            {
+                Oldest = Index;
+            }
+        }
+
+        if (Oldest == INDEX_NONE)
+        {
+            return;
+        }
+
+        UMediaPlayer* Player = Pool[Oldest].Player;
+        Player->OnMediaOpened.RemoveDynamic(this, &UMediaClipSubsystem::HandlePooledMediaOpened);
+        Player->OnMediaOpenFailed.RemoveDynamic(this, &UMediaClipSubsystem::HandlePooledMediaFailed);
+        Player->Close();
+
+        ++Stats.Evictions;
+        Pool.RemoveAtSwap(Oldest, 1, false);
+        SPORTBEACON_SET_COUNT(PooledMediaPlayers, Pool.Num());
+    }
+}
+
+void UMediaClipSubsystem::StartThroughputProbe(const FString& URL)
+{
+    // One probe at a time, parallel probes would split the link and underestimate it
+    if (ProbeBytes <= 0 || ProbeRequest.IsValid() || !URL.StartsWith(TEXT("http")))
+    {
+        return;
+    }
+
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FHttpModule::Get().CreateRequest();
+    HttpRequest->SetVerb(TEXT("GET"));
+    HttpRequest->SetURL(URL);
+    HttpRequest->SetHeader(TEXT("Range"), FString::Printf(TEXT("bytes=0-%d"), ProbeBytes - 1));
+    HttpRequest->OnProcessRequestComplete().BindUObject(this, &UMediaClipSubsystem::OnThroughputProbeComplete, FPlatformTime::Seconds());
+
+    ProbeRequest = HttpRequest;
+    HttpRequest->ProcessRequest();
+}
+
+void UMediaClipSubsystem::OnThroughputProbeComplete(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSuccess, double StartTime)
+{
+    ProbeRequest.Reset();
+
+    const double Elapsed = FPlatformTime::Seconds() - StartTime;
+    if (!bSuccess || !Response.IsValid() || !EHttpResponseCodes::IsOk(Response->GetResponseCode()) || Elapsed <= 0.0)
+    {
+        return;
+    }
+
+    // Tiny bodies are dominated by connection setup and say nothing about bandwidth
+    const int32 NumBytes = Response->GetContent().Num();
+    if (NumBytes < ProbeBytes / 4)
+    {
+        return;
+    }
+
+    const float SampleKbps = float(NumBytes * 8.0 / 1000.0 / Elapsed);
+    ThroughputKbps = Stats.ThroughputSamples == 0
+        ? SampleKbps
+        : FMath::Lerp(ThroughputKbps, SampleKbps, ThroughputSmoothing);
+    ++Stats.ThroughputSamples;
+}
+
+void UMediaClipSubsystem::HandlePooledMediaOpened(FString OpenedUrl)
+{
+    for (FPooledMediaPlayer& Entry : Pool)
+    {
+        if (Entry.OpenedURL == OpenedUrl && !Entry.bOpened)
+        {
+            Entry.bOpened = true;
+
+            // Prefetched clips sit paused on their first frame with the start buffered
+            if (Entry.LeaseCount == 0)
+            {
+                Entry.Player->Pause();
+            }
+        }
+    }
+}
+
+void UMediaClipSubsystem::HandlePooledMediaFailed(FString FailedUrl)
+{
+    for (FPooledMediaPlayer& Entry : Pool)
+    {
+        if (Entry.OpenedURL == FailedUrl && !Entry.bOpened)
+        {
+            // Free the slot, the leasing widget reports the failure itself
+            PrefetchQueue.Remove(Entry.SourceURL);
+            Entry.SourceURL.Reset();
+            Entry.OpenedURL.Reset();
+        }
+    }
+}
+
+void UMediaClipSubsystem::BindMapView(AMapView* MapView)
+{
+    UnbindMapView();
+
+    if (MapView)
+    {
+        BoundMapView = MapView;
+        MapView->OnHighlightSelected.AddDynamic(this, &UMediaClipSubsystem::HandleHighlightSelected);
+    }
+}
+
+void UMediaClipSubsystem::UnbindMapView()
+{
+    if (AMapView* MapView = BoundMapView.Get())
+    {
+        MapView->OnHighlightSelected.RemoveDynamic(this, &UMediaClipSubsystem::HandleHighlightSelected);
+    }
+    BoundMapView.Reset();
+}
+
+void UMediaClipSubsystem::HandleHighlightSelected(const FHighlightData& SelectedHighlight)
+{
+    PrefetchClip(SelectedHighlight.MediaUrl);
+}
+
+FMediaClipStats UMediaClipSubsystem::GetClipStats() const
+{
+    FMediaClipStats Result = Stats;
+    Result.EstimatedThroughputKbps = ThroughputKbps;
+    return Result;
+}
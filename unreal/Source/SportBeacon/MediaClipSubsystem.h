@@ -0,0 +1,200 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "Interfaces/IHttpRequest.h"
+#include "MapView.h"
+#include "MediaClipSubsystem.generated.h"
+
+class UMediaPlayer;
+
+// One encoding of a clip, addressed the same way as image thumbnails
+USTRUCT(BlueprintType)
+struct FMediaRenditionVariant
+{
+    GENERATED_BODY()
+
+    // Inserted before the file extension, e.g. "_720p"
+    UPROPERTY(Config, EditAnywhere, BlueprintReadWrite, Category = "Media Clips")
+    FString FileSuffix;
+
+    // Appended to the query string, e.g. "rendition=720p"
+    UPROPERTY(Config, EditAnywhere, BlueprintReadWrite, Category = "Media Clips")
+    FString QueryParameters;
+
+    UPROPERTY(Config, EditAnywhere, BlueprintReadWrite, Category = "Media Clips")
+    int32 BitrateKbps = 0;
+};
+
+// Renditions available for clips served from one backend
+USTRUCT(BlueprintType)
+struct FMediaRenditionRule
+{
+    GENERATED_BODY()
+
+    // Rule applies to URLs starting with this
+    UPROPERTY(Config, EditAnywhere, BlueprintReadWrite, Category = "Media Clips")
+    FString UrlPrefix;
+
+    UPROPERTY(Config, EditAnywhere, BlueprintReadWrite, Category = "Media Clips")
+    TArray<FMediaRenditionVariant> Variants;
+};
+
+USTRUCT(BlueprintType)
+struct FMediaClipStats
+{
+    GENERATED_BODY()
+
+    // Acquires served by a player that had already finished opening the clip
+    UPROPERTY(BlueprintReadOnly, Category = "Media Clips")
+    int32 WarmHits = 0;
+
+    // Acquires that joined a prefetch still opening
+    UPROPERTY(BlueprintReadOnly, Category = "Media Clips")
+    int32 OpeningHits = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Media Clips")
+    int32 ColdOpens = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Media Clips")
+    int32 Prefetches = 0;
+
+    // Opened clips closed to make room for others
+    UPROPERTY(BlueprintReadOnly, Category = "Media Clips")
+    int32 Evictions = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Media Clips")
+    int32 ThroughputSamples = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Media Clips")
+    float EstimatedThroughputKbps = 0.0f;
+};
+
+USTRUCT()
+struct FPooledMediaPlayer
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    TObjectPtr<UMediaPlayer> Player = nullptr;
+
+    // Clip URL as requested, and the rendition actually opened for it
+    FString SourceURL;
+    FString OpenedURL;
+
+    bool bOpened = false;
+    // Widgets currently holding the player
+    int32 LeaseCount = 0;
+    // Was played since it opened, so the next lease rewinds it
+    bool bPlayed = false;
+    uint64 LastUsed = 0;
+};
+
+/**
+ * Small pool of media players shared by every media widget. Highlight clips
+ * likely to be played next are opened ahead of time on idle players, leased
+ * players are handed back still open so replaying a clip is instant, and the
+ * rendition opened for a clip is picked from measured download throughput.
+ */
+UCLASS(Config = Game)
+class SPORTBEACON_API UMediaClipSubsystem : public UGameInstanceSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    static UMediaClipSubsystem* Get(const UObject* WorldContextObject);
+
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    // Leases a player for the clip. It is already open, IsReady() true, when the
+    // clip was prefetched or played recently, otherwise it starts opening now.
+    // Widgets showing the same clip share one player, each lease is released on its own.
+    UMediaPlayer* AcquirePlayer(const FString& URL);
+
+    // Returns a leased player paused but still open
+    void ReleasePlayer(UMediaPlayer* Player);
+
+    // Clips most likely to play next, highest priority first. They move ahead of what
+    // was queued before, which stays behind them.
+    UFUNCTION(BlueprintCallable, Category = "Media Clips")
+    void PrefetchClips(const TArray<FString>& URLs);
+
+    // Moves one clip to the front of the prefetch list
+    UFUNCTION(BlueprintCallable, Category = "Media Clips")
+    void PrefetchClip(const FString& URL);
+
+    // Rendition URL from the first matching RenditionRules entry for the current throughput
+    UFUNCTION(BlueprintPure, Category = "Media Clips")
+    FString SelectRendition(const FString& URL) const;
+
+    // Prefetches the clip of every highlight the map selects
+    UFUNCTION(BlueprintCallable, Category = "Media Clips")
+    void BindMapView(AMapView* MapView);
+
+    UFUNCTION(BlueprintCallable, Category = "Media Clips")
+    void UnbindMapView();
+
+    UFUNCTION(BlueprintCallable, Category = "Media Clips")
+    FMediaClipStats GetClipStats() const;
+
+    // Idle players kept open, leased ones beyond this are closed on release
+    UPROPERTY(Config, EditAnywhere, Category = "Media Clips")
+    int32 MaxPooledPlayers = 3;
+
+    // Clips from the front of the prefetch list opened ahead of time
+    UPROPERTY(Config, EditAnywhere, Category = "Media Clips")
+    int32 MaxPrefetchedClips = 2;
+
+    UPROPERTY(Config, EditAnywhere, Category = "Media Clips")
+    TArray<FMediaRenditionRule> RenditionRules;
+
+    // Share of the estimated throughput a rendition may use
+    UPROPERTY(Config, EditAnywhere, Category = "Media Clips")
+    float ThroughputSafetyFactor = 0.75f;
+
+    // Assumed until the first measurement lands
+    UPROPERTY(Config, EditAnywhere, Category = "Media Clips")
+    float DefaultThroughputKbps = 2500.0f;
+
+    // Leading bytes of each prefetched rendition downloaded to measure throughput and warm the CDN edge, 0 disables
+    UPROPERTY(Config, EditAnywhere, Category = "Media Clips")
+    int32 ProbeBytes = 256 * 1024;
+
+private:
+    FPooledMediaPlayer* FindEntry(const FString& SourceURL);
+    FPooledMediaPlayer* FindEntryByPlayer(const UMediaPlayer* Player);
+
+    // Idle player to reuse, least recently used first and never one holding a wanted prefetch
+    FPooledMediaPlayer* FindReusableEntry();
+    FPooledMediaPlayer& AddEntry();
+    void OpenEntry(FPooledMediaPlayer& Entry, const FString& SourceURL);
+
+    // Opens the front of the prefetch list on idle players
+    void PumpPrefetchQueue();
+    void TrimPool();
+
+    void StartThroughputProbe(const FString& URL);
+    void OnThroughputProbeComplete(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSuccess, double StartTime);
+
+    UFUNCTION()
+    void HandlePooledMediaOpened(FString OpenedUrl);
+
+    UFUNCTION()
+    void HandlePooledMediaFailed(FString FailedUrl);
+
+    UFUNCTION()
+    void HandleHighlightSelected(const FHighlightData& SelectedHighlight);
+
+    UPROPERTY()
+    TArray<FPooledMediaPlayer> Pool;
+
+    TArray<FString> PrefetchQueue;
+    TSharedPtr<IHttpRequest, ESPMode::ThreadSafe> ProbeRequest;
+    TWeakObjectPtr<AMapView> BoundMapView;
+
+    // Smoothed over recent probes
+    float ThroughputKbps = 0.0f;
+    uint64 UseCounter = 0;
+    FMediaClipStats Stats;
+};
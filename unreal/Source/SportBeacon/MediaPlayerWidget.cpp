@@ -1,12 +1,20 @@
 #include "MediaPlayerWidget.h"
 #include "MediaPlayerFacade.h"
 #include "IMediaEventSink.h"
+#include "MediaClipSubsystem.h"
+#include "Engine/World.h"
+#include "Engine/LatentActionManager.h"
 
 UMediaPlayerWidget::UMediaPlayerWidget(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
     , bIsPlaying(false)
     , bIsMuted(false)
     , Duration(0.0f)
+    , bPooledPlayer(false)
+    , TimeTextAccumulator(0.0f)
+    , ProgressAccumulator(0.0f)
+    , DisplayedTimeSeconds(-1)
+    , DisplayedDurationSeconds(-1)
 {
 }
 
@@ -31,30 +39,93 @@ void UMediaPlayerWidget::NativeConstruct()
     {
         ProgressSlider->OnValueChanged.AddDynamic(this, &UMediaPlayerWidget::OnProgressSliderValueChanged);
     }
+
+    UpdateTickEnabled();
 }
 
-void UMediaPlayerWidget::InitializeMediaPlayer()
+void UMediaPlayerWidget::NativeDestruct()
 {
-    // Create media player
-    MediaPlayer = NewObject<UMediaPlayer>(this);
-    MediaPlayer->OnMediaOpened.AddDynamic(this, &UMediaPlayerWidget::HandleMediaOpened);
-    MediaPlayer->OnEndReached.AddDynamic(this, &UMediaPlayerWidget::HandleMediaEndReached);
-    MediaPlayer->OnMediaOpenFailed.AddDynamic(this, &UMediaPlayerWidget::HandleMediaFailed);
+    ReleaseMediaPlayer();
+
+    Super::NativeDestruct();
+}
 
+void UMediaPlayerWidget::InitializeMediaPlayer()
+{
     // Create media texture
     MediaTexture = NewObject<UMediaTexture>(this);
-    MediaTexture->SetMediaPlayer(MediaPlayer);
     MediaTexture->UpdateResource();
 
     // Create sound component
     SoundComponent = NewObject<UMediaSoundComponent>(this);
-    SoundComponent->SetMediaPlayer(MediaPlayer);
 
     // Set video display texture
     if (VideoDisplay)
     {
         VideoDisplay->SetBrushFromTexture(MediaTexture);
     }
+
+    // Without the pool the widget keeps a player of its own
+    if (!UMediaClipSubsystem::Get(this))
+    {
+        SetMediaPlayer(NewObject<UMediaPlayer>(this), false);
+    }
+}
+
+void UMediaPlayerWidget::SetMediaPlayer(UMediaPlayer* NewPlayer, bool bPooled)
+{
+    MediaPlayer = NewPlayer;
+    bPooledPlayer = bPooled;
+
+    if (MediaPlayer)
+    {
+        MediaPlayer->OnMediaOpened.AddDynamic(this, &UMediaPlayerWidget::HandleMediaOpened);
+        MediaPlayer->OnEndReached.AddDynamic(this, &UMediaPlayerWidget::HandleMediaEndReached);
+        MediaPlayer->OnMediaOpenFailed.AddDynamic(this, &UMediaPlayerWidget::HandleMediaFailed);
+    }
+
+    if (MediaTexture)
+    {
+        MediaTexture->SetMediaPlayer(MediaPlayer);
+    }
+
+    if (SoundComponent)
+    {
+        SoundComponent->SetMediaPlayer(MediaPlayer);
+    }
+}
+
+void UMediaPlayerWidget::ReleaseMediaPlayer()
+{
+    if (!MediaPlayer || !bPooledPlayer)
+    {
+        return;
+    }
+
+    MediaPlayer->OnMediaOpened.RemoveDynamic(this, &UMediaPlayerWidget::HandleMediaOpened);
+    MediaPlayer->OnEndReached.RemoveDynamic(this, &UMediaPlayerWidget::HandleMediaEndReached);
+    MediaPlayer->OnMediaOpenFailed.RemoveDynamic(this, &UMediaPlayerWidget::HandleMediaFailed);
+
+    if (UMediaClipSubsystem* MediaClips = UMediaClipSubsystem::Get(this))
+    {
+        MediaClips->ReleasePlayer(MediaPlayer);
+    }
+
+    MediaPlayer = nullptr;
+    bPooledPlayer = false;
+    bIsPlaying = false;
+    Duration = 0.0f;
+    UpdateTickEnabled();
+
+    if (MediaTexture)
+    {
+        MediaTexture->SetMediaPlayer(nullptr);
+    }
+
+    if (SoundComponent)
+    {
+        SoundComponent->SetMediaPlayer(nullptr);
+    }
 }
 
 void UMediaPlayerWidget::LoadMedia(
@@ -63,7 +134,8 @@ void UMediaPlayerWidget::LoadMedia(
     const FString& Caption
 )
 {
-    if (!MediaPlayer)
+    UMediaClipSubsystem* MediaClips = UMediaClipSubsystem::Get(this);
+    if (!MediaPlayer && !MediaClips)
         return;
 
     // Update text displays
@@ -73,8 +145,21 @@ void UMediaPlayerWidget::LoadMedia(
     if (CaptionText)
         CaptionText->SetText(FText::FromString(Caption));
 
-    // Load and play media
-    MediaPlayer->OpenUrl(URL);
+    if (!MediaClips)
+    {
+        // Load and play media
+        MediaPlayer->OpenUrl(URL);
+        return;
+    }
+
+    ReleaseMediaPlayer();
+    SetMediaPlayer(MediaClips->AcquirePlayer(URL), true);
+
+    // A prefetched clip has opened already and will not fire OnMediaOpened again
+    if (MediaPlayer && MediaPlayer->IsReady())
+    {
+        HandleMediaOpened(URL);
+    }
 }
 
 void UMediaPlayerWidget::Play()
@@ -84,6 +169,7 @@ void UMediaPlayerWidget::Play()
         MediaPlayer->Play();
         bIsPlaying = true;
         UpdatePlayPauseButton();
+        UpdateTickEnabled();
     }
 }
 
@@ -94,6 +180,10 @@ void UMediaPlayerWidget::Pause()
         MediaPlayer->Pause();
         bIsPlaying = false;
         UpdatePlayPauseButton();
+        UpdateTickEnabled();
+
+        // Ticking stops here, so leave the display on the paused position
+        RefreshPlaybackDisplay();
     }
 }
 
@@ -121,6 +211,11 @@ void UMediaPlayerWidget::SeekTo(float Time)
     {
         FTimespan Target = FTimespan::FromSeconds(Time * Duration);
         MediaPlayer->Seek(Target);
+
+        if (!bIsPlaying)
+        {
+            RefreshPlaybackDisplay();
+        }
     }
 }
 
@@ -131,22 +226,66 @@ void UMediaPlayerWidget::NativeTick(
 {
     Super::NativeTick(MyGeometry, InDeltaTime);
 
-    if (MediaPlayer && bIsPlaying)
+    // Only reached while painted, hidden or off-screen players never get here
+    if (!MediaPlayer || !bIsPlaying)
+    {
+        return;
+    }
+
+    TimeTextAccumulator += InDeltaTime;
+    if (TimeTextUpdateRate <= 0.0f || TimeTextAccumulator >= 1.0f / TimeTextUpdateRate)
     {
+        TimeTextAccumulator = 0.0f;
         UpdateTimeDisplay();
+    }
 
-        // Update progress slider
-        if (ProgressSlider && Duration > 0)
-        {
-            float CurrentTime = MediaPlayer->GetTime().GetTotalSeconds();
-            ProgressSlider->SetValue(CurrentTime / Duration);
-        }
+    ProgressAccumulator += InDeltaTime;
+    if (ProgressUpdateRate <= 0.0f || ProgressAccumulator >= 1.0f / ProgressUpdateRate)
+    {
+        ProgressAccumulator = 0.0f;
+        UpdateProgressSlider();
     }
 }
 
+void UMediaPlayerWidget::UpdateProgressSlider()
+{
+    if (ProgressSlider && MediaPlayer && Duration > 0 && ProgressSlider->IsVisible())
+    {
+        float CurrentTime = MediaPlayer->GetTime().GetTotalSeconds();
+        ProgressSlider->SetValue(CurrentTime / Duration);
+    }
+}
+
+void UMediaPlayerWidget::RefreshPlaybackDisplay()
+{
+    TimeTextAccumulator = 0.0f;
+    ProgressAccumulator = 0.0f;
+    UpdateTimeDisplay();
+    UpdateProgressSlider();
+}
+
+void UMediaPlayerWidget::UpdateTickEnabled()
+{
+    TSharedPtr<SWidget> CachedWidget = GetCachedWidget();
+    if (!CachedWidget.IsValid())
+    {
+        return;
+    }
+
+    // Blueprint ticks, animations and latent actions still need the tick even when paused
+    const UWorld* World = GetWorld();
+    const bool bNeedsTick = bIsPlaying
+        || bHasScriptImplementedTick
+        || IsAnyAnimationPlaying()
+        || (World && World->GetLatentActionManager().GetNumActionsForObject(this) > 0);
+
+    CachedWidget->SetCanTick(bNeedsTick);
+}
+
 void UMediaPlayerWidget::HandleMediaOpened(FString OpenedUrl)
 {
     Duration = MediaPlayer->GetDuration().GetTotalSeconds();
+    DisplayedDurationSeconds = -1;
     
     if (ProgressSlider)
     {
@@ -161,6 +300,8 @@ void UMediaPlayerWidget::HandleMediaEndReached()
 {
     bIsPlaying = false;
     UpdatePlayPauseButton();
+    UpdateTickEnabled();
+    RefreshPlaybackDisplay();
     OnMediaEnded.Broadcast();
 }
 
@@ -171,9 +312,20 @@ void UMediaPlayerWidget::HandleMediaFailed(FString FailedUrl)
 
 void UMediaPlayerWidget::UpdateTimeDisplay()
 {
-    if (TimeText && MediaPlayer)
+    if (TimeText && MediaPlayer && TimeText->IsVisible())
     {
         float CurrentTime = MediaPlayer->GetTime().GetTotalSeconds();
+
+        // Text only has second resolution, formatting more often than that changes nothing
+        const int32 TimeSeconds = FMath::FloorToInt(CurrentTime);
+        const int32 DurationSeconds = FMath::FloorToInt(Duration);
+        if (TimeSeconds == DisplayedTimeSeconds && DurationSeconds == DisplayedDurationSeconds)
+        {
+            return;
+        }
+        DisplayedTimeSeconds = TimeSeconds;
+        DisplayedDurationSeconds = DurationSeconds;
+
         FString TimeString = FString::Printf(
             TEXT("%02d:%02d / %02d:%02d"),
             FMath::FloorToInt(CurrentTime / 60.0f),
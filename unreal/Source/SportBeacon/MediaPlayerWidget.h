@@ -43,12 +43,21 @@ public:
     UPROPERTY(BlueprintReadWrite, meta = (BindWidget))
     UTextBlock* CaptionText;
 
+    // Time text refreshes per second while playing, 0 refreshes every painted frame
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Media|Performance")
+    float TimeTextUpdateRate = 4.0f;
+
+    // Progress slider refreshes per second while playing, 0 follows the display refresh rate
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Media|Performance")
+    float ProgressUpdateRate = 0.0f;
+
     UPROPERTY(BlueprintAssignable, Category = "Media")
     FOnMediaEndedSignature OnMediaEnded;
 
     UPROPERTY(BlueprintAssignable, Category = "Media")
     FOnMediaErrorSignature OnMediaError;
 
+    // Takes a player from UMediaClipSubsystem, so a prefetched or recently played clip starts without reopening
     UFUNCTION(BlueprintCallable, Category = "Media")
     void LoadMedia(const FString& URL, const FString& Title, const FString& Caption);
 
@@ -69,6 +78,7 @@ public:
 
 protected:
     virtual void NativeConstruct() override;
+    virtual void NativeDestruct() override;
     virtual void NativeTick(const FGeometry& MyGeometry, float InDeltaTime) override;
 
 private:
@@ -84,6 +94,16 @@ private:
     bool bIsPlaying;
     bool bIsMuted;
     float Duration;
+    // MediaPlayer is leased from UMediaClipSubsystem and goes back to it on the next load or destruct
+    bool bPooledPlayer;
+
+    // Time since the last text and slider refresh
+    float TimeTextAccumulator;
+    float ProgressAccumulator;
+
+    // What the time text shows, in whole seconds, so unchanged text is not reformatted
+    int32 DisplayedTimeSeconds;
+    int32 DisplayedDurationSeconds;
 
     UFUNCTION()
     void HandleMediaOpened(FString OpenedUrl);
@@ -107,6 +127,13 @@ private:
     void OnMuteClicked();
 
     void InitializeMediaPlayer();
+    void SetMediaPlayer(UMediaPlayer* NewPlayer, bool bPooled);
+    void ReleaseMediaPlayer();
     void UpdatePlayPauseButton();
+    void UpdateProgressSlider();
+    void RefreshPlaybackDisplay();
+
+    // Stops the widget ticking while nothing is playing
+    void UpdateTickEnabled();
     void UpdateMuteButton();
 }; 
\ No newline at end of file
@@ -0,0 +1,698 @@
+#include "PerformanceBenchmarkSubsystem.h"
+#include "TimelineFeedWidget.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/App.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "RenderCore.h"
+#include "UObject/UObjectArray.h"
+
+namespace
+{
+    const TCHAR* const HighlightTypes[] = { TEXT("ClutchPlay"), TEXT("HotStreak"), TEXT("MomentumShift"), TEXT("ImpactPlay") };
+    const TCHAR* const PlayerStatuses[] = { TEXT("active"), TEXT("idle"), TEXT("offline") };
+    const TCHAR* const Sports[] = { TEXT("basketball"), TEXT("soccer"), TEXT("volleyball"), TEXT("tennis") };
+
+    float Average(const TArray<float>& Values)
+    {
+        if (Values.Num() == 0)
+        {
+            return 0.0f;
+        }
+
+        double Sum = 0.0;
+        for (const float Value : Values)
+        {
+            Sum += Value;
+        }
+        return static_cast<float>(Sum / Values.Num());
+    }
+
+    float Percentile(TArray<float> Values, float Fraction)
+    {
+        if (Values.Num() == 0)
+        {
+            return 0.0f;
+        }
+
+        Values.Sort();
+        return Values[FMath::Clamp(FMath::CeilToInt(Fraction * Values.Num()) - 1, 0, Values.Num() - 1)];
+    }
+
+    float Maximum(const TArray<float>& Values)
+    {
+        return Values.Num() > 0 ? FMath::Max(Values) : 0.0f;
+    }
+
+    FString ResultKey(const FString& Name, int32 Scale)
+    {
+        return FString::Printf(TEXT("%s@%d"), *Name, Scale);
+    }
+
+    FAutoConsoleCommandWithWorld RunBenchmarksCommand(
+        TEXT("SportBeacon.RunBenchmarks"),
+        TEXT("Runs the map and feed scaling benchmarks and writes a report to Saved/Benchmarks"),
+        FConsoleCommandWithWorldDelegate::CreateStatic([](UWorld* World)
+        {
+            if (UPerformanceBenchmarkSubsystem* Benchmarks = UPerformanceBenchmarkSubsystem::Get(World))
+            {
+                Benchmarks->RunBenchmarks();
+            }
+        }));
+}
+
+UPerformanceBenchmarkSubsystem* UPerformanceBenchmarkSubsystem::Get(const UObject* WorldContextObject)
+{
+    const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+    const UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+    return GameInstance ? GameInstance->GetSubsystem<UPerformanceBenchmarkSubsystem>() : nullptr;
+}
+
+void UPerformanceBenchmarkSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    MeasureFrames = FMath::Max(MeasureFrames, 1);
+    SettleFrames = FMath::Max(SettleFrames, 0);
+
+    FParse::Value(FCommandLine::Get(), TEXT("BenchmarkBaseline="), BaselineReportPath);
+
+    // The world does not exist yet, start once it has begun play
+    if (FParse::Param(FCommandLine::Get(), TEXT("SportBeaconBenchmark")))
+    {
+        bExitWhenDone = FParse::Param(FCommandLine::Get(), TEXT("BenchmarkExit"));
+        TickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+            FTickerDelegate::CreateUObject(this, &UPerformanceBenchmarkSubsystem::WaitForWorld));
+    }
+}
+
+void UPerformanceBenchmarkSubsystem::Deinitialize()
+{
+    CancelBenchmarks();
+
+    if (TickerHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+        TickerHandle.Reset();
+    }
+
+    Super::Deinitialize();
+}
+
+bool UPerformanceBenchmarkSubsystem::WaitForWorld(float DeltaTime)
+{
+    const UWorld* World = GetGameInstance() ? GetGameInstance()->GetWorld() : nullptr;
+    if (!World || !World->HasBegunPlay())
+    {
+        return true;
+    }
+
+    TickerHandle.Reset();
+    RunBenchmarks();
+    return false;
+}
+
+void UPerformanceBenchmarkSubsystem::RunBenchmarks()
+{
+    RunBenchmarksAtScales(Scales);
+}
+
+void UPerformanceBenchmarkSubsystem::RunBenchmarksAtScales(const TArray<int32>& ScalesToRun)
+{
+    if (IsRunning())
+    {
+        return;
+    }
+
+    if (!GetGameInstance() || !GetGameInstance()->GetWorld())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Benchmark: no world to run in"));
+
+        // CI would otherwise wait on a process that never finishes
+        if (bExitWhenDone)
+        {
+            FPlatformMisc::RequestExitWithStatus(false, 1);
+        }
+        return;
+    }
+
+    Results.Reset();
+    Random.Initialize(RandomSeed);
+
+    for (const int32 Scale : ScalesToRun)
+    {
+        if (Scale > 0)
+        {
+            AddMapSteps(Scale);
+        }
+    }
+
+    if (!FeedWidgetClass.IsNull())
+    {
+        for (const int32 Scale : ScalesToRun)
+        {
+            if (Scale > 0)
+            {
+                AddFeedSteps(Scale);
+            }
+        }
+    }
+    else
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Benchmark: FeedWidgetClass not set, skipping the feed flood"));
+    }
+
+    if (Steps.Num() == 0)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Benchmark: no positive scales configured, nothing to run"));
+
+        if (bExitWhenDone)
+        {
+            FPlatformMisc::RequestExitWithStatus(false, 1);
+        }
+        return;
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("Benchmark: running %d steps"), Steps.Num());
+
+    CurrentStep = 0;
+    BeginStep();
+    TickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+        FTickerDelegate::CreateUObject(this, &UPerformanceBenchmarkSubsystem::TickBenchmarks));
+}
+
+void UPerformanceBenchmarkSubsystem::CancelBenchmarks()
+{
+    if (!IsRunning())
+    {
+        return;
+    }
+
+    FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+    TickerHandle.Reset();
+
+    Steps.Reset();
+    DestroyMapView();
+    DestroyFeedWidget();
+}
+
+void UPerformanceBenchmarkSubsystem::AddMapSteps(int32 Scale)
+{
+    // Populating is measured too, the frames right after it are where hitches show
+    FBenchmarkStep& Populate = Steps.AddDefaulted_GetRef();
+    Populate.Name = TEXT("map_populate");
+    Populate.Scale = Scale;
+    Populate.NumFrames = FMath::Max(SettleFrames, 1);
+    Populate.Run = [this, Scale](int32 Frame)
+    {
+        if (Frame == 0)
+        {
+            GenerateMapData(Scale);
+            SpawnMapView();
+            if (MapView)
+            {
+                MapView->UpdateVenues(Venues);
+                MapView->UpdatePlayers(Players);
+                MapView->UpdateHighlights(Highlights);
+            }
+        }
+    };
+
+    FBenchmarkStep& UpdatePlayers = Steps.AddDefaulted_GetRef();
+    UpdatePlayers.Name = TEXT("map_update_players");
+    UpdatePlayers.Scale = Scale;
+    UpdatePlayers.NumFrames = MeasureFrames;
+    UpdatePlayers.Run = [this](int32 Frame)
+    {
+        // Full snapshots with a share of players changed, the way the server sends them
+        const int32 NumChanged = FMath::CeilToInt(Players.Num() * FMath::Clamp(PlayerChurnFraction, 0.0f, 1.0f));
+        for (int32 Index = 0; Index < NumChanged; ++Index)
+        {
+            FPlayerData& Player = Players[Random.RandHelper(Players.Num())];
+            Player.Status = PlayerStatuses[Random.RandHelper(UE_ARRAY_COUNT(PlayerStatuses))];
+            Player.Coordinates += FVector2D(Random.FRandRange(-0.001f, 0.001f), Random.FRandRange(-0.001f, 0.001f));
+        }
+
+        if (MapView)
+        {
+            MapView->UpdatePlayers(Players);
+        }
+    };
+
+    FBenchmarkStep& LocationStorm = Steps.AddDefaulted_GetRef();
+    LocationStorm.Name = TEXT("map_location_storm");
+    LocationStorm.Scale = Scale;
+    LocationStorm.NumFrames = MeasureFrames;
+    LocationStorm.Run = [this](int32 Frame)
+    {
+        if (!MapView)
+        {
+            return;
+        }
+
+        const int32 NumMoves = FMath::CeilToInt(Players.Num() * FMath::Clamp(LocationStormFraction, 0.0f, 1.0f));
+        for (int32 Index = 0; Index < NumMoves; ++Index)
+        {
+            FPlayerData& Player = Players[Random.RandHelper(Players.Num())];
+            Player.Coordinates += FVector2D(Random.FRandRange(-0.0005f, 0.0005f), Random.FRandRange(-0.0005f, 0.0005f));
+            MapView->UpdatePlayerLocation(Player.Id, Player.Coordinates);
+        }
+    };
+
+    FBenchmarkStep& ZoomPan = Steps.AddDefaulted_GetRef();
+    ZoomPan.Name = TEXT("map_zoom_pan_sweep");
+    ZoomPan.Scale = Scale;
+    ZoomPan.NumFrames = MeasureFrames;
+    ZoomPan.Run = [this](int32 Frame)
+    {
+        if (!MapView || MapView->ZoomSpeed <= 0.0f)
+        {
+            return;
+        }
+
+        // All the way in over the first half, back out over the second, circling the center throughout
+        const float HalfFrames = FMath::Max(MeasureFrames / 2, 1);
+        const float ZoomStep = (MapView->MaxZoom - MapView->MinZoom) / (MapView->ZoomSpeed * HalfFrames);
+        if (Frame == 0)
+        {
+            MapView->ZoomOut((MapView->MaxZoom - MapView->MinZoom) / MapView->ZoomSpeed);
+        }
+        else if (Frame < HalfFrames)
+        {
+            MapView->ZoomIn(ZoomStep);
+        }
+        else
+        {
+            MapView->ZoomOut(ZoomStep);
+        }
+
+        const float Angle = 2.0f * PI * Frame / MeasureFrames;
+        MapView->PanCamera(FVector2D(FMath::Cos(Angle), FMath::Sin(Angle)));
+    };
+
+    FBenchmarkStep& Filters = Steps.AddDefaulted_GetRef();
+    Filters.Name = TEXT("map_highlight_filters");
+    Filters.Scale = Scale;
+    Filters.NumFrames = MeasureFrames;
+    Filters.Run = [this](int32 Frame)
+    {
+        if (!MapView)
+        {
+            return;
+        }
+
+        // Alternate between a player, a highlight type, both, and no filter
+        switch (Frame % 4)
+        {
+        case 0:
+            MapView->SetHighlightFilters(Players[Random.RandHelper(Players.Num())].Id, FString(), FString());
+            break;
+        case 1:
+            MapView->SetHighlightFilters(FString(), FString(), HighlightTypes[Random.RandHelper(UE_ARRAY_COUNT(HighlightTypes))]);
+            break;
+        case 2:
+            MapView->SetHighlightFilters(Players[Random.RandHelper(Players.Num())].Id, FString(), HighlightTypes[Random.RandHelper(UE_ARRAY_COUNT(HighlightTypes))]);
+            break;
+        default:
+            MapView->ClearHighlightFilters();
+            break;
+        }
+    };
+
+    FBenchmarkStep& Teardown = Steps.AddDefaulted_GetRef();
+    Teardown.Name = TEXT("map_teardown");
+    Teardown.Scale = Scale;
+    Teardown.NumFrames = 2;
+    Teardown.bMeasured = false;
+    Teardown.Run = [this](int32 Frame)
+    {
+        if (Frame == 0)
+        {
+            DestroyMapView();
+            Venues.Empty();
+            Players.Empty();
+            Highlights.Empty();
+            CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+        }
+    };
+}
+
+void UPerformanceBenchmarkSubsystem::AddFeedSteps(int32 Scale)
+{
+    FBenchmarkStep& Flood = Steps.AddDefaulted_GetRef();
+    Flood.Name = TEXT("feed_flood");
+    Flood.Scale = Scale;
+    Flood.NumFrames = MeasureFrames;
+    Flood.Run = [this, Scale](int32 Frame)
+    {
+        if (Frame == 0)
+        {
+            SpawnFeedWidget();
+        }
+
+        if (!FeedWidget)
+        {
+            return;
+        }
+
+        // Scale entries spread evenly over the measured frames
+        const int32 First = static_cast<int64>(Scale) * Frame / MeasureFrames;
+        const int32 Last = static_cast<int64>(Scale) * (Frame + 1) / MeasureFrames;
+        for (int32 Index = First; Index < Last; ++Index)
+        {
+            FFeedEntry Entry;
+            Entry.Title = FString::Printf(TEXT("Benchmark entry %d"), Index);
+            Entry.Subtitle = Sports[Index % UE_ARRAY_COUNT(Sports)];
+            Entry.Icon = nullptr;
+            Entry.Timestamp = FDateTime::UtcNow();
+            Entry.EntryType = Index % 3 == 0 ? TEXT("highlight") : TEXT("stat");
+            FeedWidget->AddFeedEntry(Entry);
+        }
+    };
+
+    FBenchmarkStep& Teardown = Steps.AddDefaulted_GetRef();
+    Teardown.Name = TEXT("feed_teardown");
+    Teardown.Scale = Scale;
+    Teardown.NumFrames = 2;
+    Teardown.bMeasured = false;
+    Teardown.Run = [this](int32 Frame)
+    {
+        if (Frame == 0)
+        {
+            DestroyFeedWidget();
+            CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+        }
+    };
+}
+
+bool UPerformanceBenchmarkSubsystem::TickBenchmarks(float DeltaTime)
+{
+    // This tick closes the frame the previous step frame ran in
+    if (bFramePending)
+    {
+        bFramePending = false;
+        if (Steps[CurrentStep].bMeasured)
+        {
+            FrameMs.Add(DeltaTime * 1000.0f);
+            GameThreadMs.Add(FPlatformTime::ToMilliseconds(GGameThreadTime));
+        }
+
+        if (StepFrame >= Steps[CurrentStep].NumFrames)
+        {
+            FinishStep();
+            if (++CurrentStep >= Steps.Num())
+            {
+                FinishBenchmarks();
+                return false;
+            }
+            BeginStep();
+        }
+    }
+
+    const uint64 StartCycles = FPlatformTime::Cycles64();
+    Steps[CurrentStep].Run(StepFrame);
+    CallMs.Add(FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles));
+
+    ++StepFrame;
+    bFramePending = true;
+    return true;
+}
+
+void UPerformanceBenchmarkSubsystem::BeginStep()
+{
+    StepFrame = 0;
+    bFramePending = false;
+
+    FrameMs.Reset();
+    GameThreadMs.Reset();
+    CallMs.Reset();
+
+    StepStartObjects = GUObjectArray.GetObjectArrayNumMinusAvailable();
+    StepStartMemory = FPlatformMemory::GetStats().UsedPhysical;
+}
+
+void UPerformanceBenchmarkSubsystem::FinishStep()
+{
+    const FBenchmarkStep& Step = Steps[CurrentStep];
+    if (!Step.bMeasured)
+    {
+        return;
+    }
+
+    const uint64 UsedPhysical = FPlatformMemory::GetStats().UsedPhysical;
+
+    FBenchmarkResult& Result = Results.AddDefaulted_GetRef();
+    Result.Name = Step.Name;
+    Result.Scale = Step.Scale;
+    Result.Frames = FrameMs.Num();
+    Result.AvgFrameMs = Average(FrameMs);
+    Result.P95FrameMs = Percentile(FrameMs, 0.95f);
+    Result.MaxFrameMs = Maximum(FrameMs);
+    Result.AvgGameThreadMs = Average(GameThreadMs);
+    Result.P95GameThreadMs = Percentile(GameThreadMs, 0.95f);
+    Result.AvgCallMs = Average(CallMs);
+    Result.MaxCallMs = Maximum(CallMs);
+    Result.UObjectCount = GUObjectArray.GetObjectArrayNumMinusAvailable();
+    Result.UObjectDelta = Result.UObjectCount - StepStartObjects;
+    Result.UsedPhysicalMB = UsedPhysical / (1024.0f * 1024.0f);
+    Result.MemoryDeltaMB = (static_cast<int64>(UsedPhysical) - static_cast<int64>(StepStartMemory)) / (1024.0f * 1024.0f);
+
+    UE_LOG(LogTemp, Log, TEXT("Benchmark: %s x%d avg %.2f ms p95 %.2f ms game %.2f ms call %.2f ms, %d objects"),
+        *Result.Name, Result.Scale, Result.AvgFrameMs, Result.P95FrameMs, Result.AvgGameThreadMs, Result.AvgCallMs, Result.UObjectCount);
+}
+
+void UPerformanceBenchmarkSubsystem::FinishBenchmarks()
+{
+    TickerHandle.Reset();
+    Steps.Reset();
+    DestroyMapView();
+    DestroyFeedWidget();
+
+    CompareWithBaseline();
+
+    bool bPassed = true;
+    for (const FBenchmarkResult& Result : Results)
+    {
+        if (Result.bRegressed)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("Benchmark: %s x%d regressed"), *Result.Name, Result.Scale);
+            bPassed = false;
+        }
+    }
+
+    const FString ReportPath = WriteReport();
+    UE_LOG(LogTemp, Log, TEXT("Benchmark: %s, report at %s"), bPassed ? TEXT("passed") : TEXT("regressed"), *ReportPath);
+
+    OnBenchmarksComplete.Broadcast(ReportPath, bPassed);
+
+    if (bExitWhenDone)
+    {
+        FPlatformMisc::RequestExitWithStatus(false, bPassed && !ReportPath.IsEmpty() ? 0 : 1);
+    }
+}
+
+void UPerformanceBenchmarkSubsystem::GenerateMapData(int32 Scale)
+{
+    auto RandomCoordinates = [this]()
+    {
+        return DataCenter + FVector2D(Random.FRandRange(-DataSpreadDegrees, DataSpreadDegrees),
+            Random.FRandRange(-DataSpreadDegrees, DataSpreadDegrees));
+    };
+
+    Venues.Reset(Scale);
+    for (int32 Index = 0; Index < Scale; ++Index)
+    {
+        FVenueData& Venue = Venues.AddDefaulted_GetRef();
+        Venue.Id = FString::Printf(TEXT("bench_v%d"), Index);
+        Venue.Name = Venue.Id;
+        Venue.Sports = { Sports[Index % UE_ARRAY_COUNT(Sports)] };
+        Venue.Coordinates = RandomCoordinates();
+        Venue.bIsIndoor = Random.RandHelper(2) == 0;
+    }
+
+    Players.Reset(Scale);
+    for (int32 Index = 0; Index < Scale; ++Index)
+    {
+        FPlayerData& Player = Players.AddDefaulted_GetRef();
+        Player.Id = FString::Printf(TEXT("bench_p%d"), Index);
+        Player.Name = Player.Id;
+        Player.Coordinates = RandomCoordinates();
+        Player.Sport = Sports[Index % UE_ARRAY_COUNT(Sports)];
+        Player.Status = PlayerStatuses[Random.RandHelper(UE_ARRAY_COUNT(PlayerStatuses))];
+        Player.VenueId = Venues[Random.RandHelper(Scale)].Id;
+    }
+
+    Highlights.Reset(Scale);
+    const FDateTime Now = FDateTime::UtcNow();
+    for (int32 Index = 0; Index < Scale; ++Index)
+    {
+        FHighlightData& Highlight = Highlights.AddDefaulted_GetRef();
+        Highlight.Id = FString::Printf(TEXT("bench_h%d"), Index);
+        Highlight.PlayerId = Players[Random.RandHelper(Scale)].Id;
+        Highlight.HighlightType = HighlightTypes[Random.RandHelper(UE_ARRAY_COUNT(HighlightTypes))];
+        Highlight.ScoreImpact = Random.FRand();
+        Highlight.ConfidenceScore = Random.FRand();
+        Highlight.Timestamp = Now - FTimespan::FromMinutes(Random.RandHelper(24 * 60));
+        Highlight.Coordinates = RandomCoordinates();
+    }
+}
+
+void UPerformanceBenchmarkSubsystem::SpawnMapView()
+{
+    UWorld* World = GetGameInstance()->GetWorld();
+    if (!World)
+    {
+        return;
+    }
+
+    UClass* Class = MapViewClass.IsNull() ? AMapView::StaticClass() : MapViewClass.LoadSynchronous();
+    if (!Class)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Benchmark: failed to load %s, using AMapView"), *MapViewClass.ToString());
+        Class = AMapView::StaticClass();
+    }
+
+    FActorSpawnParameters SpawnParams;
+    SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+    MapView = World->SpawnActor<AMapView>(Class, FTransform::Identity, SpawnParams);
+}
+
+void UPerformanceBenchmarkSubsystem::DestroyMapView()
+{
+    if (MapView)
+    {
+        MapView->Destroy();
+        MapView = nullptr;
+    }
+}
+
+void UPerformanceBenchmarkSubsystem::SpawnFeedWidget()
+{
+    UWorld* World = GetGameInstance()->GetWorld();
+    UClass* Class = FeedWidgetClass.LoadSynchronous();
+    if (!World || !Class)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Benchmark: failed to create feed widget %s"), *FeedWidgetClass.ToString());
+        return;
+    }
+
+    // On screen, so layout and ticking cost what they cost in the app
+    FeedWidget = CreateWidget<UTimelineFeedWidget>(World, Class);
+    if (FeedWidget)
+    {
+        FeedWidget->AddToViewport();
+    }
+}
+
+void UPerformanceBenchmarkSubsystem::DestroyFeedWidget()
+{
+    if (FeedWidget)
+    {
+        FeedWidget->RemoveFromParent();
+        FeedWidget = nullptr;
+    }
+}
+
+void UPerformanceBenchmarkSubsystem::CompareWithBaseline()
+{
+    if (BaselineReportPath.IsEmpty())
+    {
+        return;
+    }
+
+    FString BaselineJson;
+    TSharedPtr<FJsonObject> Baseline;
+    if (!FFileHelper::LoadFileToString(BaselineJson, *BaselineReportPath)
+        || !FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(BaselineJson), Baseline) || !Baseline.IsValid())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Benchmark: could not read baseline %s"), *BaselineReportPath);
+        return;
+    }
+
+    TMap<FString, TSharedPtr<FJsonObject>> BaselineResults;
+    const TArray<TSharedPtr<FJsonValue>>* BaselineArray = nullptr;
+    if (Baseline->TryGetArrayField(TEXT("results"), BaselineArray))
+    {
+        for (const TSharedPtr<FJsonValue>& Value : *BaselineArray)
+        {
+            const TSharedPtr<FJsonObject>* Object = nullptr;
+            if (Value->TryGetObject(Object))
+            {
+                BaselineResults.Add(ResultKey((*Object)->GetStringField(TEXT("name")), (*Object)->GetIntegerField(TEXT("scale"))), *Object);
+            }
+        }
+    }
+
+    auto IsSlower = [this](float Current, float Previous)
+    {
+        return Current > Previous * (1.0f + RegressionTolerance) + RegressionSlackMs;
+    };
+
+    // Game thread and call time only, frame time is capped by vsync and varies with the device
+    for (FBenchmarkResult& Result : Results)
+    {
+        if (const TSharedPtr<FJsonObject>* Previous = BaselineResults.Find(ResultKey(Result.Name, Result.Scale)))
+        {
+            Result.bRegressed = IsSlower(Result.P95GameThreadMs, (*Previous)->GetNumberField(TEXT("p95_game_thread_ms")))
+                || IsSlower(Result.AvgCallMs, (*Previous)->GetNumberField(TEXT("avg_call_ms")));
+        }
+    }
+}
+
+FString UPerformanceBenchmarkSubsystem::WriteReport() const
+{
+    TSharedRef<FJsonObject> Report = MakeShared<FJsonObject>();
+    Report->SetStringField(TEXT("platform"), FString(FPlatformProperties::IniPlatformName()));
+    Report->SetStringField(TEXT("build_config"), LexToString(FApp::GetBuildConfiguration()));
+    Report->SetStringField(TEXT("build_version"), FApp::GetBuildVersion());
+    Report->SetStringField(TEXT("device"), FPlatformMisc::GetDeviceMakeAndModel());
+    Report->SetStringField(TEXT("timestamp"), FDateTime::UtcNow().ToIso8601());
+    Report->SetStringField(TEXT("baseline"), BaselineReportPath);
+
+    bool bPassed = true;
+    TArray<TSharedPtr<FJsonValue>> ResultValues;
+    for (const FBenchmarkResult& Result : Results)
+    {
+        TSharedRef<FJsonObject> Object = MakeShared<FJsonObject>();
+        Object->SetStringField(TEXT("name"), Result.Name);
+        Object->SetNumberField(TEXT("scale"), Result.Scale);
+        Object->SetNumberField(TEXT("frames"), Result.Frames);
+        Object->SetNumberField(TEXT("avg_frame_ms"), Result.AvgFrameMs);
+        Object->SetNumberField(TEXT("p95_frame_ms"), Result.P95FrameMs);
+        Object->SetNumberField(TEXT("max_frame_ms"), Result.MaxFrameMs);
+        Object->SetNumberField(TEXT("avg_game_thread_ms"), Result.AvgGameThreadMs);
+        Object->SetNumberField(TEXT("p95_game_thread_ms"), Result.P95GameThreadMs);
+        Object->SetNumberField(TEXT("avg_call_ms"), Result.AvgCallMs);
+        Object->SetNumberField(TEXT("max_call_ms"), Result.MaxCallMs);
+        Object->SetNumberField(TEXT("uobjects"), Result.UObjectCount);
+        Object->SetNumberField(TEXT("uobject_delta"), Result.UObjectDelta);
+        Object->SetNumberField(TEXT("used_physical_mb"), Result.UsedPhysicalMB);
+        Object->SetNumberField(TEXT("memory_delta_mb"), Result.MemoryDeltaMB);
+        Object->SetBoolField(TEXT("regressed"), Result.bRegressed);
+        ResultValues.Add(MakeShared<FJsonValueObject>(Object));
+
+        bPassed &= !Result.bRegressed;
+    }
+    Report->SetBoolField(TEXT("passed"), bPassed);
+    Report->SetArrayField(TEXT("results"), ResultValues);
+
+    FString Contents;
+    FJsonSerializer::Serialize(Report, TJsonWriterFactory<>::Create(&Contents));
+
+    const FString ReportPath = FPaths::Combine(FPaths::ProjectSavedDir(), ReportDirectory,
+        FString::Printf(TEXT("Benchmark_%s.json"), *FDateTime::UtcNow().ToString(TEXT("%Y%m%d_%H%M%S"))));
+
+    if (!FFileHelper::SaveStringToFile(Contents, *ReportPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Benchmark: failed to write %s"), *ReportPath);
+        return FString();
+    }
+
+    return ReportPath;
+}
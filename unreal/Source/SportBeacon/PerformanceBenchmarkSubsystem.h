@@ -0,0 +1,224 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "Containers/Ticker.h"
+#include "MapView.h"
+#include "FeedEntryWidget.h"
+#include "PerformanceBenchmarkSubsystem.generated.h"
+
+class UTimelineFeedWidget;
+
+// Measurements of one benchmark step at one data scale
+USTRUCT(BlueprintType)
+struct FBenchmarkResult
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+    FString Name;
+
+    // Venues, players and highlights each, or feed entries flooded
+    UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+    int32 Scale = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+    int32 Frames = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+    float AvgFrameMs = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+    float P95FrameMs = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+    float MaxFrameMs = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+    float AvgGameThreadMs = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+    float P95GameThreadMs = 0.0f;
+
+    // Time spent inside the driven calls themselves, not capped by vsync
+    UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+    float AvgCallMs = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+    float MaxCallMs = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+    int32 UObjectCount = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+    int32 UObjectDelta = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+    float UsedPhysicalMB = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+    float MemoryDeltaMB = 0.0f;
+
+    // Slower than the baseline report by more than the tolerance
+    UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+    bool bRegressed = false;
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnBenchmarksComplete, const FString&, ReportPath, bool, bPassed);
+
+/**
+ * Scaling benchmarks for the map and feed. For every configured scale a map
+ * is spawned with synthetic venues, players and highlights, then driven
+ * through full player updates, location storms, zoom/pan sweeps and highlight
+ * filter changes, and a timeline feed is flooded with entries. Frame time,
+ * game thread time, UObject count and memory go into a JSON report under
+ * Saved/Benchmarks, compared against a baseline report when one is given.
+ *
+ * Runs from Blueprint, the SportBeacon.RunBenchmarks console command, or on
+ * startup with -SportBeaconBenchmark. Adding -BenchmarkExit quits afterwards
+ * with exit code 1 on a regression, for CI. Each scale is also an automation
+ * test under SportBeacon.Performance.Benchmarks that fails on a regression.
+ */
+UCLASS(Config = Game)
+class SPORTBEACON_API UPerformanceBenchmarkSubsystem : public UGameInstanceSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    static UPerformanceBenchmarkSubsystem* Get(const UObject* WorldContextObject);
+
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    // Starts the suite in the current world, ignored while one is running
+    UFUNCTION(BlueprintCallable, Category = "Benchmark")
+    void RunBenchmarks();
+
+    // Same suite restricted to the given scales, the automation tests run one each
+    void RunBenchmarksAtScales(const TArray<int32>& ScalesToRun);
+
+    // Stops without writing a report
+    UFUNCTION(BlueprintCallable, Category = "Benchmark")
+    void CancelBenchmarks();
+
+    UFUNCTION(BlueprintPure, Category = "Benchmark")
+    bool IsRunning() const { return Steps.Num() > 0; }
+
+    UFUNCTION(BlueprintCallable, Category = "Benchmark")
+    TArray<FBenchmarkResult> GetLastResults() const { return Results; }
+
+    UPROPERTY(BlueprintAssignable, Category = "Benchmark")
+    FOnBenchmarksComplete OnBenchmarksComplete;
+
+    // Number of venues, players and highlights spawned per run
+    UPROPERTY(Config, EditAnywhere, Category = "Benchmark")
+    TArray<int32> Scales = { 1000, 10000, 50000 };
+
+    // Map subclass with the marker meshes and materials set up, AMapView itself if unset
+    UPROPERTY(Config, EditAnywhere, Category = "Benchmark")
+    TSoftClassPtr<AMapView> MapViewClass;
+
+    // Widget Blueprint with the feed bindings, the feed flood is skipped if unset
+    UPROPERTY(Config, EditAnywhere, Category = "Benchmark")
+    TSoftClassPtr<UTimelineFeedWidget> FeedWidgetClass;
+
+    // Frames measured per step
+    UPROPERTY(Config, EditAnywhere, Category = "Benchmark")
+    int32 MeasureFrames = 120;
+
+    // Frames after populating a map before the first driven step
+    UPROPERTY(Config, EditAnywhere, Category = "Benchmark")
+    int32 SettleFrames = 30;
+
+    // Share of players changed in each full UpdatePlayers
+    UPROPERTY(Config, EditAnywhere, Category = "Benchmark")
+    float PlayerChurnFraction = 0.1f;
+
+    // Share of players moved with UpdatePlayerLocation every frame of the storm
+    UPROPERTY(Config, EditAnywhere, Category = "Benchmark")
+    float LocationStormFraction = 0.2f;
+
+    // Synthetic records are spread this many degrees around the center
+    UPROPERTY(Config, EditAnywhere, Category = "Benchmark")
+    FVector2D DataCenter = FVector2D(40.7128f, -74.0060f);
+
+    UPROPERTY(Config, EditAnywhere, Category = "Benchmark")
+    float DataSpreadDegrees = 0.5f;
+
+    UPROPERTY(Config, EditAnywhere, Category = "Benchmark")
+    int32 RandomSeed = 1337;
+
+    // Under the project Saved directory
+    UPROPERTY(Config, EditAnywhere, Category = "Benchmark")
+    FString ReportDirectory = TEXT("Benchmarks");
+
+    // Earlier report to compare against, -BenchmarkBaseline= overrides it
+    UPROPERTY(Config, EditAnywhere, Category = "Benchmark")
+    FString BaselineReportPath;
+
+    // Allowed slowdown over the baseline before a step counts as regressed
+    UPROPERTY(Config, EditAnywhere, Category = "Benchmark")
+    float RegressionTolerance = 0.15f;
+
+    // Absolute slack on top of the tolerance, so sub-millisecond noise is not a regression
+    UPROPERTY(Config, EditAnywhere, Category = "Benchmark")
+    float RegressionSlackMs = 0.25f;
+
+private:
+    struct FBenchmarkStep
+    {
+        FString Name;
+        int32 Scale = 0;
+        int32 NumFrames = 1;
+        // Setup and teardown steps run without producing a result
+        bool bMeasured = true;
+        TFunction<void(int32 /*Frame*/)> Run;
+    };
+
+    void AddMapSteps(int32 Scale);
+    void AddFeedSteps(int32 Scale);
+
+    bool TickBenchmarks(float DeltaTime);
+    bool WaitForWorld(float DeltaTime);
+
+    void BeginStep();
+    void FinishStep();
+    void FinishBenchmarks();
+
+    void GenerateMapData(int32 Scale);
+    void SpawnMapView();
+    void DestroyMapView();
+    void SpawnFeedWidget();
+    void DestroyFeedWidget();
+
+    void CompareWithBaseline();
+    FString WriteReport() const;
+
+    TArray<FBenchmarkStep> Steps;
+    int32 CurrentStep = 0;
+    int32 StepFrame = 0;
+    // Set once a step frame ran, so the next tick can sample that frame
+    bool bFramePending = false;
+
+    TArray<float> FrameMs;
+    TArray<float> GameThreadMs;
+    TArray<float> CallMs;
+    int32 StepStartObjects = 0;
+    uint64 StepStartMemory = 0;
+
+    TArray<FBenchmarkResult> Results;
+
+    UPROPERTY()
+    AMapView* MapView = nullptr;
+
+    UPROPERTY()
+    UTimelineFeedWidget* FeedWidget = nullptr;
+
+    TArray<FVenueData> Venues;
+    TArray<FPlayerData> Players;
+    TArray<FHighlightData> Highlights;
+    FRandomStream Random;
+
+    FTSTicker::FDelegateHandle TickerHandle;
+    bool bExitWhenDone = false;
+};
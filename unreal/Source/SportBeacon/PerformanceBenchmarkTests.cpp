@@ -0,0 +1,111 @@
+#include "PerformanceBenchmarkSubsystem.h"
+#include "Misc/AutomationTest.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+    // The game or PIE world the benchmark subsystem lives in
+    UWorld* FindBenchmarkWorld()
+    {
+        if (!GEngine)
+        {
+            return nullptr;
+        }
+
+        for (const FWorldContext& Context : GEngine->GetWorldContexts())
+        {
+            UWorld* World = Context.World();
+            if (World && World->HasBegunPlay()
+                && (Context.WorldType == EWorldType::Game || Context.WorldType == EWorldType::PIE))
+            {
+                return World;
+            }
+        }
+        return nullptr;
+    }
+}
+
+// Waits for the suite to finish, then fails the test on every regressed step
+DEFINE_LATENT_AUTOMATION_COMMAND_TWO_PARAMETER(FWaitForBenchmarksCommand,
+    TWeakObjectPtr<UPerformanceBenchmarkSubsystem>, Benchmarks, FAutomationTestBase*, Test);
+
+bool FWaitForBenchmarksCommand::Update()
+{
+    const UPerformanceBenchmarkSubsystem* Subsystem = Benchmarks.Get();
+    if (!Subsystem)
+    {
+        Test->AddError(TEXT("Benchmark subsystem went away before the run finished"));
+        return true;
+    }
+
+    if (Subsystem->IsRunning())
+    {
+        return false;
+    }
+
+    const TArray<FBenchmarkResult> Results = Subsystem->GetLastResults();
+    if (Results.Num() == 0)
+    {
+        Test->AddError(TEXT("Benchmark run produced no results"));
+        return true;
+    }
+
+    for (const FBenchmarkResult& Result : Results)
+    {
+        const FString Summary = FString::Printf(TEXT("%s x%d: avg %.2f ms, p95 %.2f ms"),
+            *Result.Name, Result.Scale, Result.AvgFrameMs, Result.P95FrameMs);
+
+        if (Result.bRegressed)
+        {
+            Test->AddError(Summary + TEXT(" regressed against the baseline"));
+        }
+        else
+        {
+            Test->AddInfo(Summary);
+        }
+    }
+    return true;
+}
+
+// One test per configured scale, run with -ExecCmds="Automation RunTests SportBeacon"
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FSportBeaconBenchmarkTest, "SportBeacon.Performance.Benchmarks",
+    EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+void FSportBeaconBenchmarkTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+    for (const int32 Scale : GetDefault<UPerformanceBenchmarkSubsystem>()->Scales)
+    {
+        if (Scale > 0)
+        {
+            OutBeautifiedNames.Add(FString::Printf(TEXT("Scale %d"), Scale));
+            OutTestCommands.Add(FString::FromInt(Scale));
+        }
+    }
+}
+
+bool FSportBeaconBenchmarkTest::RunTest(const FString& Parameters)
+{
+    const int32 Scale = FCString::Atoi(*Parameters);
+
+    UPerformanceBenchmarkSubsystem* Benchmarks = UPerformanceBenchmarkSubsystem::Get(FindBenchmarkWorld());
+    if (!Benchmarks)
+    {
+        AddError(TEXT("No running game world, start with -game or from PIE"));
+        return false;
+    }
+
+    if (Benchmarks->IsRunning())
+    {
+        AddError(TEXT("A benchmark run is already in progress"));
+        return false;
+    }
+
+    Benchmarks->RunBenchmarksAtScales({ Scale });
+    ADD_LATENT_AUTOMATION_COMMAND(FWaitForBenchmarksCommand(Benchmarks, this));
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,646 @@
+#include "PlayerDataSubsystem.h"
+#include "SportBeaconStats.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "HttpModule.h"
+#include "Interfaces/IHttpResponse.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+namespace
+{
+    float GetFloatField(const TSharedPtr<FJsonObject>& Object, const TCHAR* FieldName, float Default = 0.0f)
+    {
+        double Value = Default;
+        return Object.IsValid() && Object->TryGetNumberField(FieldName, Value) ? float(Value) : Default;
+    }
+
+    int32 GetIntField(const TSharedPtr<FJsonObject>& Object, const TCHAR* FieldName, int32 Default = 0)
+    {
+        int32 Value = Default;
+        return Object.IsValid() && Object->TryGetNumberField(FieldName, Value) ? Value : Default;
+    }
+
+    FString GetStringField(const TSharedPtr<FJsonObject>& Object, const TCHAR* FieldName)
+    {
+        FString Value;
+        if (Object.IsValid())
+        {
+            Object->TryGetStringField(FieldName, Value);
+        }
+        return Value;
+    }
+
+    // Calls Parse for every object in the named array, missing arrays are left empty
+    template <typename ElementType, typename ParseFunction>
+    void ParseObjectArray(const TSharedPtr<FJsonObject>& Object, const TCHAR* FieldName, TArray<ElementType>& OutElements, ParseFunction Parse)
+    {
+        const TArray<TSharedPtr<FJsonValue>>* Values = nullptr;
+        if (!Object.IsValid() || !Object->TryGetArrayField(FieldName, Values))
+        {
+            return;
+        }
+
+        OutElements.Reserve(Values->Num());
+        for (const TSharedPtr<FJsonValue>& Value : *Values)
+        {
+            const TSharedPtr<FJsonObject>* ElementObject = nullptr;
+            if (Value.IsValid() && Value->TryGetObject(ElementObject))
+            {
+                Parse(*ElementObject, OutElements.AddDefaulted_GetRef());
+            }
+        }
+    }
+
+    TSharedPtr<FJsonObject> GetObjectField(const TSharedPtr<FJsonObject>& Object, const TCHAR* FieldName)
+    {
+        const TSharedPtr<FJsonObject>* Field = nullptr;
+        return Object.IsValid() && Object->TryGetObjectField(FieldName, Field) ? *Field : nullptr;
+    }
+
+    // Field names follow the snake_case used by the rest of the backend routes
+    void ParsePlayerProfile(const FString& PlayerId, const TSharedPtr<FJsonObject>& Source, FPlayerProfileData& OutProfile)
+    {
+        OutProfile.PlayerId = PlayerId;
+
+        const TSharedPtr<FJsonObject> Header = GetObjectField(Source, TEXT("profile"));
+        OutProfile.DisplayName = GetStringField(Header, TEXT("name"));
+        OutProfile.Rank = GetStringField(Header, TEXT("rank"));
+        OutProfile.AvatarUrl = GetStringField(Header, TEXT("avatar_url"));
+
+        const TSharedPtr<FJsonObject> Stats = GetObjectField(Source, TEXT("stats"));
+        OutProfile.Stats.PointsPerGame = GetFloatField(Stats, TEXT("points_per_game"));
+        OutProfile.Stats.AssistsPerGame = GetFloatField(Stats, TEXT("assists_per_game"));
+        OutProfile.Stats.ReboundsPerGame = GetFloatField(Stats, TEXT("rebounds_per_game"));
+        OutProfile.Stats.StealsPlusBlocks = GetFloatField(Stats, TEXT("steals_plus_blocks"));
+        OutProfile.Stats.WinRate = GetFloatField(Stats, TEXT("win_rate"));
+        OutProfile.Stats.FieldGoalPercentage = GetFloatField(Stats, TEXT("field_goal_percentage"));
+        OutProfile.Stats.ThreePointPercentage = GetFloatField(Stats, TEXT("three_point_percentage"));
+
+        ParseObjectArray(Source, TEXT("trends"), OutProfile.Trends, [](const TSharedPtr<FJsonObject>& Object, FStatTrend& Trend)
+        {
+            Trend.StatName = GetStringField(Object, TEXT("stat_name"));
+            Trend.CurrentValue = GetFloatField(Object, TEXT("current_value"));
+            Trend.PreviousValue = GetFloatField(Object, TEXT("previous_value"));
+
+            const float DerivedChange = Trend.PreviousValue != 0.0f
+                ? (Trend.CurrentValue - Trend.PreviousValue) / FMath::Abs(Trend.PreviousValue) * 100.0f
+                : 0.0f;
+            Trend.PercentageChange = GetFloatField(Object, TEXT("percentage_change"), DerivedChange);
+            Trend.bIsPositiveTrend = Trend.PercentageChange >= 0.0f;
+        });
+
+        const TSharedPtr<FJsonObject> Progression = GetObjectField(Source, TEXT("progression"));
+        OutProfile.Progression.TotalXP = GetIntField(Progression, TEXT("total_xp"));
+        OutProfile.Progression.Level = GetIntField(Progression, TEXT("level"), 1);
+        OutProfile.Progression.LevelProgress = GetFloatField(Progression, TEXT("level_progress"));
+        OutProfile.Progression.Tier = GetStringField(Progression, TEXT("tier"));
+
+        const TSharedPtr<FJsonObject> NextTier = GetObjectField(Progression, TEXT("next_tier"));
+        OutProfile.Progression.NextTier.TierName = GetStringField(NextTier, TEXT("tier_name"));
+        OutProfile.Progression.NextTier.RequiredLevel = GetIntField(NextTier, TEXT("required_level"));
+        OutProfile.Progression.NextTier.RequiredBadges = GetIntField(NextTier, TEXT("required_badges"));
+
+        ParseObjectArray(Source, TEXT("challenges"), OutProfile.Challenges, [](const TSharedPtr<FJsonObject>& Object, FChallengeData& Challenge)
+        {
+            Challenge.Id = GetStringField(Object, TEXT("id"));
+            Challenge.Title = GetStringField(Object, TEXT("title"));
+            Challenge.Description = GetStringField(Object, TEXT("description"));
+            Challenge.Difficulty = GetStringField(Object, TEXT("difficulty"));
+            Challenge.Target = GetIntField(Object, TEXT("target"));
+            Challenge.CurrentProgress = GetIntField(Object, TEXT("current_progress"));
+            Challenge.XPReward = GetIntField(Object, TEXT("xp_reward"));
+            Challenge.Category = GetStringField(Object, TEXT("category"));
+        });
+
+        ParseObjectArray(Source, TEXT("badges"), OutProfile.Badges, [](const TSharedPtr<FJsonObject>& Object, FBadgeData& Badge)
+        {
+            Badge.BadgeID = GetStringField(Object, TEXT("badge_id"));
+            Badge.Name = GetStringField(Object, TEXT("name"));
+            Badge.Description = GetStringField(Object, TEXT("description"));
+            Badge.Icon = nullptr;
+            Badge.EarnedDate = GetStringField(Object, TEXT("earned_date"));
+
+            const FString Color = GetStringField(Object, TEXT("color"));
+            Badge.BadgeColor = Color.IsEmpty() ? FLinearColor::White : FLinearColor(FColor::FromHex(Color));
+        });
+
+        ParseObjectArray(Source, TEXT("highlights"), OutProfile.Highlights, [](const TSharedPtr<FJsonObject>& Object, FFeedEntry& Entry)
+        {
+            Entry.Title = GetStringField(Object, TEXT("title"));
+            Entry.Subtitle = GetStringField(Object, TEXT("subtitle"));
+            Entry.Icon = nullptr;
+            Entry.EntryType = TEXT("highlight");
+            Entry.MediaUrl = GetStringField(Object, TEXT("video_url"));
+
+            if (!FDateTime::ParseIso8601(*GetStringField(Object, TEXT("timestamp")), Entry.Timestamp))
+            {
+                Entry.Timestamp = FDateTime::UtcNow();
+            }
+        });
+    }
+}
+
+UPlayerDataSubsystem* UPlayerDataSubsystem::Get(const UObject* WorldContextObject)
+{
+    const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+    const UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+    return GameInstance ? GameInstance->GetSubsystem<UPlayerDataSubsystem>() : nullptr;
+}
+
+void UPlayerDataSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    MaxBatchSize = FMath::Max(MaxBatchSize, 1);
+    MaxConcurrentBatches = FMath::Max(MaxConcurrentBatches, 1);
+    MaxStaleSeconds = FMath::Max(MaxStaleSeconds, FreshSeconds);
+}
+
+void UPlayerDataSubsystem::Deinitialize()
+{
+    UnbindMapView();
+
+    if (BatchFlushHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(BatchFlushHandle);
+        BatchFlushHandle.Reset();
+    }
+
+    for (const TSharedPtr<IHttpRequest, ESPMode::ThreadSafe>& Request : InFlightBatches)
+    {
+        Request->OnProcessRequestComplete().Unbind();
+        Request->CancelRequest();
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("PlayerData: %d fresh hits, %d stale hits, %d misses, %d coalesced, %d batches for %d profiles"),
+        Stats.FreshHits, Stats.StaleHits, Stats.Misses, Stats.CoalescedRequests, Stats.BatchesSent, Stats.ProfilesFetched);
+
+    InFlightBatches.Reset();
+    PendingProfiles.Reset();
+    PendingHandles.Reset();
+    QueuedPlayerIds.Reset();
+    ClearCache();
+
+    Super::Deinitialize();
+}
+
+bool UPlayerDataSubsystem::IsFresh(const FCachedPlayerProfile& Cached, double Now) const
+{
+    return !Cached.bInvalidated && Now - Cached.FetchedAt < FreshSeconds;
+}
+
+bool UPlayerDataSubsystem::IsServable(const FCachedPlayerProfile& Cached, double Now) const
+{
+    return Now - Cached.FetchedAt < MaxStaleSeconds;
+}
+
+uint64 UPlayerDataSubsystem::RequestProfile(const FString& PlayerId, FOnPlayerProfileReady OnReady)
+{
+    if (PlayerId.IsEmpty())
+    {
+        OnReady.ExecuteIfBound(nullptr, false, TEXT("Invalid player id provided"));
+        return 0;
+    }
+
+    const double Now = FPlatformTime::Seconds();
+    bool bServedStale = false;
+
+    if (FCachedPlayerProfile* Cached = CachedProfiles.Find(PlayerId))
+    {
+        Cached->LastUsed = ++UseCounter;
+
+        if (IsFresh(*Cached, Now))
+        {
+            ++Stats.FreshHits;
+            OnReady.ExecuteIfBound(&Cached->Data, false, FString());
+            return 0;
+        }
+
+        if (IsServable(*Cached, Now))
+        {
+            ++Stats.StaleHits;
+            bServedStale = true;
+
+            // Copied, the callback may request or invalidate and move the entry
+            const FPlayerProfileData StaleData = Cached->Data;
+            OnReady.ExecuteIfBound(&StaleData, true, FString());
+        }
+    }
+
+    if (!bServedStale)
+    {
+        ++Stats.Misses;
+    }
+
+    const uint64 Handle = NextRequestHandle++;
+    PendingHandles.Add(Handle, PlayerId);
+
+    if (FPendingProfile* Pending = PendingProfiles.Find(PlayerId))
+    {
+        ++Stats.CoalescedRequests;
+        Pending->Subscribers.Add({ Handle, MoveTemp(OnReady), bServedStale });
+        return Handle;
+    }
+
+    PendingProfiles.Add(PlayerId).Subscribers.Add({ Handle, MoveTemp(OnReady), bServedStale });
+    QueueFetch(PlayerId);
+
+    return Handle;
+}
+
+void UPlayerDataSubsystem::CancelRequest(uint64 RequestHandle)
+{
+    FString PlayerId;
+    if (!PendingHandles.RemoveAndCopyValue(RequestHandle, PlayerId))
+    {
+        return;
+    }
+
+    FPendingProfile* Pending = PendingProfiles.Find(PlayerId);
+    if (!Pending)
+    {
+        return;
+    }
+
+    Pending->Subscribers.RemoveAll([RequestHandle](const FProfileSubscriber& Subscriber)
+    {
+        return Subscriber.Handle == RequestHandle;
+    });
+
+    // A fetch still waiting for its batch can be dropped, one already sent lands in the cache
+    if (Pending->Subscribers.Num() == 0 && !Pending->bInFlight)
+    {
+        PendingProfiles.Remove(PlayerId);
+        QueuedPlayerIds.Remove(PlayerId);
+    }
+}
+
+void UPlayerDataSubsystem::PrefetchProfiles(const TArray<FString>& PlayerIds)
+{
+    const double Now = FPlatformTime::Seconds();
+
+    for (const FString& PlayerId : PlayerIds)
+    {
+        if (PlayerId.IsEmpty() || PendingProfiles.Contains(PlayerId))
+        {
+            continue;
+        }
+
+        const FCachedPlayerProfile* Cached = CachedProfiles.Find(PlayerId);
+        if (Cached && IsFresh(*Cached, Now))
+        {
+            continue;
+        }
+
+        ++Stats.Prefetches;
+        PendingProfiles.Add(PlayerId);
+        QueueFetch(PlayerId);
+    }
+}
+
+void UPlayerDataSubsystem::InvalidateProfile(const FString& PlayerId)
+{
+    if (FCachedPlayerProfile* Cached = CachedProfiles.Find(PlayerId))
+    {
+        Cached->bInvalidated = true;
+    }
+}
+
+const FPlayerProfileData* UPlayerDataSubsystem::FindCachedProfile(const FString& PlayerId) const
+{
+    const FCachedPlayerProfile* Cached = CachedProfiles.Find(PlayerId);
+    return Cached ? &Cached->Data : nullptr;
+}
+
+void UPlayerDataSubsystem::QueueFetch(const FString& PlayerId)
+{
+    QueuedPlayerIds.AddUnique(PlayerId);
+    ScheduleBatchFlush();
+}
+
+void UPlayerDataSubsystem::ScheduleBatchFlush()
+{
+    if (BatchFlushHandle.IsValid())
+    {
+        return;
+    }
+
+    // Requests made in the same window, typically one UI frame, share a batch
+    BatchFlushHandle = FTSTicker::GetCoreTicker().AddTicker(
+        FTickerDelegate::CreateUObject(this, &UPlayerDataSubsystem::FlushBatches),
+        BatchWindowSeconds);
+}
+
+bool UPlayerDataSubsystem::FlushBatches(float DeltaTime)
+{
+    while (QueuedPlayerIds.Num() > 0 && InFlightBatches.Num() < MaxConcurrentBatches)
+    {
+        const int32 BatchSize = FMath::Min(QueuedPlayerIds.Num(), MaxBatchSize);
+
+        TArray<FString> PlayerIds(QueuedPlayerIds.GetData(), BatchSize);
+        QueuedPlayerIds.RemoveAt(0, BatchSize, false);
+
+        SendBatch(MoveTemp(PlayerIds));
+    }
+
+    // Whatever is left goes out as batches complete
+    BatchFlushHandle.Reset();
+    return false;
+}
+
+void UPlayerDataSubsystem::SendBatch(TArray<FString>&& PlayerIds)
+{
+    TArray<TSharedPtr<FJsonValue>> IdValues;
+    IdValues.Reserve(PlayerIds.Num());
+    for (const FString& PlayerId : PlayerIds)
+    {
+        IdValues.Add(MakeShared<FJsonValueString>(PlayerId));
+
+        if (FPendingProfile* Pending = PendingProfiles.Find(PlayerId))
+        {
+            Pending->bInFlight = true;
+        }
+    }
+
+    TArray<TSharedPtr<FJsonValue>> Sections;
+    for (const TCHAR* Section : { TEXT("profile"), TEXT("stats"), TEXT("trends"), TEXT("progression"), TEXT("challenges"), TEXT("badges"), TEXT("highlights") })
+    {
+        Sections.Add(MakeShared<FJsonValueString>(Section));
+    }
+
+    TSharedRef<FJsonObject> Body = MakeShared<FJsonObject>();
+    Body->SetArrayField(TEXT("player_ids"), IdValues);
+    Body->SetArrayField(TEXT("sections"), Sections);
+
+    FString BodyString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&BodyString);
+    FJsonSerializer::Serialize(Body, Writer);
+
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FHttpModule::Get().CreateRequest();
+    HttpRequest->SetVerb(TEXT("POST"));
+    HttpRequest->SetURL(ApiBaseUrl + BatchEndpoint);
+    HttpRequest->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
+    HttpRequest->SetContentAsString(BodyString);
+    HttpRequest->SetTimeout(RequestTimeoutSeconds);
+    HttpRequest->OnProcessRequestComplete().BindUObject(this, &UPlayerDataSubsystem::OnBatchComplete, MoveTemp(PlayerIds));
+
+    ++Stats.BatchesSent;
+    InFlightBatches.Add(HttpRequest);
+    HttpRequest->ProcessRequest();
+}
+
+void UPlayerDataSubsystem::OnBatchComplete(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSuccess, TArray<FString> PlayerIds)
+{
+    InFlightBatches.Remove(Request);
+
+    // { "success": true, "data": { "players": { "<id>": {...} }, "errors": { "<id>": "..." } } }
+    TSharedPtr<FJsonObject> Players;
+    TSharedPtr<FJsonObject> Errors;
+    FString BatchError;
+
+    if (!bSuccess || !Response.IsValid())
+    {
+        BatchError = TEXT("Player data request failed");
+    }
+    else if (!EHttpResponseCodes::IsOk(Response->GetResponseCode()))
+    {
+        BatchError = FString::Printf(TEXT("Player data request returned HTTP %d"), Response->GetResponseCode());
+    }
+    else
+    {
+        TSharedPtr<FJsonObject> Root;
+        TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Response->GetContentAsString());
+        if (FJsonSerializer::Deserialize(Reader, Root) && Root.IsValid())
+        {
+            const TSharedPtr<FJsonObject> Data = GetObjectField(Root, TEXT("data"));
+            Players = GetObjectField(Data, TEXT("players"));
+            Errors = GetObjectField(Data, TEXT("errors"));
+        }
+
+        if (!Players.IsValid())
+        {
+            BatchError = TEXT("Malformed player data response");
+        }
+    }
+
+    for (const FString& PlayerId : PlayerIds)
+    {
+        const TSharedPtr<FJsonObject> Source = GetObjectField(Players, *PlayerId);
+        if (Source.IsValid())
+        {
+            FPlayerProfileData Profile;
+            ParsePlayerProfile(PlayerId, Source, Profile);
+            FinishProfile(PlayerId, MoveTemp(Profile));
+        }
+        else
+        {
+            FString Error = GetStringField(Errors, *PlayerId);
+            if (Error.IsEmpty())
+            {
+                Error = BatchError.IsEmpty() ? TEXT("Player not found") : BatchError;
+            }
+            FailProfile(PlayerId, Error);
+        }
+    }
+
+    EvictToBudget();
+
+    if (QueuedPlayerIds.Num() > 0)
+    {
+        ScheduleBatchFlush();
+    }
+}
+
+void UPlayerDataSubsystem::FinishProfile(const FString& PlayerId, FPlayerProfileData&& Profile)
+{
+    ++Stats.ProfilesFetched;
+    AddToCache(MoveTemp(Profile));
+
+    FPendingProfile Pending;
+    if (!PendingProfiles.RemoveAndCopyValue(PlayerId, Pending))
+    {
+        return;
+    }
+
+    for (const FProfileSubscriber& Subscriber : Pending.Subscribers)
+    {
+        PendingHandles.Remove(Subscriber.Handle);
+    }
+
+    // Callbacks get their own copy, any of them may add or evict cache entries
+    const FPlayerProfileData Fetched = CachedProfiles.FindChecked(PlayerId).Data;
+    for (const FProfileSubscriber& Subscriber : Pending.Subscribers)
+    {
+        Subscriber.OnReady.ExecuteIfBound(&Fetched, false, FString());
+    }
+}
+
+void UPlayerDataSubsystem::FailProfile(const FString& PlayerId, const FString& Error)
+{
+    ++Stats.FailedFetches;
+    UE_LOG(LogTemp, Warning, TEXT("PlayerData: failed to fetch %s: %s"), *PlayerId, *Error);
+
+    FPendingProfile Pending;
+    if (!PendingProfiles.RemoveAndCopyValue(PlayerId, Pending))
+    {
+        return;
+    }
+
+    for (const FProfileSubscriber& Subscriber : Pending.Subscribers)
+    {
+        PendingHandles.Remove(Subscriber.Handle);
+    }
+
+    // Anything cached beats an error, however old it is
+    TOptional<FPlayerProfileData> Fallback;
+    if (const FCachedPlayerProfile* Cached = CachedProfiles.Find(PlayerId))
+    {
+        Fallback = Cached->Data;
+    }
+
+    for (const FProfileSubscriber& Subscriber : Pending.Subscribers)
+    {
+        if (Subscriber.bServedStale)
+        {
+            continue;
+        }
+
+        if (Fallback.IsSet())
+        {
+            Subscriber.OnReady.ExecuteIfBound(&Fallback.GetValue(), true, FString());
+        }
+        else
+        {
+            Subscriber.OnReady.ExecuteIfBound(nullptr, false, Error);
+        }
+    }
+}
+
+void UPlayerDataSubsystem::AddToCache(FPlayerProfileData&& Profile)
+{
+    const FString PlayerId = Profile.PlayerId;
+
+    FCachedPlayerProfile& Entry = CachedProfiles.FindOrAdd(PlayerId);
+    Entry.Data = MoveTemp(Profile);
+    Entry.FetchedAt = FPlatformTime::Seconds();
+    Entry.LastUsed = ++UseCounter;
+    Entry.bInvalidated = false;
+
+    SPORTBEACON_SET_COUNT(CachedProfiles, CachedProfiles.Num());
+}
+
+void UPlayerDataSubsystem::EvictToBudget()
+{
+    const int32 Budget = FMath::Max(MaxCachedProfiles, 1);
+    if (CachedProfiles.Num() <= Budget)
+    {
+        return;
+    }
+
+    CachedProfiles.ValueSort([](const FCachedPlayerProfile& A, const FCachedPlayerProfile& B)
+    {
+        return A.LastUsed < B.LastUsed;
+    });
+
+    int32 NumToEvict = CachedProfiles.Num() - Budget;
+    for (auto It = CachedProfiles.CreateIterator(); It && NumToEvict > 0; ++It)
+    {
+        // Someone is waiting on a refresh of this one
+        if (PendingProfiles.Contains(It.Key()))
+        {
+            continue;
+        }
+
+        It.RemoveCurrent();
+        --NumToEvict;
+    }
+
+    SPORTBEACON_SET_COUNT(CachedProfiles, CachedProfiles.Num());
+}
+
+void UPlayerDataSubsystem::BindMapView(AMapView* MapView)
+{
+    UnbindMapView();
+
+    if (!MapView)
+    {
+        return;
+    }
+
+    BoundMapView = MapView;
+    MapView->OnPlayerSelected.AddDynamic(this, &UPlayerDataSubsystem::HandlePlayerSelected);
+
+    if (PrefetchIntervalSeconds > 0.0f && MaxPrefetchPerPass > 0)
+    {
+        PrefetchTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+            FTickerDelegate::CreateUObject(this, &UPlayerDataSubsystem::PrefetchAroundMapCenter),
+            PrefetchIntervalSeconds);
+    }
+}
+
+void UPlayerDataSubsystem::UnbindMapView()
+{
+    if (AMapView* MapView = BoundMapView.Get())
+    {
+        MapView->OnPlayerSelected.RemoveDynamic(this, &UPlayerDataSubsystem::HandlePlayerSelected);
+    }
+    BoundMapView.Reset();
+
+    if (PrefetchTickerHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(PrefetchTickerHandle);
+        PrefetchTickerHandle.Reset();
+    }
+}
+
+void UPlayerDataSubsystem::HandlePlayerSelected(const FPlayerData& SelectedPlayer)
+{
+    // Selection usually opens the profile next, so it skips the rest of the batch window
+    PrefetchProfiles({ SelectedPlayer.Id });
+    if (PendingProfiles.Contains(SelectedPlayer.Id))
+    {
+        if (BatchFlushHandle.IsValid())
+        {
+            FTSTicker::GetCoreTicker().RemoveTicker(BatchFlushHandle);
+        }
+        FlushBatches(0.0f);
+    }
+}
+
+bool UPlayerDataSubsystem::PrefetchAroundMapCenter(float DeltaTime)
+{
+    AMapView* MapView = BoundMapView.Get();
+    if (!MapView)
+    {
+        PrefetchTickerHandle.Reset();
+        return false;
+    }
+
+    TArray<FPlayerData> NearbyPlayers;
+    MapView->GetPlayersWithinRadius(MapView->GetMapCenter(), PrefetchRadiusKm, NearbyPlayers);
+
+    // Results come back nearest first
+    TArray<FString> PlayerIds;
+    for (int32 Index = 0; Index < NearbyPlayers.Num() && PlayerIds.Num() < MaxPrefetchPerPass; ++Index)
+    {
+        PlayerIds.Add(NearbyPlayers[Index].Id);
+    }
+
+    PrefetchProfiles(PlayerIds);
+    return true;
+}
+
+void UPlayerDataSubsystem::ClearCache()
+{
+    CachedProfiles.Reset();
+    SPORTBEACON_SET_COUNT(CachedProfiles, 0);
+}
+
+FPlayerDataStats UPlayerDataSubsystem::GetDataStats() const
+{
+    FPlayerDataStats Result = Stats;
+    Result.CachedProfiles = CachedProfiles.Num();
+    return Result;
+}
@@ -0,0 +1,246 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "Interfaces/IHttpRequest.h"
+#include "Containers/Ticker.h"
+#include "FeedEntryWidget.h"
+#include "PlayerProfileWidget.h"
+#include "MapView.h"
+#include "PlayerDataSubsystem.generated.h"
+
+// Everything a profile screen shows, fetched together in one batch entry
+USTRUCT(BlueprintType)
+struct FPlayerProfileData
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Player Data")
+    FString PlayerId;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Player Data")
+    FString DisplayName;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Player Data")
+    FString Rank;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Player Data")
+    FString AvatarUrl;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Player Data")
+    FPlayerStats Stats;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Player Data")
+    TArray<FStatTrend> Trends;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Player Data")
+    FPlayerProgressionData Progression;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Player Data")
+    TArray<FChallengeData> Challenges;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Player Data")
+    TArray<FBadgeData> Badges;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Player Data")
+    TArray<FFeedEntry> Highlights;
+};
+
+// Profile is null on failure, in which case Error says why. bIsStale is set
+// when cached data is served while a refresh is on its way.
+DECLARE_DELEGATE_ThreeParams(FOnPlayerProfileReady, const FPlayerProfileData* /*Profile*/, bool /*bIsStale*/, const FString& /*Error*/);
+
+USTRUCT(BlueprintType)
+struct FPlayerDataStats
+{
+    GENERATED_BODY()
+
+    // Requests answered from cache within FreshSeconds
+    UPROPERTY(BlueprintReadOnly, Category = "Player Data")
+    int32 FreshHits = 0;
+
+    // Requests answered from cache while a refresh was fetched behind them
+    UPROPERTY(BlueprintReadOnly, Category = "Player Data")
+    int32 StaleHits = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Player Data")
+    int32 Misses = 0;
+
+    // Requests that joined a fetch already queued or in flight
+    UPROPERTY(BlueprintReadOnly, Category = "Player Data")
+    int32 CoalescedRequests = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Player Data")
+    int32 Prefetches = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Player Data")
+    int32 BatchesSent = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Player Data")
+    int32 ProfilesFetched = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Player Data")
+    int32 FailedFetches = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Player Data")
+    int32 CachedProfiles = 0;
+};
+
+USTRUCT()
+struct FCachedPlayerProfile
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    FPlayerProfileData Data;
+
+    double FetchedAt = 0.0;
+    uint64 LastUsed = 0;
+    // Set by InvalidateProfile, served as stale until the next fetch lands
+    bool bInvalidated = false;
+};
+
+/**
+ * Backend data for player profiles. Stats, trends, progression, challenges,
+ * badges and highlights for many players come back from one batched POST,
+ * are cached per PlayerId, and are served stale-while-revalidate so a profile
+ * that was seen or prefetched before opens without waiting on the network.
+ */
+UCLASS(Config = Game)
+class SPORTBEACON_API UPlayerDataSubsystem : public UGameInstanceSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    static UPlayerDataSubsystem* Get(const UObject* WorldContextObject);
+
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    // Runs OnReady right away if the profile is cached. Fresh data ends the
+    // request there and 0 is returned. Stale data is served with bIsStale set,
+    // then OnReady runs again with the refreshed copy unless the refresh fails.
+    // Otherwise OnReady runs once the batch holding this player lands.
+    uint64 RequestProfile(const FString& PlayerId, FOnPlayerProfileReady OnReady);
+
+    // Drops the subscriber. Fetches already sent still complete and fill the cache.
+    void CancelRequest(uint64 RequestHandle);
+
+    // Queues fetches for players that are not cached or no longer fresh
+    UFUNCTION(BlueprintCallable, Category = "Player Data")
+    void PrefetchProfiles(const TArray<FString>& PlayerIds);
+
+    // Keeps the cached copy for stale serving but refetches on the next request
+    UFUNCTION(BlueprintCallable, Category = "Player Data")
+    void InvalidateProfile(const FString& PlayerId);
+
+    // Memory lookup only, null if the player was never fetched
+    const FPlayerProfileData* FindCachedProfile(const FString& PlayerId) const;
+
+    // Prefetches whoever the map selects, and periodically the players around its center
+    UFUNCTION(BlueprintCallable, Category = "Player Data")
+    void BindMapView(AMapView* MapView);
+
+    UFUNCTION(BlueprintCallable, Category = "Player Data")
+    void UnbindMapView();
+
+    UFUNCTION(BlueprintCallable, Category = "Player Data")
+    void ClearCache();
+
+    UFUNCTION(BlueprintCallable, Category = "Player Data")
+    FPlayerDataStats GetDataStats() const;
+
+    // Batched profiles are POSTed to ApiBaseUrl + BatchEndpoint
+    UPROPERTY(Config, EditAnywhere, Category = "Player Data")
+    FString ApiBaseUrl = TEXT("http://localhost:3000/api");
+
+    UPROPERTY(Config, EditAnywhere, Category = "Player Data")
+    FString BatchEndpoint = TEXT("/players/profiles");
+
+    // Cached profiles younger than this are served without a refresh
+    UPROPERTY(Config, EditAnywhere, Category = "Player Data")
+    float FreshSeconds = 30.0f;
+
+    // Older profiles are treated as missing and the request waits for the network
+    UPROPERTY(Config, EditAnywhere, Category = "Player Data")
+    float MaxStaleSeconds = 1800.0f;
+
+    // How long requests gather before a batch goes out
+    UPROPERTY(Config, EditAnywhere, Category = "Player Data")
+    float BatchWindowSeconds = 0.05f;
+
+    UPROPERTY(Config, EditAnywhere, Category = "Player Data")
+    int32 MaxBatchSize = 20;
+
+    UPROPERTY(Config, EditAnywhere, Category = "Player Data")
+    int32 MaxConcurrentBatches = 2;
+
+    UPROPERTY(Config, EditAnywhere, Category = "Player Data")
+    float RequestTimeoutSeconds = 10.0f;
+
+    // Least recently used profiles are dropped above this
+    UPROPERTY(Config, EditAnywhere, Category = "Player Data")
+    int32 MaxCachedProfiles = 200;
+
+    UPROPERTY(Config, EditAnywhere, Category = "Player Data")
+    float PrefetchRadiusKm = 2.0f;
+
+    UPROPERTY(Config, EditAnywhere, Category = "Player Data")
+    float PrefetchIntervalSeconds = 5.0f;
+
+    // Nearest players prefetched per pass around the map center
+    UPROPERTY(Config, EditAnywhere, Category = "Player Data")
+    int32 MaxPrefetchPerPass = 10;
+
+private:
+    struct FProfileSubscriber
+    {
+        uint64 Handle = 0;
+        FOnPlayerProfileReady OnReady;
+        // Already holding cached data, so a failed refresh is not reported
+        bool bServedStale = false;
+    };
+
+    struct FPendingProfile
+    {
+        bool bInFlight = false;
+        TArray<FProfileSubscriber> Subscribers;
+    };
+
+    bool IsFresh(const FCachedPlayerProfile& Cached, double Now) const;
+    bool IsServable(const FCachedPlayerProfile& Cached, double Now) const;
+
+    // Adds the player to the next batch unless it is already queued or in flight
+    void QueueFetch(const FString& PlayerId);
+    void ScheduleBatchFlush();
+    bool FlushBatches(float DeltaTime);
+    void SendBatch(TArray<FString>&& PlayerIds);
+    void OnBatchComplete(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSuccess, TArray<FString> PlayerIds);
+
+    void FinishProfile(const FString& PlayerId, FPlayerProfileData&& Profile);
+    void FailProfile(const FString& PlayerId, const FString& Error);
+
+    void AddToCache(FPlayerProfileData&& Profile);
+    void EvictToBudget();
+
+    UFUNCTION()
+    void HandlePlayerSelected(const FPlayerData& SelectedPlayer);
+
+    bool PrefetchAroundMapCenter(float DeltaTime);
+
+    UPROPERTY()
+    TMap<FString, FCachedPlayerProfile> CachedProfiles;
+
+    TMap<FString, FPendingProfile> PendingProfiles;
+    TMap<uint64, FString> PendingHandles;
+    TArray<FString> QueuedPlayerIds;
+    TArray<TSharedPtr<IHttpRequest, ESPMode::ThreadSafe>> InFlightBatches;
+
+    TWeakObjectPtr<AMapView> BoundMapView;
+    FTSTicker::FDelegateHandle BatchFlushHandle;
+    FTSTicker::FDelegateHandle PrefetchTickerHandle;
+
+    uint64 UseCounter = 0;
+    uint64 NextRequestHandle = 1;
+    FPlayerDataStats Stats;
+};
@@ -1,13 +1,25 @@
 #include "PlayerProfileWidget.h"
+#include "SportBeaconStats.h"
 #include "Components/TextBlock.h"
 #include "Components/Image.h"
 #include "Components/Border.h"
 #include "Components/VerticalBox.h"
+#include "Components/HorizontalBox.h"
 #include "Components/ScrollBox.h"
+#include "Components/SceneCaptureComponent2D.h"
+#include "Engine/TextureRenderTarget2D.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
 #include "Kismet/GameplayStatics.h"
+#include "ImageCacheSubsystem.h"
+#include "PlayerDataSubsystem.h"
+#include "ChallengeCardWidget.h"
 
 UPlayerProfileWidget::UPlayerProfileWidget(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
+    , AvatarActor(nullptr)
+    , AvatarCapture(nullptr)
+    , AvatarRenderTarget(nullptr)
 {
 }
 
@@ -18,12 +30,34 @@ void UPlayerProfileWidget::NativeConstruct()
     // Initialize UI elements
     if (PlayerAvatar)
     {
-        PlayerAvatar->OnMouseButtonDownEvent.BindUFunction(this, "HandleAvatarClicked");
+        PlayerAvatar->OnMouseButtonDownEvent.BindUFunction(this, "HandleAvatarMouseDown");
+    }
+
+    if (AvatarViewport)
+    {
+        AvatarViewport->OnMouseButtonDownEvent.BindUFunction(this, "HandleAvatarMouseDown");
     }
 
     InitializeAvatarViewport();
 }
 
+void UPlayerProfileWidget::NativeDestruct()
+{
+    CancelProfileRequest();
+    ReleaseAvatarViewport();
+
+    Super::NativeDestruct();
+}
+
+void UPlayerProfileWidget::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
+{
+    Super::NativeTick(MyGeometry, InDeltaTime);
+
+    // Live stat pushes arriving faster than the frame rate collapse into one pass
+    FlushPendingDisplay();
+    TickAvatarViewport();
+}
+
 void UPlayerProfileWidget::UpdatePlayerProfile(const FString& PlayerId)
 {
     if (CurrentPlayerId == PlayerId)
@@ -31,6 +65,7 @@ void UPlayerProfileWidget::UpdatePlayerProfile(const FString& PlayerId)
         return;
     }
 
+    CancelProfileRequest();
     CurrentPlayerId = PlayerId;
 
     // Clear existing data
@@ -38,61 +73,190 @@ void UPlayerProfileWidget::UpdatePlayerProfile(const FString& PlayerId)
     {
         TimelineFeed->ClearFeed();
     }
+    AppliedFeedHash = 0;
 
     if (BadgesContainer)
     {
         BadgesContainer->ClearChildren();
     }
 
-    // TODO: Load player data from backend
-    // For now, we'll update with mock data
-    FPlayerStats MockStats;
-    MockStats.PointsPerGame = 15.5f;
-    MockStats.AssistsPerGame = 4.2f;
-    MockStats.ReboundsPerGame = 6.8f;
-    MockStats.StealsPlusBlocks = 2.5f;
-    MockStats.WinRate = 0.65f;
-    MockStats.FieldGoalPercentage = 48.5f;
-    MockStats.ThreePointPercentage = 36.8f;
+    UPlayerDataSubsystem* PlayerData = UPlayerDataSubsystem::Get(this);
+    if (!PlayerData)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("No player data subsystem, profile %s not loaded"), *PlayerId);
+        return;
+    }
 
-    UpdateStats(MockStats);
+    // A cached profile is applied inside this call, before the handle comes back
+    ProfileRequestHandle = PlayerData->RequestProfile(PlayerId,
+        FOnPlayerProfileReady::CreateUObject(this, &UPlayerProfileWidget::OnPlayerProfileReady, PlayerId));
+}
 
-    // Create mock trends
-    TArray<FStatTrend> MockTrends;
-    
-    FStatTrend PointsTrend;
-    PointsTrend.StatName = TEXT("Points");
-    PointsTrend.CurrentValue = 15.5f;
-    PointsTrend.PreviousValue = 14.2f;
-    PointsTrend.PercentageChange = 9.15f;
-    PointsTrend.bIsPositiveTrend = true;
-    MockTrends.Add(PointsTrend);
+void UPlayerProfileWidget::OnPlayerProfileReady(const FPlayerProfileData* Profile, bool bIsStale, const FString& ErrorMessage, FString PlayerId)
+{
+    if (PlayerId != CurrentPlayerId)
+    {
+        return;
+    }
 
-    UpdateTrends(MockTrends);
+    // Stale data is followed by the refreshed copy on the same request
+    if (!bIsStale || !Profile)
+    {
+        ProfileRequestHandle = 0;
+    }
+
+    if (!Profile)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Failed to load profile %s: %s"), *PlayerId, *ErrorMessage);
+        return;
+    }
+
+    ApplyProfile(*Profile);
 }
 
-void UPlayerProfileWidget::UpdateStats(const FPlayerStats& Stats)
+void UPlayerProfileWidget::ApplyProfile(const FPlayerProfileData& Profile)
 {
-    CurrentStats = Stats;
+    if (PlayerNameText)
+    {
+        PlayerNameText->SetText(FText::FromString(Profile.DisplayName));
+    }
 
-    if (StatsContainer)
+    if (PlayerRankText)
     {
-        UpdateStatDisplay();
+        PlayerRankText->SetText(FText::FromString(Profile.Rank));
+    }
+
+    SetAvatarImage(Profile.AvatarUrl);
+    UpdateStats(Profile.Stats);
+    UpdateTrends(Profile.Trends);
+    UpdateProgressionDisplay(Profile.Progression);
+    UpdateChallenges(Profile.Challenges);
+
+    // The refreshed copy replaces what the stale one added, unless nothing changed
+    uint32 FeedHash = GetTypeHash(Profile.PlayerId);
+    for (const FFeedEntry& Highlight : Profile.Highlights)
+    {
+        FeedHash = HashCombine(FeedHash, HashCombine(GetTypeHash(Highlight.Title), GetTypeHash(Highlight.Timestamp)));
+    }
+    for (const FBadgeData& Badge : Profile.Badges)
+    {
+        FeedHash = HashCombine(FeedHash, HashCombine(GetTypeHash(Badge.BadgeID), GetTypeHash(Badge.EarnedDate)));
+    }
+
+    if (FeedHash == AppliedFeedHash)
+    {
+        return;
+    }
+    AppliedFeedHash = FeedHash;
+
+    if (TimelineFeed)
+    {
+        TimelineFeed->ClearFeed();
+        TimelineFeed->AddFeedEntries(Profile.Highlights);
     }
 
-    OnStatsUpdated();
+    for (const FBadgeData& Badge : Profile.Badges)
+    {
+        AddBadge(Badge);
+    }
+}
+
+void UPlayerProfileWidget::CancelProfileRequest()
+{
+    if (ProfileRequestHandle == 0)
+    {
+        return;
+    }
+
+    if (UPlayerDataSubsystem* PlayerData = UPlayerDataSubsystem::Get(this))
+    {
+        PlayerData->CancelRequest(ProfileRequestHandle);
+    }
+    ProfileRequestHandle = 0;
+}
+
+void UPlayerProfileWidget::SetAvatarImage(const FString& AvatarUrl)
+{
+    if (AvatarUrl == CurrentAvatarUrl)
+    {
+        return;
+    }
+
+    CurrentAvatarUrl = AvatarUrl;
+
+    UImageCacheSubsystem* ImageCache = UImageCacheSubsystem::Get(this);
+    if (!ImageCache || !PlayerAvatar)
+    {
+        return;
+    }
+
+    if (AvatarRequestHandle != 0)
+    {
+        ImageCache->CancelRequest(AvatarRequestHandle);
+        AvatarRequestHandle = 0;
+    }
+
+    if (!AvatarUrl.IsEmpty())
+    {
+        AvatarRequestHandle = ImageCache->RequestImage(AvatarUrl,
+            FOnCachedImageReady::CreateUObject(this, &UPlayerProfileWidget::OnAvatarImageReady, AvatarUrl));
+    }
+}
+
+void UPlayerProfileWidget::OnAvatarImageReady(UTexture2D* Texture, const FString& ErrorMessage, FString AvatarUrl)
+{
+    if (AvatarUrl != CurrentAvatarUrl)
+    {
+        return;
+    }
+
+    AvatarRequestHandle = 0;
+
+    if (Texture && PlayerAvatar)
+    {
+        PlayerAvatar->SetBrushFromTexture(Texture);
+    }
+    else if (!Texture)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Failed to load avatar %s: %s"), *AvatarUrl, *ErrorMessage);
+    }
+}
+
+void UPlayerProfileWidget::UpdateStats(const FPlayerStats& Stats)
+{
+    CurrentStats = Stats;
+    bStatsDirty = true;
 }
 
 void UPlayerProfileWidget::UpdateTrends(const TArray<FStatTrend>& Trends)
 {
     CurrentTrends = Trends;
+    bTrendsDirty = true;
+}
 
-    if (TrendsContainer)
+void UPlayerProfileWidget::FlushPendingDisplay()
+{
+    SPORTBEACON_SCOPE_CYCLE(ProfileDisplay);
+
+    if (bStatsDirty)
+    {
+        bStatsDirty = false;
+        UpdateStatDisplay();
+        OnStatsUpdated();
+    }
+
+    if (bTrendsDirty)
     {
+        bTrendsDirty = false;
         UpdateTrendDisplay();
+        OnTrendsUpdated();
     }
 
-    OnTrendsUpdated();
+    if (bChallengesDirty)
+    {
+        bChallengesDirty = false;
+        UpdateChallengeCards();
+    }
 }
 
 void UPlayerProfileWidget::AddHighlight(const FFeedEntry& Highlight)
@@ -115,10 +279,146 @@ void UPlayerProfileWidget::AddBadge(const FBadgeData& Badge)
 
 void UPlayerProfileWidget::InitializeAvatarViewport()
 {
-    if (AvatarViewport)
+    UWorld* World = GetWorld();
+    if (!AvatarViewport || !AvatarActorClass || !World || AvatarActor)
+    {
+        return;
+    }
+
+    FActorSpawnParameters SpawnParams;
+    SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+    SpawnParams.ObjectFlags |= RF_Transient;
+
+    AvatarActor = World->SpawnActor<AActor>(AvatarActorClass, FTransform(AvatarSpawnLocation), SpawnParams);
+    if (!AvatarActor)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Failed to spawn avatar actor %s"), *AvatarActorClass->GetName());
+        return;
+    }
+
+    AvatarRenderTarget = NewObject<UTextureRenderTarget2D>(this);
+    AvatarRenderTarget->RenderTargetFormat = RTF_RGBA8;
+    AvatarRenderTarget->ClearColor = FLinearColor::Transparent;
+    AvatarRenderTarget->InitAutoFormat(FMath::Max(AvatarRenderSize.X, 16), FMath::Max(AvatarRenderSize.Y, 16));
+    AvatarRenderTarget->UpdateResourceImmediate(true);
+
+    // Never captures by itself, TickAvatarViewport decides when a frame is worth rendering
+    AvatarCapture = NewObject<USceneCaptureComponent2D>(AvatarActor, TEXT("AvatarCapture"));
+    AvatarCapture->SetupAttachment(AvatarActor->GetRootComponent());
+    AvatarCapture->SetRelativeTransform(AvatarCameraTransform);
+    AvatarCapture->bCaptureEveryFrame = false;
+    AvatarCapture->bCaptureOnMovement = false;
+    AvatarCapture->PrimitiveRenderMode = ESceneCapturePrimitiveRenderMode::PRM_UseShowOnlyList;
+    AvatarCapture->ShowOnlyActors.Add(AvatarActor);
+    AvatarCapture->CaptureSource = ESceneCaptureSource::SCS_FinalColorLDR;
+    AvatarCapture->FOVAngle = AvatarFieldOfView;
+    AvatarCapture->TextureTarget = AvatarRenderTarget;
+    AvatarCapture->RegisterComponent();
+
+    AvatarViewport->SetBrushResourceObject(AvatarRenderTarget);
+
+    bAvatarDirty = true;
+    AvatarTickingSinceFrame = GFrameCounter;
+    World->GetTimerManager().SetTimer(AvatarIdleTimer, this, &UPlayerProfileWidget::CheckAvatarIdle, 1.0f, true);
+}
+
+void UPlayerProfileWidget::ReleaseAvatarViewport()
+{
+    if (UWorld* World = GetWorld())
+    {
+        World->GetTimerManager().ClearTimer(AvatarIdleTimer);
+    }
+
+    if (AvatarActor)
+    {
+        AvatarActor->Destroy();
+    }
+
+    AvatarActor = nullptr;
+    AvatarCapture = nullptr;
+    AvatarRenderTarget = nullptr;
+    bAvatarActorTicking = true;
+}
+
+void UPlayerProfileWidget::RefreshAvatar()
+{
+    bAvatarDirty = true;
+}
+
+void UPlayerProfileWidget::SetAvatarRenderMode(EAvatarRenderMode NewMode)
+{
+    AvatarRenderMode = NewMode;
+    bAvatarDirty = true;
+}
+
+void UPlayerProfileWidget::TickAvatarViewport()
+{
+    // Only reached while the widget is painted, so off-screen or collapsed profiles never capture
+    if (!AvatarCapture || !AvatarViewport || !AvatarViewport->IsVisible())
+    {
+        return;
+    }
+
+    LastAvatarPaintFrame = GFrameCounter;
+
+    const double Now = FPlatformTime::Seconds();
+    const bool bLive = AvatarRenderMode == EAvatarRenderMode::Live || Now < AvatarInteractiveUntil;
+    const bool bIdleRefresh = AvatarIdleRefreshInterval > 0.0f;
+
+    // Animation only needs to advance if someone will see a later frame. A pending capture
+    // keeps it running too, so OnDemand never freezes the actor before its first pose.
+    SetAvatarActorTicking(bLive || bIdleRefresh || bAvatarDirty);
+
+    // Ticking switched on this frame has not posed the actor yet, capture on the next one
+    if (GFrameCounter <= AvatarTickingSinceFrame)
+    {
+        return;
+    }
+
+    if (bAvatarDirty || bLive || (bIdleRefresh && Now - LastAvatarCaptureTime >= AvatarIdleRefreshInterval))
+    {
+        CaptureAvatar();
+        LastAvatarCaptureTime = Now;
+    }
+}
+
+void UPlayerProfileWidget::CaptureAvatar()
+{
+    SPORTBEACON_SCOPE_CYCLE(AvatarCapture);
+
+    bAvatarDirty = false;
+    AvatarCapture->CaptureScene();
+}
+
+void UPlayerProfileWidget::SetAvatarActorTicking(bool bTicking)
+{
+    if (!AvatarActor || bAvatarActorTicking == bTicking)
+    {
+        return;
+    }
+
+    bAvatarActorTicking = bTicking;
+    if (bTicking)
+    {
+        AvatarTickingSinceFrame = GFrameCounter;
+    }
+    AvatarActor->SetActorTickEnabled(bTicking);
+
+    for (UActorComponent* Component : AvatarActor->GetComponents())
+    {
+        if (Component && Component != AvatarCapture)
+        {
+            Component->SetComponentTickEnabled(bTicking);
+        }
+    }
+}
+
+void UPlayerProfileWidget::CheckAvatarIdle()
+{
+    // Hidden, removed from the viewport or scrolled out of a clipping parent: nothing paints, so stop the avatar
+    if (GFrameCounter - LastAvatarPaintFrame > 1)
     {
-        // TODO: Set up 3D avatar viewport
-        // This will be implemented when the avatar system is ready
+        SetAvatarActorTicking(false);
     }
 }
 
@@ -129,33 +429,60 @@ void UPlayerProfileWidget::UpdateStatDisplay()
         return;
     }
 
-    StatsContainer->ClearChildren();
-
-    // Create stat entries
-    auto AddStatRow = [this](const FString& Label, float Value, const FString& Suffix = TEXT(""))
-    {
-        UHorizontalBox* Row = NewObject<UHorizontalBox>(StatsContainer);
-        
-        UTextBlock* LabelText = NewObject<UTextBlock>(Row);
-        LabelText->SetText(FText::FromString(Label));
-        
-        UTextBlock* ValueText = NewObject<UTextBlock>(Row);
-        FString ValueString = FString::Printf(TEXT("%.1f%s"), Value, *Suffix);
-        ValueText->SetText(FText::FromString(ValueString));
-        
-        Row->AddChild(LabelText);
-        Row->AddChild(ValueText);
-        
-        StatsContainer->AddChild(Row);
+    struct FStatRowDesc
+    {
+        const TCHAR* Label;
+        float FPlayerStats::* Value;
+        const TCHAR* Suffix;
+    };
+
+    static const FStatRowDesc StatRows[] =
+    {
+        { TEXT("Points Per Game"), &FPlayerStats::PointsPerGame, TEXT("") },
+        { TEXT("Assists"), &FPlayerStats::AssistsPerGame, TEXT("") },
+        { TEXT("Rebounds"), &FPlayerStats::ReboundsPerGame, TEXT("") },
+        { TEXT("Steals + Blocks"), &FPlayerStats::StealsPlusBlocks, TEXT("") },
+        { TEXT("Win Rate"), &FPlayerStats::WinRate, TEXT("%") },
+        { TEXT("FG%"), &FPlayerStats::FieldGoalPercentage, TEXT("%") },
+        { TEXT("3P%"), &FPlayerStats::ThreePointPercentage, TEXT("%") },
     };
 
-    AddStatRow(TEXT("Points Per Game"), CurrentStats.PointsPerGame);
-    AddStatRow(TEXT("Assists"), CurrentStats.AssistsPerGame);
-    AddStatRow(TEXT("Rebounds"), CurrentStats.ReboundsPerGame);
-    AddStatRow(TEXT("Steals + Blocks"), CurrentStats.StealsPlusBlocks);
-    AddStatRow(TEXT("Win Rate"), CurrentStats.WinRate, TEXT("%"));
-    AddStatRow(TEXT("FG%"), CurrentStats.FieldGoalPercentage, TEXT("%"));
-    AddStatRow(TEXT("3P%"), CurrentStats.ThreePointPercentage, TEXT("%"));
+    // Rows are built once, labels never change afterwards
+    if (StatValueTexts.Num() != UE_ARRAY_COUNT(StatRows))
+    {
+        StatsContainer->ClearChildren();
+        StatValueTexts.Reset();
+        DisplayedStatValues.Reset();
+
+        for (const FStatRowDesc& Desc : StatRows)
+        {
+            UHorizontalBox* Row = NewObject<UHorizontalBox>(StatsContainer);
+            
+            UTextBlock* LabelText = NewObject<UTextBlock>(Row);
+            LabelText->SetText(FText::FromString(Desc.Label));
+            
+            UTextBlock* ValueText = NewObject<UTextBlock>(Row);
+            
+            Row->AddChild(LabelText);
+            Row->AddChild(ValueText);
+            
+            StatsContainer->AddChild(Row);
+            StatValueTexts.Add(ValueText);
+            DisplayedStatValues.AddDefaulted();
+        }
+    }
+
+    // Compared as formatted text, so changes below display precision cost nothing
+    for (int32 Index = 0; Index < UE_ARRAY_COUNT(StatRows); ++Index)
+    {
+        const FStatRowDesc& Desc = StatRows[Index];
+        FString ValueString = FString::Printf(TEXT("%.1f%s"), CurrentStats.*Desc.Value, Desc.Suffix);
+        if (ValueString != DisplayedStatValues[Index])
+        {
+            StatValueTexts[Index]->SetText(FText::FromString(ValueString));
+            DisplayedStatValues[Index] = MoveTemp(ValueString);
+        }
+    }
 }
 
 void UPlayerProfileWidget::UpdateTrendDisplay()
@@ -165,35 +492,82 @@ void UPlayerProfileWidget::UpdateTrendDisplay()
         return;
     }
 
-    TrendsContainer->ClearChildren();
+    // Rows for trends that are gone
+    for (auto It = TrendRows.CreateIterator(); It; ++It)
+    {
+        const bool bStillPresent = CurrentTrends.ContainsByPredicate([&It](const FStatTrend& Trend)
+        {
+            return Trend.StatName == It.Key();
+        });
 
-    for (const FStatTrend& Trend : CurrentTrends)
+        if (!bStillPresent)
+        {
+            It.Value()->RemoveFromParent();
+            DisplayedTrends.Remove(It.Key());
+            It.RemoveCurrent();
+        }
+    }
+
+    bool bOrderChanged = TrendsContainer->GetChildrenCount() != CurrentTrends.Num();
+
+    for (int32 Index = 0; Index < CurrentTrends.Num(); ++Index)
     {
-        UHorizontalBox* Row = NewObject<UHorizontalBox>(TrendsContainer);
-        
-        // Stat name
-        UTextBlock* NameText = NewObject<UTextBlock>(Row);
-        NameText->SetText(FText::FromString(Trend.StatName));
-        
-        // Change indicator
-        UTextBlock* ChangeText = NewObject<UTextBlock>(Row);
+        const FStatTrend& Trend = CurrentTrends[Index];
+
+        UHorizontalBox*& Row = TrendRows.FindOrAdd(Trend.StatName);
+        if (!Row)
+        {
+            Row = NewObject<UHorizontalBox>(TrendsContainer);
+            
+            // Stat name
+            UTextBlock* NameText = NewObject<UTextBlock>(Row);
+            NameText->SetText(FText::FromString(Trend.StatName));
+            
+            // Change indicator
+            UTextBlock* ChangeText = NewObject<UTextBlock>(Row);
+            
+            Row->AddChild(NameText);
+            Row->AddChild(ChangeText);
+            bOrderChanged = true;
+        }
+
+        bOrderChanged |= TrendsContainer->GetChildAt(Index) != Row;
+
         FString ChangeString = FString::Printf(
             TEXT("%s%.1f%%"),
             Trend.bIsPositiveTrend ? TEXT("+") : TEXT(""),
             Trend.PercentageChange
         );
-        ChangeText->SetText(FText::FromString(ChangeString));
-        
-        // Set color based on trend
-        FSlateColor Color = Trend.bIsPositiveTrend ? 
-            FSlateColor(FLinearColor::Green) : 
-            FSlateColor(FLinearColor::Red);
-        ChangeText->SetColorAndOpacity(Color);
-        
-        Row->AddChild(NameText);
-        Row->AddChild(ChangeText);
-        
-        TrendsContainer->AddChild(Row);
+
+        TPair<FString, bool>* Displayed = DisplayedTrends.Find(Trend.StatName);
+        if (Displayed && Displayed->Key == ChangeString && Displayed->Value == Trend.bIsPositiveTrend)
+        {
+            continue;
+        }
+
+        UTextBlock* ChangeText = Cast<UTextBlock>(Row->GetChildAt(1));
+        if (ChangeText)
+        {
+            ChangeText->SetText(FText::FromString(ChangeString));
+            
+            // Set color based on trend
+            FSlateColor Color = Trend.bIsPositiveTrend ? 
+                FSlateColor(FLinearColor::Green) : 
+                FSlateColor(FLinearColor::Red);
+            ChangeText->SetColorAndOpacity(Color);
+        }
+
+        DisplayedTrends.Add(Trend.StatName, TPair<FString, bool>(MoveTemp(ChangeString), Trend.bIsPositiveTrend));
+    }
+
+    // Only a membership or order change re-parents rows
+    if (bOrderChanged)
+    {
+        TrendsContainer->ClearChildren();
+        for (const FStatTrend& Trend : CurrentTrends)
+        {
+            TrendsContainer->AddChild(TrendRows.FindChecked(Trend.StatName));
+        }
     }
 }
 
@@ -210,9 +584,16 @@ void UPlayerProfileWidget::UpdateBadgeProgress()
 
 void UPlayerProfileWidget::HandleAvatarClicked()
 {
+    AvatarInteractiveUntil = FPlatformTime::Seconds() + AvatarInteractionSeconds;
     OnAvatarClicked();
 }
 
+FEventReply UPlayerProfileWidget::HandleAvatarMouseDown(FGeometry MyGeometry, const FPointerEvent& MouseEvent)
+{
+    HandleAvatarClicked();
+    return FEventReply(true);
+}
+
 void UPlayerProfileWidget::UpdateProgressionDisplay(const FPlayerProgressionData& ProgressionData)
 {
     // Update level and XP display
@@ -248,34 +629,91 @@ void UPlayerProfileWidget::UpdateProgressionDisplay(const FPlayerProgressionData
 
 void UPlayerProfileWidget::UpdateChallenges(const TArray<FChallengeData>& Challenges)
 {
-    // Clear existing challenge cards
-    ClearChallengeCards();
+    CurrentChallenges = Challenges;
+    bChallengesDirty = true;
+}
 
+void UPlayerProfileWidget::UpdateChallengeCards()
+{
     if (!ChallengesBox || !ChallengeCardClass)
         return;
 
-    // Create new challenge cards
-    for (const FChallengeData& Challenge : Challenges)
+    // Cards for challenges that are gone go back to the pool
+    for (auto It = ActiveChallengeCards.CreateIterator(); It; ++It)
     {
-        UChallengeCardWidget* ChallengeCard = CreateWidget<UChallengeCardWidget>(this, ChallengeCardClass);
-        if (ChallengeCard)
+        const bool bStillPresent = CurrentChallenges.ContainsByPredicate([&It](const FChallengeData& Challenge)
         {
-            ChallengeCard->SetupChallenge(Challenge);
-            ChallengeCard->OnChallengeProgressed.AddDynamic(
-                this,
-                &UPlayerProfileWidget::OnChallengeProgressed
-            );
-            
-            ChallengesBox->AddChild(ChallengeCard);
-            ActiveChallengeCards.Add(Challenge.Id, ChallengeCard);
+            return Challenge.Id == It.Key();
+        });
+
+        if (!bStillPresent)
+        {
+            It.Value()->RemoveFromParent();
+            ChallengeCardPool.Add(It.Value());
+            It.RemoveCurrent();
+        }
+    }
+
+    bool bOrderChanged = ChallengesBox->GetChildrenCount() != CurrentChallenges.Num();
+
+    // Existing cards keep their widgets and only refresh fields that changed
+    for (int32 Index = 0; Index < CurrentChallenges.Num(); ++Index)
+    {
+        const FChallengeData& Challenge = CurrentChallenges[Index];
+
+        UChallengeCardWidget*& ChallengeCard = ActiveChallengeCards.FindOrAdd(Challenge.Id);
+        if (!ChallengeCard)
+        {
+            ChallengeCard = AcquireChallengeCard();
+            if (!ChallengeCard)
+            {
+                ActiveChallengeCards.Remove(Challenge.Id);
+                continue;
+            }
+            bOrderChanged = true;
+        }
+
+        ChallengeCard->SetupChallenge(Challenge);
+        bOrderChanged |= ChallengesBox->GetChildAt(Index) != ChallengeCard;
+    }
+
+    if (bOrderChanged)
+    {
+        ChallengesBox->ClearChildren();
+        for (const FChallengeData& Challenge : CurrentChallenges)
+        {
+            if (UChallengeCardWidget** ChallengeCard = ActiveChallengeCards.Find(Challenge.Id))
+            {
+                ChallengesBox->AddChild(*ChallengeCard);
+            }
         }
     }
 }
 
+UChallengeCardWidget* UPlayerProfileWidget::AcquireChallengeCard()
+{
+    if (ChallengeCardPool.Num() > 0)
+    {
+        return ChallengeCardPool.Pop(false);
+    }
+
+    return CreateWidget<UChallengeCardWidget>(this, ChallengeCardClass);
+}
+
 void UPlayerProfileWidget::OnChallengeProgressed(const FString& ChallengeId, float Progress)
 {
+    // Kept in the data too, so a pending or later diff does not roll the card back
+    for (FChallengeData& Challenge : CurrentChallenges)
+    {
+        if (Challenge.Id == ChallengeId)
+        {
+            Challenge.CurrentProgress = FMath::RoundToInt(Progress);
+            break;
+        }
+    }
+
     UChallengeCardWidget** CardWidget = ActiveChallengeCards.Find(ChallengeId);
-    if (CardWidget)
+    if (CardWidget && !bChallengesDirty)
     {
         (*CardWidget)->UpdateProgress(Progress);
     }
@@ -287,5 +725,12 @@ void UPlayerProfileWidget::ClearChallengeCards()
     {
         ChallengesBox->ClearChildren();
     }
+
+    for (const TPair<FString, UChallengeCardWidget*>& Entry : ActiveChallengeCards)
+    {
+        ChallengeCardPool.Add(Entry.Value);
+    }
     ActiveChallengeCards.Empty();
-} 
\ No newline at end of file
+    CurrentChallenges.Reset();
+    bChallengesDirty = false;
+}
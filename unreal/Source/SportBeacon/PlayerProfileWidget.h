@@ -11,6 +11,17 @@
 #include "BadgeRewardWidget.h"
 #include "PlayerProfileWidget.generated.h"
 
+struct FPlayerProfileData;
+
+UENUM(BlueprintType)
+enum class EAvatarRenderMode : uint8
+{
+    // Captures every frame while the widget is painted
+    Live,
+    // Captures on changes and interaction, otherwise at most every AvatarIdleRefreshInterval
+    OnDemand
+};
+
 USTRUCT(BlueprintType)
 struct FPlayerStats
 {
@@ -60,39 +71,39 @@ struct FStatTrend
 };
 
 USTRUCT(BlueprintType)
-struct FPlayerProgressionData
+struct FNextTierRequirements
 {
     GENERATED_BODY()
 
     UPROPERTY(BlueprintReadWrite, Category = "Progression")
-    int32 TotalXP;
-
-    UPROPERTY(BlueprintReadWrite, Category = "Progression")
-    int32 Level;
-
-    UPROPERTY(BlueprintReadWrite, Category = "Progression")
-    float LevelProgress;
+    FString TierName;
 
     UPROPERTY(BlueprintReadWrite, Category = "Progression")
-    FString Tier;
+    int32 RequiredLevel;
 
     UPROPERTY(BlueprintReadWrite, Category = "Progression")
-    FNextTierRequirements NextTier;
+    int32 RequiredBadges;
 };
 
 USTRUCT(BlueprintType)
-struct FNextTierRequirements
+struct FPlayerProgressionData
 {
     GENERATED_BODY()
 
     UPROPERTY(BlueprintReadWrite, Category = "Progression")
-    FString TierName;
+    int32 TotalXP;
 
     UPROPERTY(BlueprintReadWrite, Category = "Progression")
-    int32 RequiredLevel;
+    int32 Level;
 
     UPROPERTY(BlueprintReadWrite, Category = "Progression")
-    int32 RequiredBadges;
+    float LevelProgress;
+
+    UPROPERTY(BlueprintReadWrite, Category = "Progression")
+    FString Tier;
+
+    UPROPERTY(BlueprintReadWrite, Category = "Progression")
+    FNextTierRequirements NextTier;
 };
 
 USTRUCT(BlueprintType)
@@ -134,14 +145,24 @@ public:
     UPlayerProfileWidget(const FObjectInitializer& ObjectInitializer);
 
     virtual void NativeConstruct() override;
+    virtual void NativeDestruct() override;
+    virtual void NativeTick(const FGeometry& MyGeometry, float InDeltaTime) override;
 
     // Profile Data Update Functions
+    // Loads through UPlayerDataSubsystem. Cached data shows immediately and is
+    // replaced once a refresh arrives.
     UFUNCTION(BlueprintCallable, Category = "Player Profile")
     void UpdatePlayerProfile(const FString& PlayerId);
 
+    // Stats, trends and challenges pushed within one frame are applied together
+    // on the next tick, and only rows whose values changed are touched
     UFUNCTION(BlueprintCallable, Category = "Player Profile")
     void UpdateStats(const FPlayerStats& Stats);
 
+    // Loads through UImageCacheSubsystem, so an avatar already shown elsewhere is reused
+    UFUNCTION(BlueprintCallable, Category = "Player Profile")
+    void SetAvatarImage(const FString& AvatarUrl);
+
     UFUNCTION(BlueprintCallable, Category = "Player Profile")
     void UpdateTrends(const TArray<FStatTrend>& Trends);
 
@@ -170,6 +191,16 @@ public:
     UFUNCTION(BlueprintImplementableEvent, Category = "Player Profile")
     void OnAvatarClicked();
 
+    // Re-captures the 3D avatar on the next painted frame, call after changing its look
+    UFUNCTION(BlueprintCallable, Category = "Player Profile|Avatar")
+    void RefreshAvatar();
+
+    UFUNCTION(BlueprintCallable, Category = "Player Profile|Avatar")
+    void SetAvatarRenderMode(EAvatarRenderMode NewMode);
+
+    UFUNCTION(BlueprintPure, Category = "Player Profile|Avatar")
+    AActor* GetAvatarActor() const { return AvatarActor; }
+
 protected:
     // Main Layout Sections
     UPROPERTY(BlueprintReadWrite, meta = (BindWidget))
@@ -205,9 +236,9 @@ protected:
     UPROPERTY(BlueprintReadWrite, meta = (BindWidget))
     UVerticalBox* BadgesContainer;
 
-    // 3D Avatar Viewport
-    UPROPERTY(BlueprintReadWrite, meta = (BindWidget))
-    class UGameViewportClient* AvatarViewport;
+    // 3D Avatar Viewport, shows the avatar render target
+    UPROPERTY(BlueprintReadWrite, meta = (BindWidgetOptional))
+    UImage* AvatarViewport;
 
     UPROPERTY(BlueprintReadWrite, meta = (BindWidget))
     class UProgressBar* XPProgressBar;
@@ -227,22 +258,113 @@ protected:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UI")
     TSubclassOf<class UChallengeCardWidget> ChallengeCardClass;
 
+    // Spawned out of sight and captured into AvatarViewport, no avatar when unset
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Avatar")
+    TSubclassOf<AActor> AvatarActorClass;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Avatar")
+    EAvatarRenderMode AvatarRenderMode = EAvatarRenderMode::OnDemand;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Avatar")
+    FIntPoint AvatarRenderSize = FIntPoint(512, 512);
+
+    // Far from the playable map so the main view never sees the avatar
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Avatar")
+    FVector AvatarSpawnLocation = FVector(0.0f, 0.0f, -100000.0f);
+
+    // Capture camera relative to the avatar actor
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Avatar")
+    FTransform AvatarCameraTransform = FTransform(FRotator(0.0f, 180.0f, 0.0f), FVector(250.0f, 0.0f, 90.0f));
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Avatar")
+    float AvatarFieldOfView = 30.0f;
+
+    // Idle re-capture period in OnDemand mode, 0 captures only on changes and interaction
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Avatar")
+    float AvatarIdleRefreshInterval = 0.0f;
+
+    // How long a click keeps the avatar rendering live
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Avatar")
+    float AvatarInteractionSeconds = 3.0f;
+
 private:
     FString CurrentPlayerId;
+    FString CurrentAvatarUrl;
+    uint64 AvatarRequestHandle = 0;
+    uint64 ProfileRequestHandle = 0;
     FPlayerStats CurrentStats;
     TArray<FStatTrend> CurrentTrends;
+    TArray<FChallengeData> CurrentChallenges;
+
+    // Set by the Update* calls, cleared by FlushPendingDisplay
+    bool bStatsDirty = false;
+    bool bTrendsDirty = false;
+    bool bChallengesDirty = false;
+
+    // Stat rows are built once, afterwards only value texts whose string changed are set
+    UPROPERTY()
+    TArray<UTextBlock*> StatValueTexts;
+    TArray<FString> DisplayedStatValues;
+
+    // Trend rows keyed by StatName with the change text and sign they currently show
+    UPROPERTY()
+    TMap<FString, class UHorizontalBox*> TrendRows;
+    TMap<FString, TPair<FString, bool>> DisplayedTrends;
 
     UPROPERTY()
     TMap<FString, class UChallengeCardWidget*> ActiveChallengeCards;
 
+    // Cards dropped from the list, reused before creating new ones
+    UPROPERTY()
+    TArray<class UChallengeCardWidget*> ChallengeCardPool;
+
+    // Highlights and badges currently in the feed, so an unchanged refresh leaves it alone
+    uint32 AppliedFeedHash = 0;
+
+    UPROPERTY()
+    AActor* AvatarActor;
+
+    UPROPERTY()
+    class USceneCaptureComponent2D* AvatarCapture;
+
+    UPROPERTY()
+    class UTextureRenderTarget2D* AvatarRenderTarget;
+
+    // Needs one capture regardless of mode, set on setup and RefreshAvatar
+    bool bAvatarDirty = false;
+    bool bAvatarActorTicking = true;
+    // Frame ticking was last switched on, a capture waits until the actor has ticked since
+    uint64 AvatarTickingSinceFrame = 0;
+    double AvatarInteractiveUntil = 0.0;
+    double LastAvatarCaptureTime = 0.0;
+    // Last frame the widget was painted with the avatar visible
+    uint64 LastAvatarPaintFrame = 0;
+    FTimerHandle AvatarIdleTimer;
+
     void InitializeAvatarViewport();
+    void ReleaseAvatarViewport();
+    void TickAvatarViewport();
+    void CaptureAvatar();
+    void SetAvatarActorTicking(bool bTicking);
+    void CheckAvatarIdle();
+    void OnAvatarImageReady(UTexture2D* Texture, const FString& ErrorMessage, FString AvatarUrl);
+    void OnPlayerProfileReady(const FPlayerProfileData* Profile, bool bIsStale, const FString& ErrorMessage, FString PlayerId);
+    void ApplyProfile(const FPlayerProfileData& Profile);
+    void CancelProfileRequest();
+    void FlushPendingDisplay();
     void UpdateStatDisplay();
     void UpdateTrendDisplay();
+    void UpdateChallengeCards();
+    class UChallengeCardWidget* AcquireChallengeCard();
     void UpdateBadgeProgress();
     
     UFUNCTION()
     void HandleAvatarClicked();
 
+    // OnMouseButtonDownEvent handler for the avatar image and viewport
+    UFUNCTION()
+    FEventReply HandleAvatarMouseDown(FGeometry MyGeometry, const FPointerEvent& MouseEvent);
+
     void UpdateXPBar(int32 CurrentXP, int32 NextLevelXP);
     void UpdateTierDisplay(const FString& CurrentTier, const FNextTierRequirements& NextTier);
     void ClearChallengeCards();
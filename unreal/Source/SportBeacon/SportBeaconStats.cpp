@@ -0,0 +1,98 @@
+#include "SportBeaconStats.h"
+
+DEFINE_STAT(STAT_SportBeacon_MapTick);
+DEFINE_STAT(STAT_SportBeacon_MapMarkerUpdate);
+DEFINE_STAT(STAT_SportBeacon_MapLocationTracks);
+DEFINE_STAT(STAT_SportBeacon_MapCulling);
+DEFINE_STAT(STAT_SportBeacon_MapClustering);
+DEFINE_STAT(STAT_SportBeacon_MapAnimation);
+DEFINE_STAT(STAT_SportBeacon_FeedFlush);
+DEFINE_STAT(STAT_SportBeacon_FeedLayout);
+DEFINE_STAT(STAT_SportBeacon_ImageDecode);
+DEFINE_STAT(STAT_SportBeacon_ImageDisplay);
+DEFINE_STAT(STAT_SportBeacon_VoiceCapture);
+DEFINE_STAT(STAT_SportBeacon_VoiceEncode);
+DEFINE_STAT(STAT_SportBeacon_CoachStreaming);
+DEFINE_STAT(STAT_SportBeacon_CoachingMessages);
+DEFINE_STAT(STAT_SportBeacon_ProfileDisplay);
+DEFINE_STAT(STAT_SportBeacon_AvatarCapture);
+
+DEFINE_STAT(STAT_SportBeacon_ImageCacheMemory);
+DEFINE_STAT(STAT_SportBeacon_VoiceBufferMemory);
+DEFINE_STAT(STAT_SportBeacon_MapMarkers);
+DEFINE_STAT(STAT_SportBeacon_CachedImages);
+DEFINE_STAT(STAT_SportBeacon_FeedEntries);
+DEFINE_STAT(STAT_SportBeacon_CachedProfiles);
+DEFINE_STAT(STAT_SportBeacon_PooledMediaPlayers);
+
+namespace
+{
+    // Same order as ESportBeaconTimer, used as export column names
+    const TCHAR* const TimerNames[] =
+    {
+        TEXT("MapTick"),
+        TEXT("MapMarkerUpdate"),
+        TEXT("MapLocationTracks"),
+        TEXT("MapCulling"),
+        TEXT("MapClustering"),
+        TEXT("MapAnimation"),
+        TEXT("FeedFlush"),
+        TEXT("FeedLayout"),
+        TEXT("ImageDecode"),
+        TEXT("ImageDisplay"),
+        TEXT("VoiceCapture"),
+        TEXT("VoiceEncode"),
+        TEXT("CoachStreaming"),
+        TEXT("CoachingMessages"),
+        TEXT("ProfileDisplay"),
+        TEXT("AvatarCapture"),
+    };
+
+    const TCHAR* const ValueNames[] =
+    {
+        TEXT("ImageCacheMemory"),
+        TEXT("VoiceBufferMemory"),
+        TEXT("MapMarkers"),
+        TEXT("CachedImages"),
+        TEXT("FeedEntries"),
+        TEXT("CachedProfiles"),
+        TEXT("PooledMediaPlayers"),
+    };
+
+    static_assert(UE_ARRAY_COUNT(TimerNames) == FSportBeaconStats::NumTimers, "TimerNames must match ESportBeaconTimer");
+    static_assert(UE_ARRAY_COUNT(ValueNames) == FSportBeaconStats::NumValues, "ValueNames must match ESportBeaconValue");
+}
+
+std::atomic<bool> FSportBeaconStats::bRecording{ false };
+std::atomic<uint64> FSportBeaconStats::TimerCycles[FSportBeaconStats::NumTimers] = {};
+std::atomic<int64> FSportBeaconStats::Values[FSportBeaconStats::NumValues] = {};
+
+void FSportBeaconStats::SetRecording(bool bEnabled)
+{
+    // Whatever piled up while not recording would land in the first frame
+    for (std::atomic<uint64>& Cycles : TimerCycles)
+    {
+        Cycles.store(0, std::memory_order_relaxed);
+    }
+
+    bRecording.store(bEnabled, std::memory_order_relaxed);
+}
+
+void FSportBeaconStats::ConsumeTimers(double* OutTimerMs)
+{
+    for (int32 Index = 0; Index < NumTimers; ++Index)
+    {
+        const uint64 Cycles = TimerCycles[Index].exchange(0, std::memory_order_relaxed);
+        OutTimerMs[Index] = FPlatformTime::ToMilliseconds64(Cycles);
+    }
+}
+
+const TCHAR* FSportBeaconStats::GetTimerName(int32 TimerIndex)
+{
+    return TimerNames[TimerIndex];
+}
+
+const TCHAR* FSportBeaconStats::GetValueName(int32 ValueIndex)
+{
+    return ValueNames[ValueIndex];
+}
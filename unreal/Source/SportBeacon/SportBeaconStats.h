@@ -0,0 +1,161 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include <atomic>
+
+DECLARE_STATS_GROUP(TEXT("SportBeacon"), STATGROUP_SportBeacon, STATCAT_Advanced);
+
+// Map Tick includes the track, culling, animation and clustering time it drives
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Map Tick"), STAT_SportBeacon_MapTick, STATGROUP_SportBeacon, SPORTBEACON_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Map Marker Update"), STAT_SportBeacon_MapMarkerUpdate, STATGROUP_SportBeacon, SPORTBEACON_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Map Location Tracks"), STAT_SportBeacon_MapLocationTracks, STATGROUP_SportBeacon, SPORTBEACON_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Map Culling"), STAT_SportBeacon_MapCulling, STATGROUP_SportBeacon, SPORTBEACON_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Map Clustering"), STAT_SportBeacon_MapClustering, STATGROUP_SportBeacon, SPORTBEACON_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Map Marker Animation"), STAT_SportBeacon_MapAnimation, STATGROUP_SportBeacon, SPORTBEACON_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Feed Flush"), STAT_SportBeacon_FeedFlush, STATGROUP_SportBeacon, SPORTBEACON_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Feed Layout"), STAT_SportBeacon_FeedLayout, STATGROUP_SportBeacon, SPORTBEACON_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Image Decode"), STAT_SportBeacon_ImageDecode, STATGROUP_SportBeacon, SPORTBEACON_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Image Display"), STAT_SportBeacon_ImageDisplay, STATGROUP_SportBeacon, SPORTBEACON_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Voice Capture"), STAT_SportBeacon_VoiceCapture, STATGROUP_SportBeacon, SPORTBEACON_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Voice Encode"), STAT_SportBeacon_VoiceEncode, STATGROUP_SportBeacon, SPORTBEACON_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Coach Streaming"), STAT_SportBeacon_CoachStreaming, STATGROUP_SportBeacon, SPORTBEACON_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Coaching Messages"), STAT_SportBeacon_CoachingMessages, STATGROUP_SportBeacon, SPORTBEACON_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Profile Display"), STAT_SportBeacon_ProfileDisplay, STATGROUP_SportBeacon, SPORTBEACON_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Avatar Capture"), STAT_SportBeacon_AvatarCapture, STATGROUP_SportBeacon, SPORTBEACON_API);
+
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Image Cache Memory"), STAT_SportBeacon_ImageCacheMemory, STATGROUP_SportBeacon, SPORTBEACON_API);
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Voice Buffer Memory"), STAT_SportBeacon_VoiceBufferMemory, STATGROUP_SportBeacon, SPORTBEACON_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Map Markers"), STAT_SportBeacon_MapMarkers, STATGROUP_SportBeacon, SPORTBEACON_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Cached Images"), STAT_SportBeacon_CachedImages, STATGROUP_SportBeacon, SPORTBEACON_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Feed Entries"), STAT_SportBeacon_FeedEntries, STATGROUP_SportBeacon, SPORTBEACON_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Cached Profiles"), STAT_SportBeacon_CachedProfiles, STATGROUP_SportBeacon, SPORTBEACON_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Pooled Media Players"), STAT_SportBeacon_PooledMediaPlayers, STATGROUP_SportBeacon, SPORTBEACON_API);
+
+// Mirrors of the cycle stats above. STATS is compiled out of shipping builds,
+// so these are what the per-frame recorder reads on real devices.
+enum class ESportBeaconTimer : uint8
+{
+    MapTick,
+    MapMarkerUpdate,
+    MapLocationTracks,
+    MapCulling,
+    MapClustering,
+    MapAnimation,
+    FeedFlush,
+    FeedLayout,
+    ImageDecode,
+    ImageDisplay,
+    VoiceCapture,
+    VoiceEncode,
+    CoachStreaming,
+    CoachingMessages,
+    ProfileDisplay,
+    AvatarCapture,
+    Num
+};
+
+// Mirrors of the memory and accumulator stats above
+enum class ESportBeaconValue : uint8
+{
+    ImageCacheMemory,
+    VoiceBufferMemory,
+    MapMarkers,
+    CachedImages,
+    FeedEntries,
+    CachedProfiles,
+    PooledMediaPlayers,
+    Num
+};
+
+/**
+ * Lock-free accumulators behind SPORTBEACON_SCOPE_CYCLE and the value macros.
+ * Timers only cost a cycle read while a recording is running, and may be hit
+ * from any thread (voice worker, image decode tasks).
+ */
+class SPORTBEACON_API FSportBeaconStats
+{
+public:
+    static constexpr int32 NumTimers = static_cast<int32>(ESportBeaconTimer::Num);
+    static constexpr int32 NumValues = static_cast<int32>(ESportBeaconValue::Num);
+
+    static bool IsRecording() { return bRecording.load(std::memory_order_relaxed); }
+    static void SetRecording(bool bEnabled);
+
+    static void AddCycles(ESportBeaconTimer Timer, uint64 Cycles)
+    {
+        TimerCycles[static_cast<int32>(Timer)].fetch_add(Cycles, std::memory_order_relaxed);
+    }
+
+    // Values are kept whether or not a recording runs, so the first recorded frame is already correct
+    static void SetValue(ESportBeaconValue Value, int64 NewValue)
+    {
+        Values[static_cast<int32>(Value)].store(NewValue, std::memory_order_relaxed);
+    }
+
+    static int64 GetValue(ESportBeaconValue Value)
+    {
+        return Values[static_cast<int32>(Value)].load(std::memory_order_relaxed);
+    }
+
+    // Milliseconds spent in each timer since the previous call, which clears them
+    static void ConsumeTimers(double* OutTimerMs);
+
+    static const TCHAR* GetTimerName(int32 TimerIndex);
+    static const TCHAR* GetValueName(int32 ValueIndex);
+
+private:
+    static std::atomic<bool> bRecording;
+    static std::atomic<uint64> TimerCycles[NumTimers];
+    static std::atomic<int64> Values[NumValues];
+};
+
+class FSportBeaconTimerScope
+{
+public:
+    explicit FSportBeaconTimerScope(ESportBeaconTimer InTimer)
+        : Timer(InTimer)
+        , StartCycles(FSportBeaconStats::IsRecording() ? FPlatformTime::Cycles64() : 0)
+    {}
+
+    ~FSportBeaconTimerScope()
+    {
+        if (StartCycles != 0)
+        {
+            FSportBeaconStats::AddCycles(Timer, FPlatformTime::Cycles64() - StartCycles);
+        }
+    }
+
+private:
+    ESportBeaconTimer Timer;
+    uint64 StartCycles;
+};
+
+// Stat system counter where STATS is on, an Insights CPU event where it is not,
+// and the recorder timer in every configuration
+#if STATS
+#define SPORTBEACON_SCOPE_CYCLE(Name) \
+    SCOPE_CYCLE_COUNTER(STAT_SportBeacon_##Name); \
+    FSportBeaconTimerScope PREPROCESSOR_JOIN(SportBeaconTimerScope_, __LINE__)(ESportBeaconTimer::Name)
+#else
+#define SPORTBEACON_SCOPE_CYCLE(Name) \
+    TRACE_CPUPROFILER_EVENT_SCOPE(SportBeacon_##Name); \
+    FSportBeaconTimerScope PREPROCESSOR_JOIN(SportBeaconTimerScope_, __LINE__)(ESportBeaconTimer::Name)
+#endif
+
+#define SPORTBEACON_SET_MEMORY(Name, Bytes) \
+    do \
+    { \
+        const int64 SportBeaconBytes = static_cast<int64>(Bytes); \
+        SET_MEMORY_STAT(STAT_SportBeacon_##Name, SportBeaconBytes); \
+        FSportBeaconStats::SetValue(ESportBeaconValue::Name, SportBeaconBytes); \
+    } while (0)
+
+#define SPORTBEACON_SET_COUNT(Name, Count) \
+    do \
+    { \
+        const int64 SportBeaconCount = static_cast<int64>(Count); \
+        SET_DWORD_STAT(STAT_SportBeacon_##Name, static_cast<uint32>(SportBeaconCount)); \
+        FSportBeaconStats::SetValue(ESportBeaconValue::Name, SportBeaconCount); \
+    } while (0)
@@ -0,0 +1,90 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+// Fixed-capacity FIFO for exactly one producer thread and one consumer
+// thread. Neither side locks or allocates, so the producer can be a
+// real-time callback. Elements are moved with memcpy.
+template <typename ElementType>
+class TSpscRingBuffer
+{
+    static_assert(TIsTriviallyCopyAssignable<ElementType>::Value, "TSpscRingBuffer copies elements with memcpy");
+
+public:
+    explicit TSpscRingBuffer(int32 MinCapacity = 0)
+    {
+        SetCapacity(MinCapacity);
+    }
+
+    // Rounds up to a power of two and drops the contents. Neither side may be running.
+    void SetCapacity(int32 MinCapacity)
+    {
+        const uint32 NewCapacity = MinCapacity > 0 ? FMath::RoundUpToPowerOfTwo(static_cast<uint32>(MinCapacity)) : 0;
+        Storage.Reset();
+        Storage.SetNumUninitialized(NewCapacity);
+        Mask = NewCapacity > 0 ? NewCapacity - 1 : 0;
+        WriteIndex.store(0, std::memory_order_relaxed);
+        ReadIndex.store(0, std::memory_order_relaxed);
+    }
+
+    int32 Capacity() const { return Storage.Num(); }
+
+    // Exact from either side for its own view, a snapshot otherwise
+    int32 Num() const
+    {
+        return static_cast<int32>(WriteIndex.load(std::memory_order_acquire) - ReadIndex.load(std::memory_order_acquire));
+    }
+
+    // Producer only. All or nothing, returns false and writes nothing if the items don't fit.
+    bool Write(const ElementType* Items, int32 NumItems)
+    {
+        const uint32 Written = WriteIndex.load(std::memory_order_relaxed);
+        const uint32 Consumed = ReadIndex.load(std::memory_order_acquire);
+        if (NumItems <= 0 || static_cast<uint32>(Storage.Num()) - (Written - Consumed) < static_cast<uint32>(NumItems))
+        {
+            return NumItems <= 0;
+        }
+
+        const uint32 Start = Written & Mask;
+        const int32 FirstSpan = FMath::Min(NumItems, static_cast<int32>(Storage.Num() - Start));
+        FMemory::Memcpy(&Storage[Start], Items, FirstSpan * sizeof(ElementType));
+        FMemory::Memcpy(Storage.GetData(), Items + FirstSpan, (NumItems - FirstSpan) * sizeof(ElementType));
+
+        WriteIndex.store(Written + NumItems, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer only. Moves up to MaxItems of the oldest elements out, returns how many.
+    int32 Read(ElementType* OutItems, int32 MaxItems)
+    {
+        const uint32 Consumed = ReadIndex.load(std::memory_order_relaxed);
+        const uint32 Written = WriteIndex.load(std::memory_order_acquire);
+        const int32 NumToRead = FMath::Min(MaxItems, static_cast<int32>(Written - Consumed));
+        if (NumToRead <= 0)
+        {
+            return 0;
+        }
+
+        const uint32 Start = Consumed & Mask;
+        const int32 FirstSpan = FMath::Min(NumToRead, static_cast<int32>(Storage.Num() - Start));
+        FMemory::Memcpy(OutItems, &Storage[Start], FirstSpan * sizeof(ElementType));
+        FMemory::Memcpy(OutItems + FirstSpan, Storage.GetData(), (NumToRead - FirstSpan) * sizeof(ElementType));
+
+        ReadIndex.store(Consumed + NumToRead, std::memory_order_release);
+        return NumToRead;
+    }
+
+    // Consumer only, throws away everything written so far
+    void Discard()
+    {
+        ReadIndex.store(WriteIndex.load(std::memory_order_acquire), std::memory_order_release);
+    }
+
+private:
+    TArray<ElementType> Storage;
+    uint32 Mask = 0;
+    // Free-running, wrapped with Mask on access
+    std::atomic<uint32> WriteIndex{0};
+    std::atomic<uint32> ReadIndex{0};
+};
@@ -0,0 +1,243 @@
+#include "StatsRecorderSubsystem.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "Async/Async.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/App.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "RenderCore.h"
+#include "RHI.h"
+#include "Serialization/JsonWriter.h"
+#include "UObject/UObjectArray.h"
+
+UStatsRecorderSubsystem* UStatsRecorderSubsystem::Get(const UObject* WorldContextObject)
+{
+    const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+    const UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+    return GameInstance ? GameInstance->GetSubsystem<UStatsRecorderSubsystem>() : nullptr;
+}
+
+void UStatsRecorderSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    MaxRecordedFrames = FMath::Max(MaxRecordedFrames, 1);
+
+    if (bRecordOnStartup)
+    {
+        StartRecording(ExportFormat);
+    }
+}
+
+void UStatsRecorderSubsystem::Deinitialize()
+{
+    // A capture still running is exported rather than lost
+    if (IsRecording())
+    {
+        StopRecording();
+    }
+
+    Super::Deinitialize();
+}
+
+void UStatsRecorderSubsystem::StartRecording(EStatsExportFormat Format)
+{
+    if (IsRecording())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+        TickerHandle.Reset();
+    }
+
+    // Allocated once per capture, recording itself never allocates
+    Frames.SetCapacity(MaxRecordedFrames);
+    RecordingFormat = Format;
+    RecordingStarted = FDateTime::UtcNow();
+
+    FSportBeaconStats::SetRecording(true);
+    TickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+        FTickerDelegate::CreateUObject(this, &UStatsRecorderSubsystem::RecordFrame));
+
+    UE_LOG(LogTemp, Log, TEXT("StatsRecorder: recording started, up to %d frames"), MaxRecordedFrames);
+}
+
+FString UStatsRecorderSubsystem::StopRecording()
+{
+    if (!IsRecording())
+    {
+        return FString();
+    }
+
+    FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+    TickerHandle.Reset();
+    FSportBeaconStats::SetRecording(false);
+
+    if (Frames.IsEmpty())
+    {
+        Frames.SetCapacity(0);
+        return FString();
+    }
+
+    TArray<FRecordedStatsFrame> Recorded;
+    Recorded.SetNumUninitialized(Frames.Num());
+    Frames.Read(Recorded.GetData(), Recorded.Num());
+    Frames.SetCapacity(0);
+
+    const bool bJson = RecordingFormat == EStatsExportFormat::Json;
+    const FString FilePath = FPaths::Combine(FPaths::ProjectSavedDir(), ExportDirectory,
+        FString::Printf(TEXT("SportBeaconStats_%s.%s"), *RecordingStarted.ToString(TEXT("%Y%m%d_%H%M%S")), bJson ? TEXT("json") : TEXT("csv")));
+
+    UE_LOG(LogTemp, Log, TEXT("StatsRecorder: exporting %d frames to %s"), Recorded.Num(), *FilePath);
+
+    // Formatting minutes of frames is too slow for the game thread
+    TWeakObjectPtr<UStatsRecorderSubsystem> WeakThis(this);
+    Async(EAsyncExecution::ThreadPool, [WeakThis, FilePath, bJson, Recorded = MoveTemp(Recorded)]()
+    {
+        const FString Contents = bJson ? FormatJson(Recorded) : FormatCsv(Recorded);
+
+        IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+        PlatformFile.CreateDirectoryTree(*FPaths::GetPath(FilePath));
+        const bool bSaved = FFileHelper::SaveStringToFile(Contents, *FilePath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+
+        if (!bSaved)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("StatsRecorder: failed to write %s"), *FilePath);
+        }
+
+        AsyncTask(ENamedThreads::GameThread, [WeakThis, FilePath, bSaved]()
+        {
+            if (UStatsRecorderSubsystem* StrongThis = WeakThis.Get())
+            {
+                StrongThis->OnStatsExported.Broadcast(FilePath, bSaved);
+            }
+        });
+    });
+
+    return FilePath;
+}
+
+void UStatsRecorderSubsystem::SetRecordingEnabled(bool bEnabled)
+{
+    if (bEnabled && !IsRecording())
+    {
+        StartRecording(ExportFormat);
+    }
+    else if (!bEnabled)
+    {
+        StopRecording();
+    }
+}
+
+bool UStatsRecorderSubsystem::RecordFrame(float DeltaTime)
+{
+    FRecordedStatsFrame Frame;
+    Frame.FrameNumber = GFrameCounter;
+    Frame.Time = FPlatformTime::Seconds() - GStartTime;
+    Frame.FrameMs = DeltaTime * 1000.0f;
+    // Thread times are published with a frame of latency, the same numbers stat unit shows
+    Frame.GameThreadMs = FPlatformTime::ToMilliseconds(GGameThreadTime);
+    Frame.RenderThreadMs = FPlatformTime::ToMilliseconds(GRenderThreadTime);
+    Frame.GPUMs = FPlatformTime::ToMilliseconds(RHIGetGPUFrameCycles());
+    Frame.UObjectCount = GUObjectArray.GetObjectArrayNumMinusAvailable();
+    Frame.UsedPhysicalBytes = FPlatformMemory::GetStats().UsedPhysical;
+
+    FSportBeaconStats::ConsumeTimers(Frame.TimerMs);
+    for (int32 Index = 0; Index < FSportBeaconStats::NumValues; ++Index)
+    {
+        Frame.Values[Index] = FSportBeaconStats::GetValue(static_cast<ESportBeaconValue>(Index));
+    }
+
+    Frames.Push(Frame);
+    return true;
+}
+
+FString UStatsRecorderSubsystem::FormatCsv(const TArray<FRecordedStatsFrame>& Frames)
+{
+    FString Out;
+    Out.Reserve(Frames.Num() * 256);
+
+    Out += TEXT("Frame,Time,FrameMs,GameThreadMs,RenderThreadMs,GPUMs,UObjects,UsedPhysicalBytes");
+    for (int32 Index = 0; Index < FSportBeaconStats::NumTimers; ++Index)
+    {
+        Out += TEXT(",");
+        Out += FSportBeaconStats::GetTimerName(Index);
+        Out += TEXT("Ms");
+    }
+    for (int32 Index = 0; Index < FSportBeaconStats::NumValues; ++Index)
+    {
+        Out += TEXT(",");
+        Out += FSportBeaconStats::GetValueName(Index);
+    }
+    Out += TEXT("\n");
+
+    for (const FRecordedStatsFrame& Frame : Frames)
+    {
+        Out += FString::Printf(TEXT("%llu,%.4f,%.3f,%.3f,%.3f,%.3f,%d,%llu"),
+            Frame.FrameNumber, Frame.Time, Frame.FrameMs, Frame.GameThreadMs, Frame.RenderThreadMs,
+            Frame.GPUMs, Frame.UObjectCount, Frame.UsedPhysicalBytes);
+
+        for (const double TimerMs : Frame.TimerMs)
+        {
+            Out += FString::Printf(TEXT(",%.3f"), TimerMs);
+        }
+        for (const int64 Value : Frame.Values)
+        {
+            Out += FString::Printf(TEXT(",%lld"), Value);
+        }
+        Out += TEXT("\n");
+    }
+
+    return Out;
+}
+
+FString UStatsRecorderSubsystem::FormatJson(const TArray<FRecordedStatsFrame>& Frames)
+{
+    FString Out;
+    Out.Reserve(Frames.Num() * 512);
+
+    TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer =
+        TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Out);
+
+    Writer->WriteObjectStart();
+    Writer->WriteValue(TEXT("platform"), FString(FPlatformProperties::IniPlatformName()));
+    Writer->WriteValue(TEXT("build_config"), FString(LexToString(FApp::GetBuildConfiguration())));
+    Writer->WriteValue(TEXT("build_version"), FString(FApp::GetBuildVersion()));
+    Writer->WriteValue(TEXT("device"), FPlatformMisc::GetDeviceMakeAndModel());
+
+    Writer->WriteArrayStart(TEXT("frames"));
+    for (const FRecordedStatsFrame& Frame : Frames)
+    {
+        Writer->WriteObjectStart();
+        Writer->WriteValue(TEXT("frame"), static_cast<int64>(Frame.FrameNumber));
+        Writer->WriteValue(TEXT("time"), Frame.Time);
+        Writer->WriteValue(TEXT("frame_ms"), Frame.FrameMs);
+        Writer->WriteValue(TEXT("game_thread_ms"), Frame.GameThreadMs);
+        Writer->WriteValue(TEXT("render_thread_ms"), Frame.RenderThreadMs);
+        Writer->WriteValue(TEXT("gpu_ms"), Frame.GPUMs);
+        Writer->WriteValue(TEXT("uobjects"), Frame.UObjectCount);
+        Writer->WriteValue(TEXT("used_physical_bytes"), static_cast<int64>(Frame.UsedPhysicalBytes));
+
+        Writer->WriteObjectStart(TEXT("timers_ms"));
+        for (int32 Index = 0; Index < FSportBeaconStats::NumTimers; ++Index)
+        {
+            Writer->WriteValue(FSportBeaconStats::GetTimerName(Index), Frame.TimerMs[Index]);
+        }
+        Writer->WriteObjectEnd();
+
+        Writer->WriteObjectStart(TEXT("values"));
+        for (int32 Index = 0; Index < FSportBeaconStats::NumValues; ++Index)
+        {
+            Writer->WriteValue(FSportBeaconStats::GetValueName(Index), Frame.Values[Index]);
+        }
+        Writer->WriteObjectEnd();
+
+        Writer->WriteObjectEnd();
+    }
+    Writer->WriteArrayEnd();
+
+    Writer->WriteObjectEnd();
+    Writer->Close();
+
+    return Out;
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "Containers/Ticker.h"
+#include "FixedRingBuffer.h"
+#include "SportBeaconStats.h"
+#include "StatsRecorderSubsystem.generated.h"
+
+UENUM(BlueprintType)
+enum class EStatsExportFormat : uint8
+{
+    Csv,
+    Json
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnStatsExported, const FString&, FilePath, bool, bSuccess);
+
+// One recorded frame, timers in milliseconds
+struct FRecordedStatsFrame
+{
+    uint64 FrameNumber = 0;
+    double Time = 0.0;
+    float FrameMs = 0.0f;
+    float GameThreadMs = 0.0f;
+    float RenderThreadMs = 0.0f;
+    float GPUMs = 0.0f;
+    int32 UObjectCount = 0;
+    uint64 UsedPhysicalBytes = 0;
+    double TimerMs[FSportBeaconStats::NumTimers] = {};
+    int64 Values[FSportBeaconStats::NumValues] = {};
+};
+
+/**
+ * Records the SportBeacon stat timers and values once per frame, alongside
+ * frame, game thread, render thread and GPU time, UObject count and memory,
+ * and writes them to Saved/Profiling as CSV or JSON. Works in shipping builds
+ * so captures can come from real devices.
+ */
+UCLASS(Config = Game)
+class SPORTBEACON_API UStatsRecorderSubsystem : public UGameInstanceSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    static UStatsRecorderSubsystem* Get(const UObject* WorldContextObject);
+
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    // Drops anything recorded before and starts a new capture
+    UFUNCTION(BlueprintCallable, Category = "Stats")
+    void StartRecording(EStatsExportFormat Format = EStatsExportFormat::Csv);
+
+    // Stops and exports the capture. Returns the file being written, empty if
+    // nothing was recorded. OnStatsExported fires when the file is on disk.
+    UFUNCTION(BlueprintCallable, Category = "Stats")
+    FString StopRecording();
+
+    // Starts with ExportFormat or stops and exports
+    UFUNCTION(BlueprintCallable, Category = "Stats")
+    void SetRecordingEnabled(bool bEnabled);
+
+    UFUNCTION(BlueprintPure, Category = "Stats")
+    bool IsRecording() const { return TickerHandle.IsValid(); }
+
+    UFUNCTION(BlueprintPure, Category = "Stats")
+    int32 GetRecordedFrameCount() const { return Frames.Num(); }
+
+    UPROPERTY(BlueprintAssignable, Category = "Stats")
+    FOnStatsExported OnStatsExported;
+
+    // Oldest frames are dropped past this, 18000 is five minutes at 60 fps
+    UPROPERTY(Config, EditAnywhere, Category = "Stats")
+    int32 MaxRecordedFrames = 18000;
+
+    UPROPERTY(Config, EditAnywhere, BlueprintReadWrite, Category = "Stats")
+    EStatsExportFormat ExportFormat = EStatsExportFormat::Csv;
+
+    // Recording starts with the game instance, for captures from devices without a debug UI
+    UPROPERTY(Config, EditAnywhere, Category = "Stats")
+    bool bRecordOnStartup = false;
+
+    // Under the project Saved directory
+    UPROPERTY(Config, EditAnywhere, Category = "Stats")
+    FString ExportDirectory = TEXT("Profiling");
+
+private:
+    bool RecordFrame(float DeltaTime);
+
+    static FString FormatCsv(const TArray<FRecordedStatsFrame>& Frames);
+    static FString FormatJson(const TArray<FRecordedStatsFrame>& Frames);
+
+    TFixedRingBuffer<FRecordedStatsFrame> Frames;
+    FTSTicker::FDelegateHandle TickerHandle;
+    EStatsExportFormat RecordingFormat = EStatsExportFormat::Csv;
+    FDateTime RecordingStarted;
+};
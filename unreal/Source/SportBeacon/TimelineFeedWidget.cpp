@@ -1,10 +1,35 @@
 #include "TimelineFeedWidget.h"
 #include "Blueprint/WidgetTree.h"
+#include "Components/CanvasPanel.h"
+#include "Components/CanvasPanelSlot.h"
+#include "Components/SizeBox.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
+#include "MediaClipSubsystem.h"
+#include "SportBeaconStats.h"
+
+namespace
+{
+    // Rows materialized before the scroll box has been laid out once
+    constexpr int32 InitialVisibleEntries = 8;
+}
 
 UTimelineFeedWidget::UTimelineFeedWidget(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
+    , TotalEntriesAdded(0)
+    , RowContainer(nullptr)
+    , RowCanvas(nullptr)
+    , VisibleFirstSequence(0)
+    , PositionedOldestSequence(-1)
+    , LastBoundSequence(-1)
+    , VisibleCount(0)
+    , LastScrollOffset(-1.0f)
+    , LastViewportHeight(-1.0f)
 {
     MaxEntries = 50; // Default max entries
+    bVirtualizeEntries = false;
+    EntryHeight = 96.0f;
+    OverscanEntries = 2;
 }
 
 void UTimelineFeedWidget::NativeConstruct()
@@ -23,6 +48,35 @@ void UTimelineFeedWidget::NativeConstruct()
     }
 }
 
+void UTimelineFeedWidget::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
+{
+    Super::NativeTick(MyGeometry, InDeltaTime);
+
+    // Covers user scrolling, ScrollToEnd and resizes with a couple of float compares
+    if (bVirtualizeEntries && FeedScrollBox && !EntryData.IsEmpty())
+    {
+        const float ScrollOffset = FeedScrollBox->GetScrollOffset();
+        const float ViewportHeight = FeedScrollBox->GetCachedGeometry().GetLocalSize().Y;
+        if (ScrollOffset != LastScrollOffset || ViewportHeight != LastViewportHeight)
+        {
+            RefreshVisibleEntries(false);
+        }
+    }
+}
+
+void UTimelineFeedWidget::AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector)
+{
+    UTimelineFeedWidget* This = CastChecked<UTimelineFeedWidget>(InThis);
+    for (int32 Index = 0; Index < This->EntryData.Num(); ++Index)
+    {
+        FFeedEntry& Entry = This->EntryData[Index];
+        Collector.AddReferencedObject(Entry.Icon, This);
+        Collector.AddReferencedObject(Entry.BadgeData.Icon, This);
+    }
+
+    Super::AddReferencedObjects(InThis, Collector);
+}
+
 void UTimelineFeedWidget::AddFeedEntry(const FFeedEntry& Entry)
 {
     if (!FeedScrollBox)
@@ -31,22 +85,102 @@ void UTimelineFeedWidget::AddFeedEntry(const FFeedEntry& Entry)
         return;
     }
 
-    // Create and add the entry widget
-    UUserWidget* EntryWidget = CreateFeedEntryWidget(Entry);
-    if (EntryWidget)
+    PendingEntries.Add(Entry);
+    ScheduleFlush();
+}
+
+void UTimelineFeedWidget::AddFeedEntries(const TArray<FFeedEntry>& Entries)
+{
+    if (!FeedScrollBox)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("TimelineFeedWidget: FeedScrollBox not found!"));
+        return;
+    }
+
+    PendingEntries.Append(Entries);
+    ScheduleFlush();
+}
+
+void UTimelineFeedWidget::ScheduleFlush()
+{
+    UWorld* World = GetWorld();
+    if (!World)
+    {
+        FlushPendingEntries();
+        return;
+    }
+
+    // One timer per frame no matter how many entries arrive
+    if (!FlushTimerHandle.IsValid())
+    {
+        FlushTimerHandle = World->GetTimerManager().SetTimerForNextTick(this, &UTimelineFeedWidget::FlushPendingEntries);
+    }
+}
+
+void UTimelineFeedWidget::FlushPendingEntries()
+{
+    SPORTBEACON_SCOPE_CYCLE(FeedFlush);
+    FlushTimerHandle.Invalidate();
+
+    if (PendingEntries.Num() == 0 || !FeedScrollBox)
+    {
+        return;
+    }
+
+    TArray<FFeedEntry> Entries = MoveTemp(PendingEntries);
+    PendingEntries.Reset();
+
+    // Entries that would be trimmed within this same batch never get a widget
+    const int32 FirstKept = FMath::Max(Entries.Num() - FMath::Max(MaxEntries, 1), 0);
+
+    if (bVirtualizeEntries)
+    {
+        for (int32 Index = FirstKept; Index < Entries.Num(); ++Index)
+        {
+            PushVirtualizedEntry(Entries[Index]);
+        }
+        RefreshVisibleEntries(true);
+    }
+    else
     {
-        FeedScrollBox->AddChild(EntryWidget);
-        FeedEntries.Add(EntryWidget);
+        for (int32 Index = FirstKept; Index < Entries.Num(); ++Index)
+        {
+            // Create and add the entry widget
+            if (UUserWidget* EntryWidget = CreateFeedEntryWidget(Entries[Index]))
+            {
+                FeedScrollBox->AddChild(EntryWidget);
+                FeedEntries.Add(EntryWidget);
+            }
+        }
 
         // Trim old entries if needed
         TrimOldEntries();
 
-        // Scroll to the new entry
-        ScrollToLatest();
+        // The feed scrolls to these next, so their clips are the likeliest taps, newest first
+        if (UMediaClipSubsystem* MediaClips = UMediaClipSubsystem::Get(this))
+        {
+            TArray<FString> ClipURLs;
+            for (int32 Index = Entries.Num() - 1; Index >= FirstKept; --Index)
+            {
+                if (!Entries[Index].MediaUrl.IsEmpty())
+                {
+                    ClipURLs.Add(Entries[Index].MediaUrl);
+                }
+            }
+            MediaClips->PrefetchClips(ClipURLs);
+        }
+    }
+
+    // Scroll to the new entries
+    ScrollToLatest();
 
-        // Notify blueprints
+    // Notify blueprints, every entry still gets its event
+    for (const FFeedEntry& Entry : Entries)
+    {
         OnNewEntryAdded(Entry);
     }
+
+    SPORTBEACON_SET_COUNT(FeedEntries, bVirtualizeEntries ? EntryData.Num() : FeedEntries.Num());
 }
 
 void UTimelineFeedWidget::AddBadgeEntry(const FBadgeData& BadgeData)
@@ -71,19 +205,31 @@ void UTimelineFeedWidget::AddBadgeEntry(const FBadgeData& BadgeData)
 
 void UTimelineFeedWidget::ClearFeed()
 {
+    PendingEntries.Reset();
+
     if (FeedScrollBox)
     {
+        ReleaseActiveEntries();
         FeedScrollBox->ClearChildren();
         FeedEntries.Empty();
     }
+
+    EntryData.Reset();
+    VisibleCount = 0;
+    LastScrollOffset = -1.0f;
+
+    SPORTBEACON_SET_COUNT(FeedEntries, 0);
 }
 
-UUserWidget* UTimelineFeedWidget::CreateFeedEntryWidget(const FFeedEntry& Entry)
+TSubclassOf<UUserWidget> UTimelineFeedWidget::GetEntryWidgetClass(const FFeedEntry& Entry) const
 {
     // Choose widget class based on entry type
-    TSubclassOf<UUserWidget> WidgetClass = Entry.EntryType == TEXT("badge") ? 
-        BadgeEntryClass : DefaultFeedEntryClass;
+    return Entry.EntryType == TEXT("badge") ? TSubclassOf<UUserWidget>(BadgeEntryClass) : DefaultFeedEntryClass;
+}
 
+UUserWidget* UTimelineFeedWidget::CreateFeedEntryWidget(const FFeedEntry& Entry)
+{
+    TSubclassOf<UUserWidget> WidgetClass = GetEntryWidgetClass(Entry);
     if (!WidgetClass)
     {
         UE_LOG(LogTemp, Warning, TEXT("TimelineFeedWidget: No widget class for type %s"), *Entry.EntryType);
@@ -92,39 +238,93 @@ UUserWidget* UTimelineFeedWidget::CreateFeedEntryWidget(const FFeedEntry& Entry)
 
     // Create the widget
     UUserWidget* EntryWidget = CreateWidget<UUserWidget>(this, WidgetClass);
-    
-    if (Entry.EntryType == TEXT("badge"))
+    BindFeedEntryWidget(EntryWidget, Entry, true);
+
+    return EntryWidget;
+}
+
+void UTimelineFeedWidget::BindFeedEntryWidget(UUserWidget* EntryWidget, const FFeedEntry& Entry, bool bIsNewEntry)
+{
+    if (!EntryWidget)
+    {
+        return;
+    }
+
+    const FFeedEntryBinding& Binding = ResolveFeedEntryBinding(EntryWidget);
+
+    if (Binding.bNative)
+    {
+        static_cast<IFeedEntryWidget*>(EntryWidget->GetNativeInterfaceAddress(UFeedEntryWidget::StaticClass()))->BindFeedEntry(Entry, bIsNewEntry);
+    }
+
+    if (!Binding.BlueprintFunction)
+    {
+        return;
+    }
+
+    if (Binding.bLegacySetupEntry)
     {
-        // Set up badge widget
-        UBadgeRewardWidget* BadgeWidget = Cast<UBadgeRewardWidget>(EntryWidget);
-        if (BadgeWidget)
+        // Set up default feed entry (implement in BP)
+        struct
         {
-            BadgeWidget->DisplayEarnedBadge(Entry.BadgeData);
-        }
+            FString Title;
+            FString Subtitle;
+            UTexture2D* Icon;
+            FDateTime Timestamp;
+        } Params;
+
+        Params.Title = Entry.Title;
+        Params.Subtitle = Entry.Subtitle;
+        Params.Icon = Entry.Icon;
+        Params.Timestamp = Entry.Timestamp;
+
+        EntryWidget->ProcessEvent(Binding.BlueprintFunction, &Params);
     }
     else
     {
-        // Set up default feed entry (implement in BP)
-        if (UFunction* SetupFunc = EntryWidget->FindFunction(TEXT("SetupEntry")))
+        // Same layout UHT generates for OnBindFeedEntry
+        struct
         {
-            struct
-            {
-                FString Title;
-                FString Subtitle;
-                UTexture2D* Icon;
-                FDateTime Timestamp;
-            } Params;
-
-            Params.Title = Entry.Title;
-            Params.Subtitle = Entry.Subtitle;
-            Params.Icon = Entry.Icon;
-            Params.Timestamp = Entry.Timestamp;
-
-            EntryWidget->ProcessEvent(SetupFunc, &Params);
+            FFeedEntry Entry;
+            bool bIsNewEntry;
+        } Params;
+
+        Params.Entry = Entry;
+        Params.bIsNewEntry = bIsNewEntry;
+
+        EntryWidget->ProcessEvent(Binding.BlueprintFunction, &Params);
+    }
+}
+
+const UTimelineFeedWidget::FFeedEntryBinding& UTimelineFeedWidget::ResolveFeedEntryBinding(UUserWidget* EntryWidget)
+{
+    UClass* WidgetClass = EntryWidget->GetClass();
+    if (const FFeedEntryBinding* Cached = FeedEntryBindings.Find(WidgetClass))
+    {
+        return *Cached;
+    }
+
+    FFeedEntryBinding& Binding = FeedEntryBindings.Add(WidgetClass);
+
+    if (WidgetClass->ImplementsInterface(UFeedEntryWidget::StaticClass()))
+    {
+        Binding.bNative = EntryWidget->GetNativeInterfaceAddress(UFeedEntryWidget::StaticClass()) != nullptr;
+
+        // Only worth a ProcessEvent when a Blueprint actually implements the event
+        UFunction* Event = WidgetClass->FindFunctionByName(GET_FUNCTION_NAME_CHECKED(IFeedEntryWidget, OnBindFeedEntry));
+        if (Event && Event->Script.Num() > 0)
+        {
+            Binding.BlueprintFunction = Event;
         }
     }
+    else
+    {
+        // Widgets from before the interface existed
+        Binding.BlueprintFunction = WidgetClass->FindFunctionByName(TEXT("SetupEntry"));
+        Binding.bLegacySetupEntry = Binding.BlueprintFunction != nullptr;
+    }
 
-    return EntryWidget;
+    return Binding;
 }
 
 void UTimelineFeedWidget::TrimOldEntries()
@@ -147,10 +347,186 @@ void UTimelineFeedWidget::ScrollToLatest()
 {
     if (FeedScrollBox)
     {
-        // Use a timer to ensure the scroll happens after layout
-        GetWorld()->GetTimerManager().SetTimerForNextTick([this]()
+        // The scroll box applies this on its own next layout, so no extra timer is needed
+        FeedScrollBox->ScrollToEnd();
+    }
+}
+
+void UTimelineFeedWidget::PushVirtualizedEntry(const FFeedEntry& Entry)
+{
+    // Capacity follows MaxEntries. The newest entries are kept, and rows are keyed by
+    // sequence, so the ones still on screen stay bound.
+    EntryData.Resize(FMath::Max(MaxEntries, 1));
+
+    // Overwrites the oldest entry once full, so trimming is free
+    EntryData.Push(Entry);
+    ++TotalEntriesAdded;
+}
+
+bool UTimelineFeedWidget::EnsureRowContainer()
+{
+    // Built on first use so turning virtualization on after construct still works
+    if (!RowContainer && WidgetTree)
+    {
+        RowContainer = WidgetTree->ConstructWidget<USizeBox>(USizeBox::StaticClass());
+        RowCanvas = WidgetTree->ConstructWidget<UCanvasPanel>(UCanvasPanel::StaticClass());
+        RowContainer->SetContent(RowCanvas);
+    }
+    return RowContainer != nullptr;
+}
+
+void UTimelineFeedWidget::RefreshVisibleEntries(bool bForce)
+{
+    SPORTBEACON_SCOPE_CYCLE(FeedLayout);
+
+    if (!FeedScrollBox || !EnsureRowContainer())
+    {
+        return;
+    }
+
+    const float RowHeight = FMath::Max(EntryHeight, 1.0f);
+    const float ScrollOffset = FeedScrollBox->GetScrollOffset();
+    const float ViewportHeight = FeedScrollBox->GetCachedGeometry().GetLocalSize().Y;
+    LastScrollOffset = ScrollOffset;
+    LastViewportHeight = ViewportHeight;
+
+    const int32 NumEntries = EntryData.Num();
+    const int64 OldestSequence = TotalEntriesAdded - NumEntries;
+    const int32 RowsOnScreen = ViewportHeight > 0.0f ? FMath::CeilToInt(ViewportHeight / RowHeight) + 1 : InitialVisibleEntries;
+
+    int32 First = FMath::Clamp(FMath::FloorToInt(ScrollOffset / RowHeight) - OverscanEntries, 0, NumEntries);
+    const int32 Last = FMath::Min(First + RowsOnScreen + 2 * OverscanEntries, NumEntries);
+
+    // Near the end the window would shrink, pull it back so the last rows are always covered
+    First = FMath::Max(FMath::Min(First, Last - RowsOnScreen - 2 * OverscanEntries), 0);
+
+    if (!bForce && OldestSequence + First == VisibleFirstSequence && Last - First == VisibleCount)
+    {
+        return;
+    }
+
+    // Hand widgets that scrolled out back to their pools, keep the rest bound where they are
+    const int64 FirstSequence = OldestSequence + First;
+    const int64 LastSequence = OldestSequence + Last;
+    const bool bReposition = OldestSequence != PositionedOldestSequence;
+
+    TMap<int64, UUserWidget*> KeptWidgets;
+    KeptWidgets.Reserve(ActiveEntries.Num());
+    for (int32 ActiveIndex = ActiveEntries.Num() - 1; ActiveIndex >= 0; --ActiveIndex)
+    {
+        const FActiveFeedEntry& Active = ActiveEntries[ActiveIndex];
+        if (Active.Sequence >= FirstSequence && Active.Sequence < LastSequence)
         {
-            FeedScrollBox->ScrollToEnd();
-        });
+            KeptWidgets.Add(Active.Sequence, Active.Widget);
+        }
+        else
+        {
+            ReleaseEntryWidget(Active.Widget);
+            ActiveEntries.RemoveAtSwap(ActiveIndex, 1, false);
+        }
     }
-} 
\ No newline at end of file
+
+    // ClearFeed empties the scroll box, the container goes back in on the next refresh
+    if (RowContainer->GetParent() != FeedScrollBox)
+    {
+        FeedScrollBox->ClearChildren();
+        FeedScrollBox->AddChild(RowContainer);
+    }
+    RowContainer->SetHeightOverride(NumEntries * RowHeight);
+
+    auto PlaceRow = [RowHeight](UUserWidget* EntryWidget, int32 Index)
+    {
+        if (UCanvasPanelSlot* RowSlot = Cast<UCanvasPanelSlot>(EntryWidget->Slot))
+        {
+            // Full width, fixed height, top edge at the row's index
+            RowSlot->SetAnchors(FAnchors(0.0f, 0.0f, 1.0f, 0.0f));
+            RowSlot->SetAlignment(FVector2D::ZeroVector);
+            RowSlot->SetOffsets(FMargin(0.0f, Index * RowHeight, 0.0f, RowHeight));
+        }
+    };
+
+    for (int32 Index = First; Index < Last; ++Index)
+    {
+        const int64 Sequence = OldestSequence + Index;
+
+        if (UUserWidget** Kept = KeptWidgets.Find(Sequence))
+        {
+            // Only moves when old entries dropped off the front of the buffer
+            if (bReposition)
+            {
+                PlaceRow(*Kept, Index);
+            }
+            continue;
+        }
+
+        const FFeedEntry& Entry = EntryData[Index];
+        UUserWidget* EntryWidget = AcquireEntryWidget(GetEntryWidgetClass(Entry));
+        BindFeedEntryWidget(EntryWidget, Entry, Sequence > LastBoundSequence);
+        LastBoundSequence = FMath::Max(LastBoundSequence, Sequence);
+
+        if (EntryWidget)
+        {
+            RowCanvas->AddChildToCanvas(EntryWidget);
+            PlaceRow(EntryWidget, Index);
+
+            FActiveFeedEntry& Active = ActiveEntries.AddDefaulted_GetRef();
+            Active.Sequence = Sequence;
+            Active.Widget = EntryWidget;
+        }
+    }
+
+    PositionedOldestSequence = OldestSequence;
+    VisibleFirstSequence = FirstSequence;
+    VisibleCount = Last - First;
+
+    // Clips on screen are the likeliest next taps, nearest the top first
+    if (UMediaClipSubsystem* MediaClips = UMediaClipSubsystem::Get(this))
+    {
+        TArray<FString> ClipURLs;
+        for (int32 Index = First; Index < Last; ++Index)
+        {
+            if (!EntryData[Index].MediaUrl.IsEmpty())
+            {
+                ClipURLs.Add(EntryData[Index].MediaUrl);
+            }
+        }
+        MediaClips->PrefetchClips(ClipURLs);
+    }
+}
+
+UUserWidget* UTimelineFeedWidget::AcquireEntryWidget(TSubclassOf<UUserWidget> WidgetClass)
+{
+    if (!WidgetClass)
+    {
+        return nullptr;
+    }
+
+    if (FFeedWidgetPool* Pool = WidgetPools.Find(WidgetClass.Get()))
+    {
+        if (Pool->Widgets.Num() > 0)
+        {
+            return Pool->Widgets.Pop(false);
+        }
+    }
+
+    return CreateWidget<UUserWidget>(this, WidgetClass);
+}
+
+void UTimelineFeedWidget::ReleaseEntryWidget(UUserWidget* EntryWidget)
+{
+    if (EntryWidget)
+    {
+        EntryWidget->RemoveFromParent();
+        WidgetPools.FindOrAdd(EntryWidget->GetClass()).Widgets.Add(EntryWidget);
+    }
+}
+
+void UTimelineFeedWidget::ReleaseActiveEntries()
+{
+    for (const FActiveFeedEntry& Active : ActiveEntries)
+    {
+        ReleaseEntryWidget(Active.Widget);
+    }
+    ActiveEntries.Reset();
+    VisibleCount = 0;
+}
@@ -5,30 +5,34 @@
 #include "Components/VerticalBox.h"
 #include "Components/ScrollBox.h"
 #include "BadgeRewardWidget.h"
+#include "FeedEntryWidget.h"
+#include "FixedRingBuffer.h"
 #include "TimelineFeedWidget.generated.h"
 
-USTRUCT(BlueprintType)
-struct FFeedEntry
+class USizeBox;
+class UCanvasPanel;
+
+// Idle entry widgets of one class, kept for the virtualized list to reuse
+USTRUCT()
+struct FFeedWidgetPool
 {
     GENERATED_BODY()
 
-    UPROPERTY(EditAnywhere, BlueprintReadWrite)
-    FString Title;
-
-    UPROPERTY(EditAnywhere, BlueprintReadWrite)
-    FString Subtitle;
-
-    UPROPERTY(EditAnywhere, BlueprintReadWrite)
-    UTexture2D* Icon;
+    UPROPERTY()
+    TArray<UUserWidget*> Widgets;
+};
 
-    UPROPERTY(EditAnywhere, BlueprintReadWrite)
-    FDateTime Timestamp;
+// Entry widget currently materialized in the virtualized list
+USTRUCT()
+struct FActiveFeedEntry
+{
+    GENERATED_BODY()
 
-    UPROPERTY(EditAnywhere, BlueprintReadWrite)
-    FString EntryType;  // "badge", "highlight", "stat", etc.
+    // Monotonic id of the entry it shows, survives the ring buffer wrapping
+    int64 Sequence = 0;
 
-    UPROPERTY(EditAnywhere, BlueprintReadWrite)
-    FBadgeData BadgeData;  // Optional, only for badge entries
+    UPROPERTY()
+    UUserWidget* Widget = nullptr;
 };
 
 UCLASS()
@@ -40,13 +44,26 @@ public:
     UTimelineFeedWidget(const FObjectInitializer& ObjectInitializer);
 
     virtual void NativeConstruct() override;
+    virtual void NativeTick(const FGeometry& MyGeometry, float InDeltaTime) override;
+
+    // Entries in the virtualized ring buffer hold textures the GC cannot see otherwise
+    static void AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector);
 
     UFUNCTION(BlueprintCallable, Category = "Timeline")
     void AddFeedEntry(const FFeedEntry& Entry);
 
+    // Entries added in one frame are applied together on the next tick,
+    // so a burst costs one trim, one scroll and one layout pass
+    UFUNCTION(BlueprintCallable, Category = "Timeline")
+    void AddFeedEntries(const TArray<FFeedEntry>& Entries);
+
     UFUNCTION(BlueprintCallable, Category = "Timeline")
     void AddBadgeEntry(const FBadgeData& BadgeData);
 
+    // Applies queued entries now instead of waiting for the next tick
+    UFUNCTION(BlueprintCallable, Category = "Timeline")
+    void FlushPendingEntries();
+
     UFUNCTION(BlueprintCallable, Category = "Timeline")
     void ClearFeed();
 
@@ -66,11 +83,79 @@ protected:
     UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Timeline")
     int32 MaxEntries;
 
+    // Keep entries as data and only create widgets for the rows on screen, recycled per entry class
+    UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Timeline|Virtualization")
+    bool bVirtualizeEntries;
+
+    // Row height in slate units, entry widgets are expected to match it
+    UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Timeline|Virtualization", meta = (EditCondition = "bVirtualizeEntries"))
+    float EntryHeight;
+
+    // Extra rows kept alive above and below the viewport so short scrolls do not rebind
+    UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Timeline|Virtualization", meta = (EditCondition = "bVirtualizeEntries"))
+    int32 OverscanEntries;
+
 private:
     UPROPERTY()
     TArray<UUserWidget*> FeedEntries;
 
+    // Queued by AddFeedEntry/AddFeedEntries until the next tick
+    UPROPERTY()
+    TArray<FFeedEntry> PendingEntries;
+
+    FTimerHandle FlushTimerHandle;
+    void ScheduleFlush();
+
     void TrimOldEntries();
     void ScrollToLatest();
     UUserWidget* CreateFeedEntryWidget(const FFeedEntry& Entry);
+    TSubclassOf<UUserWidget> GetEntryWidgetClass(const FFeedEntry& Entry) const;
+    void BindFeedEntryWidget(UUserWidget* EntryWidget, const FFeedEntry& Entry, bool bIsNewEntry);
+
+    // How a widget class takes its entry, resolved once per class instead of per entry
+    struct FFeedEntryBinding
+    {
+        // Native IFeedEntryWidget, called through the vtable
+        bool bNative = false;
+        // Blueprint OnBindFeedEntry, or the legacy SetupEntry for widgets without the interface
+        UFunction* BlueprintFunction = nullptr;
+        bool bLegacySetupEntry = false;
+    };
+
+    const FFeedEntryBinding& ResolveFeedEntryBinding(UUserWidget* EntryWidget);
+    TMap<TWeakObjectPtr<UClass>, FFeedEntryBinding> FeedEntryBindings;
+
+    // Virtualized list state, oldest entry at index 0
+    TFixedRingBuffer<FFeedEntry> EntryData;
+    int64 TotalEntriesAdded;
+
+    UPROPERTY()
+    TArray<FActiveFeedEntry> ActiveEntries;
+
+    UPROPERTY()
+    TMap<UClass*, FFeedWidgetPool> WidgetPools;
+
+    // Sized to the whole list so the scroll range is right, rows sit on the canvas at
+    // their index. Rows entering or leaving the window are the only children touched.
+    UPROPERTY()
+    USizeBox* RowContainer;
+
+    UPROPERTY()
+    UCanvasPanel* RowCanvas;
+
+    int64 VisibleFirstSequence;
+    // Oldest sequence the active rows were positioned against, rows move when it changes
+    int64 PositionedOldestSequence;
+    // Highest sequence bound so far, anything above it is shown as new
+    int64 LastBoundSequence;
+    int32 VisibleCount;
+    float LastScrollOffset;
+    float LastViewportHeight;
+
+    void PushVirtualizedEntry(const FFeedEntry& Entry);
+    bool EnsureRowContainer();
+    void RefreshVisibleEntries(bool bForce);
+    UUserWidget* AcquireEntryWidget(TSubclassOf<UUserWidget> WidgetClass);
+    void ReleaseEntryWidget(UUserWidget* EntryWidget);
+    void ReleaseActiveEntries();
 }; 
\ No newline at end of file
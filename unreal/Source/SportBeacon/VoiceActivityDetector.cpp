@@ -0,0 +1,99 @@
+#include "VoiceActivityDetector.h"
+#include "Math/VectorRegister.h"
+
+void FVoiceActivityDetector::Configure(const FSettings& InSettings)
+{
+    Settings = InSettings;
+    Settings.OnsetFrames = FMath::Max(Settings.OnsetFrames, 1);
+    Settings.HangoverFrames = FMath::Max(Settings.HangoverFrames, 1);
+}
+
+void FVoiceActivityDetector::Reset()
+{
+    bInSpeech = false;
+    VoicedRun = 0;
+    UnvoicedRun = 0;
+}
+
+FVoiceActivityDetector::FFrameResult FVoiceActivityDetector::ProcessFrame(const float* Samples, int32 NumSamples)
+{
+    FFrameResult Result;
+
+    float MeanSquare = 0.0f;
+    Analyze(Samples, NumSamples, MeanSquare, Result.ZeroCrossingRate);
+    Result.Level = MeanSquareToLevel(MeanSquare);
+    Result.bVoiced = Result.Level >= Settings.SpeechLevel && Result.ZeroCrossingRate <= Settings.MaxZeroCrossingRate;
+
+    if (Result.bVoiced)
+    {
+        ++VoicedRun;
+        UnvoicedRun = 0;
+        if (!bInSpeech && VoicedRun >= Settings.OnsetFrames)
+        {
+            bInSpeech = true;
+            Result.Event = EEvent::SpeechStarted;
+        }
+    }
+    else
+    {
+        ++UnvoicedRun;
+        VoicedRun = 0;
+        if (bInSpeech && UnvoicedRun >= Settings.HangoverFrames)
+        {
+            bInSpeech = false;
+            Result.Event = EEvent::SpeechEnded;
+        }
+    }
+
+    return Result;
+}
+
+void FVoiceActivityDetector::Analyze(const float* Samples, int32 NumSamples, float& OutMeanSquare, float& OutZeroCrossingRate)
+{
+    OutMeanSquare = 0.0f;
+    OutZeroCrossingRate = 0.0f;
+    if (!Samples || NumSamples <= 0)
+    {
+        return;
+    }
+
+    // A crossing is a negative product of a sample and its successor, exact zeros don't count
+    const VectorRegister4Float Zero = VectorZeroFloat();
+    VectorRegister4Float SumSquares = VectorZeroFloat();
+    int32 Crossings = 0;
+
+    int32 Index = 0;
+    for (; Index + 4 < NumSamples; Index += 4)
+    {
+        const VectorRegister4Float Current = VectorLoad(Samples + Index);
+        const VectorRegister4Float Next = VectorLoad(Samples + Index + 1);
+
+        SumSquares = VectorMultiplyAdd(Current, Current, SumSquares);
+        Crossings += FPlatformMath::CountBits(VectorMaskBits(VectorCompareLT(VectorMultiply(Current, Next), Zero)));
+    }
+
+    alignas(16) float Lanes[4];
+    VectorStoreAligned(SumSquares, Lanes);
+    float Sum = Lanes[0] + Lanes[1] + Lanes[2] + Lanes[3];
+
+    for (; Index < NumSamples; ++Index)
+    {
+        Sum += Samples[Index] * Samples[Index];
+        if (Index + 1 < NumSamples && Samples[Index] * Samples[Index + 1] < 0.0f)
+        {
+            ++Crossings;
+        }
+    }
+
+    OutMeanSquare = Sum / NumSamples;
+    OutZeroCrossingRate = NumSamples > 1 ? static_cast<float>(Crossings) / (NumSamples - 1) : 0.0f;
+}
+
+float FVoiceActivityDetector::MeanSquareToLevel(float MeanSquare)
+{
+    // 10 * log10 of the mean square is the RMS in dB without the square root
+    const float DB = MeanSquare > UE_SMALL_NUMBER ? 10.0f * FMath::LogX(10.0f, MeanSquare) : -60.0f;
+
+    // Normalize to 0-1 range
+    return FMath::GetMappedRangeValueClamped(FVector2D(-60.0f, 0.0f), FVector2D(0.0f, 1.0f), DB);
+}
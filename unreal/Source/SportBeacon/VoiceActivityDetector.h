@@ -0,0 +1,53 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Per-frame speech/silence classification from short-term energy and
+// zero-crossing rate. Onset and hangover runs smooth the decision so a
+// single noisy frame neither opens nor closes an utterance.
+class SPORTBEACON_API FVoiceActivityDetector
+{
+public:
+    enum class EEvent : uint8
+    {
+        None,
+        SpeechStarted,
+        SpeechEnded
+    };
+
+    struct FSettings
+    {
+        // Normalized level (-60..0 dB mapped to 0..1) a frame needs to count as voiced
+        float SpeechLevel = 0.1f;
+        // Share of adjacent samples changing sign above which a loud frame is taken as noise or hiss
+        float MaxZeroCrossingRate = 0.5f;
+        // Voiced frames in a row that open an utterance
+        int32 OnsetFrames = 2;
+        // Unvoiced frames in a row that close it
+        int32 HangoverFrames = 30;
+    };
+
+    struct FFrameResult
+    {
+        float Level = 0.0f;
+        float ZeroCrossingRate = 0.0f;
+        bool bVoiced = false;
+        EEvent Event = EEvent::None;
+    };
+
+    void Configure(const FSettings& InSettings);
+    void Reset();
+
+    FFrameResult ProcessFrame(const float* Samples, int32 NumSamples);
+    bool IsInSpeech() const { return bInSpeech; }
+
+    // Mean square and zero-crossing rate in one pass, four samples at a time
+    static void Analyze(const float* Samples, int32 NumSamples, float& OutMeanSquare, float& OutZeroCrossingRate);
+    static float MeanSquareToLevel(float MeanSquare);
+
+private:
+    FSettings Settings;
+    bool bInSpeech = false;
+    int32 VoicedRun = 0;
+    int32 UnvoicedRun = 0;
+};
@@ -1,23 +1,126 @@
 #include "VoiceInputManager.h"
+#include "SportBeaconStats.h"
 #include "WebSocketsModule.h"
 #include "IWebSocket.h"
 #include "AudioDevice.h"
 #include "Components/AudioComponent.h"
-#include "Sound/AudioCaptureComponent.h"
-#include "JsonObjectConverter.h"
+#include "AudioCapture.h"
+#include "HAL/Runnable.h"
+#include "HAL/RunnableThread.h"
+#include "HAL/Event.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/MemoryWriter.h"
 #include "Misc/Base64.h"
 #include "Misc/ConfigCacheIni.h"
+#include "VoiceModule.h"
+#include "Interfaces/VoiceCodec.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/PlayerState.h"
+#include "Async/Async.h"
+
+namespace
+{
+    const TCHAR* GetCodecName(EVoiceAudioCodec Codec)
+    {
+        return Codec == EVoiceAudioCodec::UEVoiceOpus ? TEXT("ue_voice_opus") : TEXT("pcm16");
+    }
+
+    // The engine's Opus voice encoder only consumes whole 20 ms frames, and Opus caps a packet at 60 ms
+    constexpr int32 EncoderFrameMs = 20;
+
+    int32 SnapFrameDurationMs(int32 DurationMs)
+    {
+        static const int32 ValidDurations[] = { 20, 40, 60 };
+
+        int32 Best = ValidDurations[0];
+        for (const int32 Valid : ValidDurations)
+        {
+            if (FMath::Abs(Valid - DurationMs) < FMath::Abs(Best - DurationMs))
+            {
+                Best = Valid;
+            }
+        }
+        return Best;
+    }
+}
+
+// Runs the manager's worker side until stopped. While capturing it polls rather
+// than waiting to be signalled for audio, so the capture callback never touches
+// a lock. Between recordings it sleeps until a task or the stop wakes it.
+class FVoiceCaptureWorker : public FRunnable
+{
+public:
+    FVoiceCaptureWorker(UVoiceInputManager* InOwner, uint32 InPollIntervalMs)
+        : Owner(InOwner)
+        , PollIntervalMs(InPollIntervalMs)
+    {}
+
+    virtual uint32 Run() override
+    {
+        while (!bStopRequested)
+        {
+            // bWorkerCapturing is only changed by tasks on this thread
+            Owner->WorkerWakeEvent->Wait(Owner->bWorkerCapturing ? PollIntervalMs : MAX_uint32);
+            Owner->RunWorkerTasks();
+        }
+
+        // Whatever was queued before the stop still goes out
+        Owner->RunWorkerTasks();
+        return 0;
+    }
+
+    virtual void Stop() override
+    {
+        bStopRequested = true;
+        Owner->WorkerWakeEvent->Trigger();
+    }
+
+private:
+    UVoiceInputManager* Owner;
+    uint32 PollIntervalMs;
+    FThreadSafeBool bStopRequested;
+};
 
 UVoiceInputManager::UVoiceInputManager()
     : bIsRecording(false)
     , CurrentLanguage(TEXT("en-US"))
     , AudioComponent(nullptr)
-    , CaptureComponent(nullptr)
-    , WebSocket(nullptr)
+    , AudioCapture(nullptr)
+    , bCaptureActive(false)
+    , Worker(nullptr)
+    , WorkerThread(nullptr)
+    , WorkerWakeEvent(nullptr)
+    , LastLevelPublishTime(0.0)
+    , bWorkerCapturing(false)
+    , FrameSequence(0)
+    , bSessionActive(false)
+    , bSocketConnecting(false)
+    , ReconnectAttempt(0)
+    , NextReconnectTime(0.0)
+    , NextKeepaliveTime(0.0)
     , MaxRecordingDuration(30.0f)
     , SilenceThreshold(0.1f)
     , SampleRate(16000)
     , NumChannels(1)
+    , DeviceChannels(1)
+    , WireFormat(EVoiceAudioWireFormat::Binary)
+    , AudioCodec(EVoiceAudioCodec::PCM16)
+    , FrameDurationMs(20)
+    , CaptureBufferSeconds(2.0f)
+    , bEnableVoiceActivityDetection(true)
+    , VADMaxZeroCrossingRate(0.5f)
+    , VADOnsetMs(40)
+    , VADHangoverMs(600)
+    , VADPreRollMs(200)
+    , bAutoStopOnEndOfUtterance(false)
+    , LevelUpdateRate(30.0f)
+    , CaptureQueueSeconds(0.5f)
+    , bPersistentSession(true)
+    , KeepaliveIntervalSeconds(15.0f)
+    , ReconnectInitialDelaySeconds(0.5f)
+    , ReconnectMaxDelaySeconds(30.0f)
 {
     LoadConfiguration();
 }
@@ -68,6 +171,94 @@ void UVoiceInputManager::LoadConfiguration()
             NumChannels,
             GEngineIni
         );
+
+        // AudioWireFormat=Binary|Json, AudioCodec=PCM16|UEVoiceOpus (Opus is accepted as an alias)
+        FString WireFormatName;
+        if (GConfig->GetString(TEXT("VoiceInput"), TEXT("AudioWireFormat"), WireFormatName, GEngineIni))
+        {
+            WireFormat = WireFormatName.Equals(TEXT("Json"), ESearchCase::IgnoreCase)
+                ? EVoiceAudioWireFormat::Json
+                : EVoiceAudioWireFormat::Binary;
+        }
+
+        FString CodecName;
+        if (GConfig->GetString(TEXT("VoiceInput"), TEXT("AudioCodec"), CodecName, GEngineIni))
+        {
+            AudioCodec = CodecName.Equals(TEXT("UEVoiceOpus"), ESearchCase::IgnoreCase) || CodecName.Equals(TEXT("Opus"), ESearchCase::IgnoreCase)
+                ? EVoiceAudioCodec::UEVoiceOpus
+                : EVoiceAudioCodec::PCM16;
+        }
+
+        GConfig->GetInt(
+            TEXT("VoiceInput"),
+            TEXT("FrameDurationMs"),
+            FrameDurationMs,
+            GEngineIni
+        );
+
+        GConfig->GetFloat(
+            TEXT("VoiceInput"),
+            TEXT("CaptureBufferSeconds"),
+            CaptureBufferSeconds,
+            GEngineIni
+        );
+
+        GConfig->GetBool(TEXT("VoiceInput"), TEXT("EnableVAD"), bEnableVoiceActivityDetection, GEngineIni);
+        GConfig->GetFloat(TEXT("VoiceInput"), TEXT("VADMaxZeroCrossingRate"), VADMaxZeroCrossingRate, GEngineIni);
+        GConfig->GetInt(TEXT("VoiceInput"), TEXT("VADOnsetMs"), VADOnsetMs, GEngineIni);
+        GConfig->GetInt(TEXT("VoiceInput"), TEXT("VADHangoverMs"), VADHangoverMs, GEngineIni);
+        GConfig->GetInt(TEXT("VoiceInput"), TEXT("VADPreRollMs"), VADPreRollMs, GEngineIni);
+        GConfig->GetBool(TEXT("VoiceInput"), TEXT("AutoStopOnEndOfUtterance"), bAutoStopOnEndOfUtterance, GEngineIni);
+        GConfig->GetFloat(TEXT("VoiceInput"), TEXT("LevelUpdateRate"), LevelUpdateRate, GEngineIni);
+        GConfig->GetFloat(TEXT("VoiceInput"), TEXT("CaptureQueueSeconds"), CaptureQueueSeconds, GEngineIni);
+        GConfig->GetBool(TEXT("VoiceInput"), TEXT("PersistentSession"), bPersistentSession, GEngineIni);
+        GConfig->GetFloat(TEXT("VoiceInput"), TEXT("KeepaliveIntervalSeconds"), KeepaliveIntervalSeconds, GEngineIni);
+        GConfig->GetFloat(TEXT("VoiceInput"), TEXT("ReconnectInitialDelaySeconds"), ReconnectInitialDelaySeconds, GEngineIni);
+        GConfig->GetFloat(TEXT("VoiceInput"), TEXT("ReconnectMaxDelaySeconds"), ReconnectMaxDelaySeconds, GEngineIni);
+    }
+
+    SampleRate = FMath::Max(SampleRate, 8000);
+    NumChannels = FMath::Clamp(NumChannels, 1, 2);
+    const int32 ConfiguredFrameDurationMs = FrameDurationMs;
+    FrameDurationMs = SnapFrameDurationMs(FrameDurationMs);
+    if (FrameDurationMs != ConfiguredFrameDurationMs)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("VoiceInputManager: FrameDurationMs %d is not an Opus frame size, using %d"),
+            ConfiguredFrameDurationMs, FrameDurationMs);
+    }
+
+    // The JSON path never carries compressed audio
+    if (WireFormat == EVoiceAudioWireFormat::Json)
+    {
+        AudioCodec = EVoiceAudioCodec::PCM16;
+    }
+
+    // SilenceThreshold was already a 0-1 level, so it doubles as the speech threshold
+    FVoiceActivityDetector::FSettings VADSettings;
+    VADSettings.SpeechLevel = SilenceThreshold;
+    VADSettings.MaxZeroCrossingRate = VADMaxZeroCrossingRate;
+    VADSettings.OnsetFrames = FMath::DivideAndRoundUp(FMath::Max(VADOnsetMs, 1), FrameDurationMs);
+    VADSettings.HangoverFrames = FMath::DivideAndRoundUp(FMath::Max(VADHangoverMs, 1), FrameDurationMs);
+    VoiceActivity.Configure(VADSettings);
+}
+
+int32 UVoiceInputManager::GetFrameSampleCount() const
+{
+    return SampleRate * NumChannels * FrameDurationMs / 1000;
+}
+
+void UVoiceInputManager::InitializeEncoder()
+{
+    if (AudioCodec != EVoiceAudioCodec::UEVoiceOpus || VoiceEncoder.IsValid())
+    {
+        return;
+    }
+
+    VoiceEncoder = FVoiceModule::Get().CreateVoiceEncoder(SampleRate, NumChannels, EAudioEncodeHint::VoiceEncode_Voice);
+    if (!VoiceEncoder.IsValid())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("VoiceInputManager: Opus encoder unavailable at %d Hz, sending PCM16"), SampleRate);
+        AudioCodec = EVoiceAudioCodec::PCM16;
     }
 }
 
@@ -75,8 +266,17 @@ void UVoiceInputManager::BeginDestroy()
 {
     Super::BeginDestroy();
     
-    CleanupWebSocket();
+    if (SessionTickerHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(SessionTickerHandle);
+        SessionTickerHandle.Reset();
+    }
+    bSessionActive = false;
+
+    // Stop capture first so nothing is queued for a worker that is going away
     CleanupAudioCapture();
+    StopWorker();
+    CleanupWebSocket();
 }
 
 void UVoiceInputManager::StartRecording()
@@ -84,20 +284,58 @@ void UVoiceInputManager::StartRecording()
     if (bIsRecording)
         return;
 
+    InitializeAudioCapture();
     if (!ValidateAudioSetup())
     {
         OnVoiceInputError.Broadcast(TEXT("Failed to initialize audio capture"));
         return;
     }
 
-    InitializeWebSocket();
-    
-    if (CaptureComponent)
+    if (bPersistentSession)
     {
-        bIsRecording = true;
-        AudioBuffer.Empty();
-        CaptureComponent->Start();
+        // Reuses the warm socket, or reconnects right away rather than waiting out the backoff
+        BeginSession();
+        if (WebSocket && !WebSocket->IsConnected() && !bSocketConnecting)
+        {
+            InitializeWebSocket();
+        }
+    }
+    else
+    {
+        InitializeWebSocket();
     }
+    StartWorker();
+
+    bIsRecording = true;
+    DroppedFrames.Reset();
+    PeakQueueDepth.Reset();
+    SentFrames.Reset();
+    SuppressedFrameCount.Reset();
+
+    EnqueueWorkerTask([this]()
+    {
+        CaptureQueue.Discard();
+        CaptureBuffer.Reset();
+        PendingFrame.Reset();
+        PreRollBuffer.Reset();
+        VoiceActivity.Reset();
+        FrameSequence = 0;
+        bWorkerCapturing = true;
+
+        // A reused session needs telling where the new recording begins
+        if (WorkerSocket && WorkerSocket->IsConnected())
+        {
+            TSharedRef<FJsonObject> StartMsg = MakeShared<FJsonObject>();
+            StartMsg->SetStringField(TEXT("type"), TEXT("start"));
+            StartMsg->SetNumberField(TEXT("first_sequence"), FrameSequence);
+            SendControlMessage(StartMsg);
+        }
+
+        // Only now does the callback start queuing, so no audio lands ahead of the reset
+        bCaptureActive = true;
+    });
+
+    AudioCapture->StartCapturingAudio();
 }
 
 void UVoiceInputManager::StopRecording()
@@ -105,25 +343,41 @@ void UVoiceInputManager::StopRecording()
     if (!bIsRecording)
         return;
 
-    if (CaptureComponent)
+    bCaptureActive = false;
+    if (AudioCapture)
     {
-        CaptureComponent->Stop();
+        AudioCapture->StopCapturingAudio();
     }
 
     bIsRecording = false;
 
-    if (WebSocket && WebSocket->IsConnected())
+    // Runs after the worker drains what was captured up to here
+    EnqueueWorkerTask([this]()
     {
-        // Send end-of-stream message
-        TSharedPtr<FJsonObject> EndMsg = MakeShared<FJsonObject>();
-        EndMsg->SetStringField(TEXT("type"), TEXT("end"));
+        bWorkerCapturing = false;
+
+        // The partial last frame only matters if someone was still talking
+        if (!bEnableVoiceActivityDetection || VoiceActivity.IsInSpeech())
+        {
+            QueueSamples(PendingFrame.GetData(), PendingFrame.Num(), CaptureBuffer);
+        }
+        PendingFrame.Reset();
+        VoiceActivity.Reset();
 
-        FString EndString;
-        TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&EndString);
-        FJsonSerializer::Serialize(EndMsg.ToSharedRef(), Writer);
+        UE_LOG(LogTemp, Verbose, TEXT("VoiceInputManager: sent %u frames, suppressed %d silent frames, dropped %d capture blocks"),
+            FrameSequence, SuppressedFrameCount.GetValue(), DroppedFrames.GetValue());
 
-        WebSocket->Send(EndString);
-    }
+        if (WorkerSocket && WorkerSocket->IsConnected())
+        {
+            // Whatever is still buffered goes out ahead of the end-of-stream message
+            FlushCapturedAudio(true);
+
+            TSharedRef<FJsonObject> EndMsg = MakeShared<FJsonObject>();
+            EndMsg->SetStringField(TEXT("type"), TEXT("end"));
+            EndMsg->SetNumberField(TEXT("last_sequence"), FrameSequence);
+            SendControlMessage(EndMsg);
+        }
+    });
 }
 
 void UVoiceInputManager::SetLanguage(const FString& LanguageCode)
@@ -133,18 +387,280 @@ void UVoiceInputManager::SetLanguage(const FString& LanguageCode)
     if (WebSocket && WebSocket->IsConnected())
     {
         // Send language update message
-        TSharedPtr<FJsonObject> LangMsg = MakeShared<FJsonObject>();
+        TSharedRef<FJsonObject> LangMsg = MakeShared<FJsonObject>();
         LangMsg->SetStringField(TEXT("type"), TEXT("set_language"));
         LangMsg->SetStringField(TEXT("language"), LanguageCode);
+        EnqueueWorkerTask([this, LangMsg]()
+        {
+            SendControlMessage(LangMsg);
+        });
+    }
+}
+
+FVoiceCaptureStats UVoiceInputManager::GetCaptureStats() const
+{
+    FVoiceCaptureStats Stats;
+    Stats.DroppedFrames = DroppedFrames.GetValue();
+    Stats.QueueDepth = CaptureQueue.Num();
+    Stats.PeakQueueDepth = PeakQueueDepth.GetValue();
+    Stats.SentFrames = SentFrames.GetValue();
+    Stats.SuppressedFrames = SuppressedFrameCount.GetValue();
+    return Stats;
+}
+
+void UVoiceInputManager::PrewarmSession()
+{
+    if (!bPersistentSession)
+    {
+        return;
+    }
+
+    // Opening the device here would light the microphone indicator and may prompt for
+    // permission before anyone asked to talk, so it waits for StartRecording
+    InitializeEncoder();
+    BeginSession();
+}
+
+void UVoiceInputManager::EndSession()
+{
+    bSessionActive = false;
+    NextReconnectTime = 0.0;
+
+    if (SessionTickerHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(SessionTickerHandle);
+        SessionTickerHandle.Reset();
+    }
+
+    // A recording in progress keeps its socket, StartRecording will make a new one next time
+    if (!bIsRecording)
+    {
+        CleanupWebSocket();
+    }
+}
+
+void UVoiceInputManager::BeginSession()
+{
+    bSessionActive = true;
+
+    if (!SessionTickerHandle.IsValid())
+    {
+        SessionTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+            FTickerDelegate::CreateUObject(this, &UVoiceInputManager::TickSession), 0.25f);
+    }
+
+    if (!WebSocket)
+    {
+        InitializeWebSocket();
+    }
+}
+
+void UVoiceInputManager::ScheduleReconnect()
+{
+    // Exponential backoff with jitter so a server restart isn't met by every client at once
+    const float BaseDelay = FMath::Min(ReconnectInitialDelaySeconds * FMath::Pow(2.0f, static_cast<float>(FMath::Min(ReconnectAttempt, 16))),
+        ReconnectMaxDelaySeconds);
+    const float Delay = BaseDelay * FMath::FRandRange(0.8f, 1.2f);
+
+    ++ReconnectAttempt;
+    NextReconnectTime = FPlatformTime::Seconds() + Delay;
+
+    UE_LOG(LogTemp, Log, TEXT("VoiceInputManager: reconnecting in %.1f s (attempt %d)"), Delay, ReconnectAttempt);
+}
+
+bool UVoiceInputManager::TickSession(float DeltaTime)
+{
+    if (!bSessionActive)
+    {
+        return true;
+    }
+
+    const double Now = FPlatformTime::Seconds();
+
+    if (WebSocket && WebSocket->IsConnected())
+    {
+        // Audio frames keep the connection busy while recording
+        if (!bIsRecording && KeepaliveIntervalSeconds > 0.0f && Now >= NextKeepaliveTime)
+        {
+            NextKeepaliveTime = Now + KeepaliveIntervalSeconds;
+
+            TSharedRef<FJsonObject> PingMsg = MakeShared<FJsonObject>();
+            PingMsg->SetStringField(TEXT("type"), TEXT("ping"));
+            EnqueueWorkerTask([this, PingMsg]()
+            {
+                SendControlMessage(PingMsg);
+            });
+        }
+    }
+    else if (!bSocketConnecting && NextReconnectTime > 0.0 && Now >= NextReconnectTime)
+    {
+        NextReconnectTime = 0.0;
+        InitializeWebSocket();
+    }
+
+    return true;
+}
+
+void UVoiceInputManager::StartWorker()
+{
+    if (WorkerThread)
+    {
+        return;
+    }
+
+    // Everything the worker owns is sized here, before it can run
+    InitializeEncoder();
+
+    const int32 FrameSampleCount = GetFrameSampleCount();
+    CaptureQueue.SetCapacity(FMath::CeilToInt(SampleRate * NumChannels * FMath::Max(CaptureQueueSeconds, 0.05f)));
+    DrainBuffer.SetNumUninitialized(FrameSampleCount);
+
+    // Room for a few seconds of backlog while the socket connects
+    CaptureBuffer.SetCapacity(FMath::CeilToInt(SampleRate * NumChannels * FMath::Max(CaptureBufferSeconds, 0.1f)));
+    FrameSamples.Reserve(FrameSampleCount);
+    FrameBuffer.Reserve(FVoiceAudioFrameHeader::Size + FrameSampleCount * sizeof(int16));
+    PendingFrame.Reserve(FrameSampleCount);
+
+    // Whole frames only, and never less than the onset run that has to be replayed
+    const int32 PreRollFrames = FMath::Max(FMath::DivideAndRoundUp(FMath::Max(VADPreRollMs, 0), FrameDurationMs),
+        FMath::DivideAndRoundUp(FMath::Max(VADOnsetMs, 1), FrameDurationMs));
+    PreRollBuffer.SetCapacity(PreRollFrames * FrameSampleCount);
+
+    SPORTBEACON_SET_MEMORY(VoiceBufferMemory, CaptureQueue.Capacity() * sizeof(float)
+        + (CaptureBuffer.Capacity() + PreRollBuffer.Capacity()) * sizeof(int16)
+        + DrainBuffer.GetAllocatedSize() + PendingFrame.GetAllocatedSize()
+        + FrameSamples.GetAllocatedSize() + FrameBuffer.GetAllocatedSize());
+
+    WorkerWakeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+    Worker = new FVoiceCaptureWorker(this, FMath::Max(FrameDurationMs / 2, 1));
+    WorkerThread = FRunnableThread::Create(Worker, TEXT("VoiceCaptureWorker"), 0, TPri_AboveNormal);
+}
+
+void UVoiceInputManager::StopWorker()
+{
+    if (WorkerThread)
+    {
+        WorkerThread->Kill(true);
+        delete WorkerThread;
+        WorkerThread = nullptr;
+    }
+
+    if (Worker)
+    {
+        delete Worker;
+        Worker = nullptr;
+    }
+
+    if (WorkerWakeEvent)
+    {
+        FPlatformProcess::ReturnSynchEventToPool(WorkerWakeEvent);
+        WorkerWakeEvent = nullptr;
+    }
+}
+
+void UVoiceInputManager::EnqueueWorkerTask(TFunction<void()>&& Task)
+{
+    // Without a worker the game thread is the only one touching worker state
+    if (!WorkerThread)
+    {
+        Task();
+        return;
+    }
+
+    WorkerTasks.Enqueue(MoveTemp(Task));
+    WorkerWakeEvent->Trigger();
+}
+
+void UVoiceInputManager::RunWorkerTasks()
+{
+    // Audio captured before a task was queued is processed before it runs
+    TFunction<void()> Task;
+    while (WorkerTasks.Dequeue(Task))
+    {
+        DrainCaptureQueue();
+        Task();
+    }
+
+    DrainCaptureQueue();
+}
 
-        FString LangString;
-        TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&LangString);
-        FJsonSerializer::Serialize(LangMsg.ToSharedRef(), Writer);
+void UVoiceInputManager::DrainCaptureQueue()
+{
+    int32 NumRead = 0;
+    while ((NumRead = CaptureQueue.Read(DrainBuffer.GetData(), DrainBuffer.Num())) > 0)
+    {
+        ProcessAudioData(DrainBuffer.GetData(), NumRead);
+    }
+}
+
+void UVoiceInputManager::OnAudioCaptured(const float* AudioData, int32 NumSamples)
+{
+    // Capture thread: copy and leave
+    if (!bCaptureActive)
+        return;
+
+    // Mono takes the average of every device channel, stereo the first two
+    if (DeviceChannels != NumChannels)
+    {
+        const int32 NumFrames = NumSamples / DeviceChannels;
+        DownmixBuffer.SetNumUninitialized(NumFrames * NumChannels, false);
+
+        for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+        {
+            const float* In = AudioData + Frame * DeviceChannels;
+            if (NumChannels == 1)
+            {
+                float Sum = 0.0f;
+                for (int32 Channel = 0; Channel < DeviceChannels; ++Channel)
+                {
+                    Sum += In[Channel];
+                }
+                DownmixBuffer[Frame] = Sum / DeviceChannels;
+            }
+            else
+            {
+                DownmixBuffer[Frame * 2] = In[0];
+                DownmixBuffer[Frame * 2 + 1] = In[1];
+            }
+        }
+
+        AudioData = DownmixBuffer.GetData();
+        NumSamples = DownmixBuffer.Num();
+    }
+
+    if (!CaptureQueue.Write(AudioData, NumSamples))
+    {
+        DroppedFrames.Increment();
+        return;
+    }
 
-        WebSocket->Send(LangString);
+    // Only this thread raises the peak, so check-then-set is safe
+    const int32 QueueDepth = CaptureQueue.Num();
+    if (QueueDepth > PeakQueueDepth.GetValue())
+    {
+        PeakQueueDepth.Set(QueueDepth);
     }
 }
 
+void UVoiceInputManager::PublishLevel(float Level)
+{
+    const double Now = FPlatformTime::Seconds();
+    if (LevelUpdateRate > 0.0f && Now - LastLevelPublishTime < 1.0 / LevelUpdateRate)
+    {
+        return;
+    }
+    LastLevelPublishTime = Now;
+
+    TWeakObjectPtr<UVoiceInputManager> WeakThis(this);
+    AsyncTask(ENamedThreads::GameThread, [WeakThis, Level]()
+    {
+        if (UVoiceInputManager* Manager = WeakThis.Get())
+        {
+            Manager->OnVoiceInputLevel.Broadcast(Level);
+        }
+    });
+}
+
 void UVoiceInputManager::InitializeAudioCapture()
 {
     if (!AudioComponent)
@@ -154,29 +670,54 @@ void UVoiceInputManager::InitializeAudioCapture()
         AudioComponent->bAutoActivate = true;
     }
 
-    if (!CaptureComponent)
+    if (!AudioCapture)
     {
-        CaptureComponent = NewObject<UAudioCaptureComponent>(this);
-        CaptureComponent->bAutoDestroy = false;
-        
-        // Configure audio capture
-        CaptureComponent->SampleRate = SampleRate;
-        CaptureComponent->NumChannels = NumChannels;
-        CaptureComponent->OnAudioCapture.AddDynamic(this, &UVoiceInputManager::ProcessAudioData);
+        AudioCapture = NewObject<UAudioCapture>(this);
+        if (!AudioCapture->OpenDefaultAudioStream())
+        {
+            AudioCapture = nullptr;
+            return;
+        }
+
+        // The device decides the sample rate. Channels stay mono or stereo for Opus and the
+        // frame header, so a device with more is mixed down to the configured count.
+        DeviceChannels = FMath::Max(AudioCapture->GetNumChannels(), 1);
+        if (AudioCapture->GetSampleRate() != SampleRate || DeviceChannels != NumChannels)
+        {
+            UE_LOG(LogTemp, Log, TEXT("VoiceInputManager: capture device runs at %d Hz x %d, not the configured %d Hz x %d"),
+                AudioCapture->GetSampleRate(), DeviceChannels, SampleRate, NumChannels);
+            SampleRate = AudioCapture->GetSampleRate();
+            NumChannels = FMath::Min(NumChannels, DeviceChannels);
+
+            // A prewarmed encoder and socket were set up for the configured format. The
+            // worker only starts after the device opens, so nothing else holds them yet.
+            VoiceEncoder.Reset();
+            if (WebSocket)
+            {
+                InitializeWebSocket();
+            }
+        }
+
+        // Runs on the capture thread
+        CaptureGeneratorHandle = AudioCapture->AddGeneratorDelegate([this](const float* InAudio, int32 NumSamples)
+        {
+            OnAudioCaptured(InAudio, NumSamples);
+        });
     }
 }
 
 void UVoiceInputManager::CleanupAudioCapture()
 {
-    if (CaptureComponent)
+    bCaptureActive = false;
+
+    if (AudioCapture)
     {
-        CaptureComponent->OnAudioCapture.RemoveAll(this);
-        if (CaptureComponent->IsCapturing())
+        AudioCapture->RemoveGeneratorDelegate(CaptureGeneratorHandle);
+        if (AudioCapture->IsCapturingAudio())
         {
-            CaptureComponent->Stop();
+            AudioCapture->StopCapturingAudio();
         }
-        CaptureComponent->ConditionalBeginDestroy();
-        CaptureComponent = nullptr;
+        AudioCapture = nullptr;
     }
 
     if (AudioComponent)
@@ -188,7 +729,7 @@ void UVoiceInputManager::CleanupAudioCapture()
 
 bool UVoiceInputManager::ValidateAudioSetup() const
 {
-    if (!CaptureComponent || !AudioComponent)
+    if (!AudioCapture || !AudioComponent)
     {
         return false;
     }
@@ -198,58 +739,218 @@ bool UVoiceInputManager::ValidateAudioSetup() const
 
 void UVoiceInputManager::ProcessAudioData(const float* AudioData, int32 NumSamples)
 {
-    if (!bIsRecording || !WebSocket || !WebSocket->IsConnected())
+    // Worker thread. Stragglers drained after a stop are dropped.
+    if (!bWorkerCapturing)
         return;
 
-    // Calculate audio level for visualization
-    CalculateAudioLevel(AudioData, NumSamples);
+    // Capture callbacks don't line up with frames, carry the remainder over
+    const int32 FrameSampleCount = GetFrameSampleCount();
+    float LastLevel = -1.0f;
+    int32 Offset = 0;
+    while (Offset < NumSamples)
+    {
+        const int32 NumToCopy = FMath::Min(FrameSampleCount - PendingFrame.Num(), NumSamples - Offset);
+        PendingFrame.Append(AudioData + Offset, NumToCopy);
+        Offset += NumToCopy;
 
-    // Convert float samples to int16 samples
-    const int32 BytesPerSample = sizeof(int16);
-    const int32 BufferSize = NumSamples * BytesPerSample;
-    TArray<uint8> AudioBuffer;
-    AudioBuffer.SetNum(BufferSize);
+        if (PendingFrame.Num() == FrameSampleCount)
+        {
+            LastLevel = ProcessCapturedFrame(PendingFrame.GetData(), FrameSampleCount);
+            PendingFrame.Reset();
+        }
+    }
 
-    int16* Int16Buffer = reinterpret_cast<int16*>(AudioBuffer.GetData());
-    for (int32 i = 0; i < NumSamples; ++i)
+    // Level meter updates go to the game thread at LevelUpdateRate at most
+    if (LastLevel >= 0.0f)
     {
-        Int16Buffer[i] = static_cast<int16>(AudioData[i] * 32767.0f);
+        PublishLevel(LastLevel);
     }
 
-    // Create audio chunk message
-    TSharedPtr<FJsonObject> AudioMsg = MakeShared<FJsonObject>();
-    AudioMsg->SetStringField(TEXT("type"), TEXT("audio"));
-    
-    // Convert audio buffer to base64
-    FString Base64Audio = FBase64::Encode(AudioBuffer.GetData(), AudioBuffer.Num());
-    AudioMsg->SetStringField(TEXT("data"), Base64Audio);
+    FlushCapturedAudio(false);
+}
 
-    FString AudioString;
-    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&AudioString);
-    FJsonSerializer::Serialize(AudioMsg.ToSharedRef(), Writer);
+float UVoiceInputManager::ProcessCapturedFrame(const float* Samples, int32 NumSamples)
+{
+    SPORTBEACON_SCOPE_CYCLE(VoiceCapture);
 
-    WebSocket->Send(AudioString);
+    if (!bEnableVoiceActivityDetection)
+    {
+        float MeanSquare = 0.0f;
+        float ZeroCrossingRate = 0.0f;
+        FVoiceActivityDetector::Analyze(Samples, NumSamples, MeanSquare, ZeroCrossingRate);
+        QueueSamples(Samples, NumSamples, CaptureBuffer);
+        return FVoiceActivityDetector::MeanSquareToLevel(MeanSquare);
+    }
+
+    const FVoiceActivityDetector::FFrameResult Result = VoiceActivity.ProcessFrame(Samples, NumSamples);
+
+    if (Result.Event == FVoiceActivityDetector::EEvent::SpeechStarted)
+    {
+        // Replay the lead-in, including the onset frames that were held back
+        while (!PreRollBuffer.IsEmpty())
+        {
+            CaptureBuffer.Push(PreRollBuffer[0]);
+            PreRollBuffer.PopFront();
+        }
+    }
+
+    if (VoiceActivity.IsInSpeech() || Result.Event == FVoiceActivityDetector::EEvent::SpeechEnded)
+    {
+        QueueSamples(Samples, NumSamples, CaptureBuffer);
+    }
+    else
+    {
+        // Silence never reaches the socket, it only feeds the pre-roll
+        QueueSamples(Samples, NumSamples, PreRollBuffer);
+        SuppressedFrameCount.Increment();
+    }
+
+    if (Result.Event == FVoiceActivityDetector::EEvent::SpeechEnded)
+    {
+        EndUtterance();
+    }
+
+    return Result.Level;
 }
 
-void UVoiceInputManager::CalculateAudioLevel(const float* AudioData, int32 NumSamples)
+void UVoiceInputManager::QueueSamples(const float* Samples, int32 NumSamples, TFixedRingBuffer<int16>& Buffer)
 {
-    float SumSquares = 0.0f;
+    // When the buffer fills, e.g. while the socket is still connecting, the oldest audio is dropped
     for (int32 i = 0; i < NumSamples; ++i)
     {
-        SumSquares += AudioData[i] * AudioData[i];
+        Buffer.Push(static_cast<int16>(FMath::Clamp(Samples[i], -1.0f, 1.0f) * 32767.0f));
     }
+}
 
-    float RMS = FMath::Sqrt(SumSquares / NumSamples);
-    float DB = 20.0f * FMath::LogX(10.0f, RMS);
-    
-    // Normalize to 0-1 range
-    float NormalizedLevel = FMath::GetMappedRangeValueClamped(
-        FVector2D(-60.0f, 0.0f),
-        FVector2D(0.0f, 1.0f),
-        DB
-    );
+void UVoiceInputManager::EndUtterance()
+{
+    // Tells the service to finalize now rather than when the button is released
+    if (WorkerSocket && WorkerSocket->IsConnected())
+    {
+        FlushCapturedAudio(true);
+
+        TSharedRef<FJsonObject> UtteranceMsg = MakeShared<FJsonObject>();
+        UtteranceMsg->SetStringField(TEXT("type"), TEXT("end_of_utterance"));
+        UtteranceMsg->SetNumberField(TEXT("last_sequence"), FrameSequence);
+        SendControlMessage(UtteranceMsg);
+    }
+
+    TWeakObjectPtr<UVoiceInputManager> WeakThis(this);
+    AsyncTask(ENamedThreads::GameThread, [WeakThis]()
+    {
+        UVoiceInputManager* Manager = WeakThis.Get();
+        if (!Manager)
+        {
+            return;
+        }
+
+        Manager->OnUtteranceEnded.Broadcast();
+        if (Manager->bAutoStopOnEndOfUtterance)
+        {
+            Manager->StopRecording();
+        }
+    });
+}
+
+void UVoiceInputManager::FlushCapturedAudio(bool bFinal)
+{
+    if (!WorkerSocket || !WorkerSocket->IsConnected())
+        return;
+
+    const int32 FrameSampleCount = GetFrameSampleCount();
+    while (CaptureBuffer.Num() >= FrameSampleCount || (bFinal && !CaptureBuffer.IsEmpty()))
+    {
+        const int32 NumToSend = FMath::Min(FrameSampleCount, CaptureBuffer.Num());
+        FrameSamples.SetNumUninitialized(NumToSend, false);
+        CaptureBuffer.Read(FrameSamples.GetData(), NumToSend);
+
+        // The encoder drops anything short of a whole encoder frame, so a short tail
+        // is padded with silence up to the next one
+        if (AudioCodec == EVoiceAudioCodec::UEVoiceOpus)
+        {
+            const int32 EncoderFrameSamples = SampleRate * NumChannels * EncoderFrameMs / 1000;
+            FrameSamples.SetNumZeroed(FMath::DivideAndRoundUp(NumToSend, EncoderFrameSamples) * EncoderFrameSamples, false);
+        }
+
+        SendAudioFrame(FrameSamples.GetData(), FrameSamples.Num());
+    }
+}
+
+void UVoiceInputManager::SendAudioFrame(const int16* Samples, int32 NumSamples)
+{
+    SPORTBEACON_SCOPE_CYCLE(VoiceEncode);
+    if (WireFormat == EVoiceAudioWireFormat::Json)
+    {
+        SendJsonAudioFrame(Samples, NumSamples);
+    }
+    else
+    {
+        SendBinaryAudioFrame(Samples, NumSamples);
+    }
+
+    ++FrameSequence;
+    SentFrames.Increment();
+}
+
+void UVoiceInputManager::SendJsonAudioFrame(const int16* Samples, int32 NumSamples)
+{
+    // Kept for services that only accept text frames
+    TSharedRef<FJsonObject> AudioMsg = MakeShared<FJsonObject>();
+    AudioMsg->SetStringField(TEXT("type"), TEXT("audio"));
+    AudioMsg->SetNumberField(TEXT("sequence"), FrameSequence);
+    AudioMsg->SetStringField(TEXT("data"), FBase64::Encode(reinterpret_cast<const uint8*>(Samples), NumSamples * sizeof(int16)));
+    SendControlMessage(AudioMsg);
+}
+
+void UVoiceInputManager::SendBinaryAudioFrame(const int16* Samples, int32 NumSamples)
+{
+    const uint8* Payload = reinterpret_cast<const uint8*>(Samples);
+    uint32 PayloadBytes = NumSamples * sizeof(int16);
 
-    OnVoiceInputLevel.Broadcast(NormalizedLevel);
+    if (AudioCodec == EVoiceAudioCodec::UEVoiceOpus && VoiceEncoder.IsValid())
+    {
+        // Opus never grows a frame, so the raw size is a safe output bound
+        FramePayload.SetNumUninitialized(PayloadBytes, false);
+        uint32 CompressedBytes = PayloadBytes;
+        const int32 Remaining = VoiceEncoder->Encode(Payload, PayloadBytes, FramePayload.GetData(), CompressedBytes);
+        if (Remaining > 0)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("VoiceInputManager: Opus left %d bytes of frame %u unencoded"), Remaining, FrameSequence);
+        }
+
+        Payload = FramePayload.GetData();
+        PayloadBytes = CompressedBytes;
+    }
+
+    FVoiceAudioFrameHeader Header;
+    Header.Codec = static_cast<uint8>(AudioCodec);
+    Header.Sequence = FrameSequence;
+    Header.SampleCount = static_cast<uint16>(NumSamples / NumChannels);
+    Header.PayloadBytes = static_cast<uint16>(PayloadBytes);
+
+    // Reset keeps the allocation, so this is a copy into reused memory
+    FrameBuffer.Reset();
+    FMemoryWriter Writer(FrameBuffer);
+    Writer.SetByteSwapping(!PLATFORM_LITTLE_ENDIAN);
+
+    uint16 Magic = FVoiceAudioFrameHeader::Magic;
+    uint8 Version = FVoiceAudioFrameHeader::Version;
+    Writer << Magic << Version << Header.Codec << Header.Sequence << Header.SampleCount << Header.PayloadBytes;
+    Writer.Serialize(const_cast<uint8*>(Payload), PayloadBytes);
+
+    WorkerSocket->Send(FrameBuffer.GetData(), FrameBuffer.Num(), true);
+}
+
+void UVoiceInputManager::SendControlMessage(const TSharedRef<FJsonObject>& Message)
+{
+    if (!WorkerSocket || !WorkerSocket->IsConnected())
+        return;
+
+    FString MessageString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&MessageString);
+    FJsonSerializer::Serialize(Message, Writer);
+
+    WorkerSocket->Send(MessageString);
 }
 
 void UVoiceInputManager::InitializeWebSocket()
@@ -272,65 +973,159 @@ void UVoiceInputManager::InitializeWebSocket()
 
     WebSocket = FWebSocketsModule::Get().CreateWebSocket(WSUrl);
 
-    // Set up event handlers
-    WebSocket->OnConnected().AddLambda([this]() {
-        // Send initialization message with player ID and language
-        TSharedPtr<FJsonObject> InitMsg = MakeShared<FJsonObject>();
-        InitMsg->SetStringField(TEXT("type"), TEXT("init"));
-        InitMsg->SetStringField(TEXT("player_id"), GetWorld()->GetFirstPlayerController()->PlayerState->GetPlayerName());
-        InitMsg->SetStringField(TEXT("language"), CurrentLanguage);
+    // Bound to this object so nothing fires into a destroyed manager
+    WebSocket->OnConnected().AddUObject(this, &UVoiceInputManager::OnWebSocketConnected);
+    WebSocket->OnMessage().AddUObject(this, &UVoiceInputManager::OnWebSocketMessage);
+    WebSocket->OnConnectionError().AddUObject(this, &UVoiceInputManager::OnWebSocketError);
+    WebSocket->OnClosed().AddUObject(this, &UVoiceInputManager::OnWebSocketClosed);
 
-        FString InitString;
-        TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&InitString);
-        FJsonSerializer::Serialize(InitMsg.ToSharedRef(), Writer);
+    // The worker does all the sending, through its own reference
+    EnqueueWorkerTask([this, Socket = WebSocket]()
+    {
+        WorkerSocket = Socket;
+    });
 
-        WebSocket->Send(InitString);
+    bSocketConnecting = true;
+    WebSocket->Connect();
+}
+
+void UVoiceInputManager::OnWebSocketConnected()
+{
+    bSocketConnecting = false;
+    ReconnectAttempt = 0;
+    NextReconnectTime = 0.0;
+    NextKeepaliveTime = FPlatformTime::Seconds() + KeepaliveIntervalSeconds;
+
+    FString PlayerId;
+    if (UWorld* World = GetWorld())
+    {
+        APlayerController* PlayerController = World->GetFirstPlayerController();
+        if (PlayerController && PlayerController->PlayerState)
+        {
+            PlayerId = PlayerController->PlayerState->GetPlayerName();
+        }
+    }
+
+    // Send initialization message with player ID, language and the audio format that follows
+    TSharedRef<FJsonObject> InitMsg = MakeShared<FJsonObject>();
+    InitMsg->SetStringField(TEXT("type"), TEXT("init"));
+    InitMsg->SetStringField(TEXT("player_id"), PlayerId);
+    InitMsg->SetStringField(TEXT("language"), CurrentLanguage);
+    InitMsg->SetStringField(TEXT("audio_format"), WireFormat == EVoiceAudioWireFormat::Binary ? TEXT("binary") : TEXT("json"));
+    InitMsg->SetStringField(TEXT("codec"), GetCodecName(AudioCodec));
+    InitMsg->SetNumberField(TEXT("sample_rate"), SampleRate);
+    InitMsg->SetNumberField(TEXT("channels"), NumChannels);
+    InitMsg->SetNumberField(TEXT("frame_ms"), FrameDurationMs);
+    if (AudioCodec == EVoiceAudioCodec::UEVoiceOpus)
+    {
+        // Payloads use the engine voice container, not bare Opus packets
+        InitMsg->SetStringField(TEXT("codec_container"), TEXT("ue_voice"));
+        InitMsg->SetNumberField(TEXT("opus_frame_ms"), EncoderFrameMs);
+    }
+
+    EnqueueWorkerTask([this, InitMsg]()
+    {
+        SendControlMessage(InitMsg);
+
+        // Audio captured while connecting. A stop that happened before the
+        // connection finished still owes the service its end message.
+        if (bWorkerCapturing)
+        {
+            TSharedRef<FJsonObject> StartMsg = MakeShared<FJsonObject>();
+            StartMsg->SetStringField(TEXT("type"), TEXT("start"));
+            StartMsg->SetNumberField(TEXT("first_sequence"), FrameSequence);
+            SendControlMessage(StartMsg);
+
+            FlushCapturedAudio(false);
+        }
+        else if (!CaptureBuffer.IsEmpty())
+        {
+            FlushCapturedAudio(true);
+
+            TSharedRef<FJsonObject> EndMsg = MakeShared<FJsonObject>();
+            EndMsg->SetStringField(TEXT("type"), TEXT("end"));
+            EndMsg->SetNumberField(TEXT("last_sequence"), FrameSequence);
+            SendControlMessage(EndMsg);
+        }
     });
+}
 
-    WebSocket->OnMessage().AddLambda([this](const FString& Message) {
-        TSharedPtr<FJsonObject> JsonMessage;
-        TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Message);
+void UVoiceInputManager::OnWebSocketMessage(const FString& Message)
+{
+    TSharedPtr<FJsonObject> JsonMessage;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Message);
 
-        if (FJsonSerializer::Deserialize(Reader, JsonMessage))
+    if (FJsonSerializer::Deserialize(Reader, JsonMessage) && JsonMessage.IsValid())
+    {
+        FString MessageType = JsonMessage->GetStringField(TEXT("type"));
+        
+        if (MessageType == TEXT("recognition_result"))
         {
-            FString MessageType = JsonMessage->GetStringField(TEXT("type"));
+            FString RecognizedText = JsonMessage->GetStringField(TEXT("text"));
+            bool bIsFinal = JsonMessage->GetBoolField(TEXT("isFinal"));
             
-            if (MessageType == TEXT("recognition_result"))
-            {
-                FString RecognizedText = JsonMessage->GetStringField(TEXT("text"));
-                bool bIsFinal = JsonMessage->GetBoolField(TEXT("isFinal"));
-                
-                if (bIsFinal)
-                {
-                    OnSpeechRecognized.Broadcast(RecognizedText);
-                }
-            }
-            else if (MessageType == TEXT("error"))
+            if (bIsFinal)
             {
-                FString ErrorMessage = JsonMessage->GetStringField(TEXT("message"));
-                OnVoiceInputError.Broadcast(ErrorMessage);
+                OnSpeechRecognized.Broadcast(RecognizedText);
             }
         }
-    });
+        else if (MessageType == TEXT("error"))
+        {
+            FString ErrorMessage = JsonMessage->GetStringField(TEXT("message"));
+            OnVoiceInputError.Broadcast(ErrorMessage);
+        }
+    }
+}
 
-    WebSocket->OnConnectionError().AddLambda([this](const FString& Error) {
-        OnVoiceInputError.Broadcast(Error);
-        bIsRecording = false;
-    });
+void UVoiceInputManager::OnWebSocketError(const FString& Error)
+{
+    bSocketConnecting = false;
 
-    WebSocket->Connect();
+    // A persistent session rides out the outage, captured audio waits for the reconnect
+    if (bSessionActive)
+    {
+        if (bIsRecording)
+        {
+            OnVoiceInputError.Broadcast(Error);
+        }
+        ScheduleReconnect();
+        return;
+    }
+
+    OnVoiceInputError.Broadcast(Error);
+    StopRecording();
+}
+
+void UVoiceInputManager::OnWebSocketClosed(int32 StatusCode, const FString& Reason, bool bWasClean)
+{
+    bSocketConnecting = false;
+
+    if (bSessionActive)
+    {
+        UE_LOG(LogTemp, Log, TEXT("VoiceInputManager: session closed by server (%d %s)"), StatusCode, *Reason);
+        ScheduleReconnect();
+    }
 }
 
 void UVoiceInputManager::CleanupWebSocket()
 {
     if (WebSocket)
     {
+        WebSocket->OnConnected().RemoveAll(this);
+        WebSocket->OnMessage().RemoveAll(this);
+        WebSocket->OnConnectionError().RemoveAll(this);
+        WebSocket->OnClosed().RemoveAll(this);
         if (WebSocket->IsConnected())
         {
             WebSocket->Close();
         }
-        delete WebSocket;
-        WebSocket = nullptr;
+        WebSocket.Reset();
+        bSocketConnecting = false;
+
+        EnqueueWorkerTask([this]()
+        {
+            WorkerSocket.Reset();
+        });
     }
 }
 
@@ -3,11 +3,92 @@
 #include "CoreMinimal.h"
 #include "UObject/NoExportTypes.h"
 #include "Sound/SoundWave.h"
+#include "FixedRingBuffer.h"
+#include "VoiceActivityDetector.h"
+#include "SpscRingBuffer.h"
+#include "HAL/ThreadSafeBool.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "Containers/Queue.h"
+#include "Generators/AudioGenerator.h"
+#include "Containers/Ticker.h"
 #include "VoiceInputManager.generated.h"
 
+class IWebSocket;
+class IVoiceEncoder;
+class FJsonObject;
+class FRunnableThread;
+class FEvent;
+class UAudioCapture;
+class FVoiceCaptureWorker;
+
+// How captured audio travels to the transcription service. Control messages
+// (init, end, set_language) are JSON text frames either way.
+UENUM(BlueprintType)
+enum class EVoiceAudioWireFormat : uint8
+{
+    // Legacy base64 audio inside JSON text frames
+    Json,
+    // FVoiceAudioFrameHeader followed by the payload in a binary frame
+    Binary
+};
+
+UENUM(BlueprintType)
+enum class EVoiceAudioCodec : uint8
+{
+    PCM16 = 0,
+    // Opus wrapped in the engine voice encoder's container, see FVoiceAudioFrameHeader
+    UEVoiceOpus = 1
+};
+
+// Little-endian header in front of every binary audio frame.
+//
+// A UEVoiceOpus payload is not a bare Opus packet but what the engine's Opus
+// voice encoder writes: a uint8 frame count, a uint8 encoder generation, one
+// uint16 offset per frame locating its packet, then the raw 20 ms Opus packets
+// back to back. A server decodes it with the engine's decoder or by splitting
+// the packets at those offsets. The init message announces it as
+// codec "ue_voice_opus" with opus_frame_ms 20.
+struct FVoiceAudioFrameHeader
+{
+    static constexpr uint16 Magic = 0x4253; // "SB"
+    static constexpr uint8 Version = 1;
+    static constexpr int32 Size = 12;
+
+    uint8 Codec = 0;
+    uint32 Sequence = 0;
+    // Samples per channel covered by the payload
+    uint16 SampleCount = 0;
+    uint16 PayloadBytes = 0;
+};
+
+USTRUCT(BlueprintType)
+struct FVoiceCaptureStats
+{
+    GENERATED_BODY()
+
+    // Capture callbacks thrown away because the worker queue was full
+    UPROPERTY(BlueprintReadOnly, Category = "Voice Input")
+    int32 DroppedFrames = 0;
+
+    // Samples waiting between the capture callback and the worker
+    UPROPERTY(BlueprintReadOnly, Category = "Voice Input")
+    int32 QueueDepth = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Voice Input")
+    int32 PeakQueueDepth = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Voice Input")
+    int32 SentFrames = 0;
+
+    // Frames the VAD kept off the socket
+    UPROPERTY(BlueprintReadOnly, Category = "Voice Input")
+    int32 SuppressedFrames = 0;
+};
+
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnSpeechRecognizedSignature, const FString&, RecognizedText);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnVoiceInputErrorSignature, const FString&, ErrorMessage);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnVoiceInputLevelSignature, float, InputLevel);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnVoiceUtteranceEndedSignature);
 
 UCLASS(Blueprintable, BlueprintType)
 class SPORTBEACON_API UVoiceInputManager : public UObject
@@ -29,6 +110,19 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Voice Input")
     void SetLanguage(const FString& LanguageCode);
 
+    UFUNCTION(BlueprintCallable, Category = "Voice Input")
+    FVoiceCaptureStats GetCaptureStats() const;
+
+    // Creates the encoder and opens the transcription socket ahead of the first
+    // StartRecording and keeps the socket alive between recordings. The microphone
+    // is only opened by StartRecording. Needs PersistentSession.
+    UFUNCTION(BlueprintCallable, Category = "Voice Input")
+    void PrewarmSession();
+
+    // Closes the persistent socket once any current recording has stopped
+    UFUNCTION(BlueprintCallable, Category = "Voice Input")
+    void EndSession();
+
     // Events
     UPROPERTY(BlueprintAssignable, Category = "Voice Input|Events")
     FOnSpeechRecognizedSignature OnSpeechRecognized;
@@ -39,34 +133,145 @@ public:
     UPROPERTY(BlueprintAssignable, Category = "Voice Input|Events")
     FOnVoiceInputLevelSignature OnVoiceInputLevel;
 
+    // Voice activity detection saw the speaker stop, fired on the game thread
+    UPROPERTY(BlueprintAssignable, Category = "Voice Input|Events")
+    FOnVoiceUtteranceEndedSignature OnUtteranceEnded;
+
 protected:
     virtual void BeginDestroy() override;
 
 private:
+    friend class FVoiceCaptureWorker;
+
     bool bIsRecording;
     FString CurrentLanguage;
-    TArray<uint8> AudioBuffer;
     
     // Audio capture components
     class UAudioComponent* AudioComponent;
-    class UAudioCaptureComponent* CaptureComponent;
 
-    // Audio processing
+    UPROPERTY()
+    UAudioCapture* AudioCapture;
+    FAudioGeneratorHandle CaptureGeneratorHandle;
+
+    /**
+     * Threading: the capture callback only copies samples into CaptureQueue.
+     * Everything from framing and VAD to encoding and WebSocket sends runs on
+     * the worker thread. The game thread reaches worker state only through
+     * WorkerTasks, which the worker runs in order between drains.
+     */
+    void OnAudioCaptured(const float* AudioData, int32 NumSamples);
+    TSpscRingBuffer<float> CaptureQueue;
+    // Capture thread only, devices with more channels than NumChannels are mixed down here
+    TArray<float> DownmixBuffer;
+    FThreadSafeBool bCaptureActive;
+    FThreadSafeCounter DroppedFrames;
+    FThreadSafeCounter PeakQueueDepth;
+    FThreadSafeCounter SentFrames;
+    FThreadSafeCounter SuppressedFrameCount;
+
+    // Game thread side of the worker
+    void StartWorker();
+    void StopWorker();
+    void EnqueueWorkerTask(TFunction<void()>&& Task);
+    FVoiceCaptureWorker* Worker;
+    FRunnableThread* WorkerThread;
+    FEvent* WorkerWakeEvent;
+    TQueue<TFunction<void()>, EQueueMode::Spsc> WorkerTasks;
+
+    // Worker-only from here on, unless noted
+    void RunWorkerTasks();
+    void DrainCaptureQueue();
+    void PublishLevel(float Level);
+    TArray<float> DrainBuffer;
+    double LastLevelPublishTime;
+    bool bWorkerCapturing;
+    TSharedPtr<IWebSocket> WorkerSocket;
+
+    // Audio processing. Capture is cut into FrameDurationMs frames, each one
+    // classified by the VAD before it is converted and queued.
     void ProcessAudioData(const float* AudioData, int32 NumSamples);
-    void SendAudioForRecognition();
-    void CalculateAudioLevel(const float* AudioData, int32 NumSamples);
+    // Returns the frame's normalized level
+    float ProcessCapturedFrame(const float* Samples, int32 NumSamples);
+    void QueueSamples(const float* Samples, int32 NumSamples, TFixedRingBuffer<int16>& Buffer);
+    void EndUtterance();
+
+    // Sends every whole frame in the capture buffer, plus the partial tail when bFinal
+    void FlushCapturedAudio(bool bFinal);
+    void SendAudioFrame(const int16* Samples, int32 NumSamples);
+    void SendJsonAudioFrame(const int16* Samples, int32 NumSamples);
+    void SendBinaryAudioFrame(const int16* Samples, int32 NumSamples);
+    void SendControlMessage(const TSharedRef<FJsonObject>& Message);
+    int32 GetFrameSampleCount() const;
+
+    // Captured PCM16 waiting to go out, sized once from CaptureBufferSeconds
+    TFixedRingBuffer<int16> CaptureBuffer;
+    // Floats of the frame still being filled
+    TArray<float> PendingFrame;
+    // Most recent silent frames, sent ahead of speech so its first syllable isn't clipped
+    TFixedRingBuffer<int16> PreRollBuffer;
+    FVoiceActivityDetector VoiceActivity;
+    // Reused for every frame so steady-state capture does not allocate
+    TArray<int16> FrameSamples;
+    TArray<uint8> FramePayload;
+    TArray<uint8> FrameBuffer;
+    uint32 FrameSequence;
 
-    // WebSocket connection for real-time transcription
-    class FWebSocket* WebSocket;
+    TSharedPtr<IVoiceEncoder> VoiceEncoder;
+    void InitializeEncoder();
+
+    // WebSocket connection for real-time transcription. Created and bound on
+    // the game thread, handed to the worker as WorkerSocket for sending.
+    TSharedPtr<IWebSocket> WebSocket;
     void InitializeWebSocket();
     void CleanupWebSocket();
     void OnWebSocketMessage(const FString& Message);
     void OnWebSocketConnected();
     void OnWebSocketError(const FString& Error);
+    void OnWebSocketClosed(int32 StatusCode, const FString& Reason, bool bWasClean);
+
+    // Persistent session: one socket reused across recordings, pinged while idle
+    // and reconnected with exponential backoff. Audio captured while it is down
+    // waits in CaptureBuffer and goes out right after the new init message.
+    void BeginSession();
+    void ScheduleReconnect();
+    bool TickSession(float DeltaTime);
+    bool bSessionActive;
+    bool bSocketConnecting;
+    int32 ReconnectAttempt;
+    double NextReconnectTime;
+    double NextKeepaliveTime;
+    FTSTicker::FDelegateHandle SessionTickerHandle;
+
+    // Configuration, read from [VoiceInput] in the engine ini
+    void LoadConfiguration();
+    bool ValidateApiKey() const;
+
+    FString ApiKey;
+    FString ApiEndpoint;
+    float MaxRecordingDuration;
+    float SilenceThreshold;
+    int32 SampleRate;
+    int32 NumChannels;
+    // What the capture device delivers, never fewer than NumChannels
+    int32 DeviceChannels;
+    EVoiceAudioWireFormat WireFormat;
+    EVoiceAudioCodec AudioCodec;
+    int32 FrameDurationMs;
+    float CaptureBufferSeconds;
+    bool bEnableVoiceActivityDetection;
+    float VADMaxZeroCrossingRate;
+    int32 VADOnsetMs;
+    int32 VADHangoverMs;
+    int32 VADPreRollMs;
+    // Stop recording by itself once an utterance ends, for hands-free input
+    bool bAutoStopOnEndOfUtterance;
+    float LevelUpdateRate;
+    float CaptureQueueSeconds;
+    bool bPersistentSession;
+    float KeepaliveIntervalSeconds;
+    float ReconnectInitialDelaySeconds;
+    float ReconnectMaxDelaySeconds;
 
-    // Audio format settings
-    static const int32 SampleRate = 16000;
-    static const int32 NumChannels = 1;
     static const int32 BitsPerSample = 16;
 
     // Helpers